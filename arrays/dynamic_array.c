@@ -12,13 +12,11 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <limits.h>
 
-// Structure to represent a dynamic array.
-typedef struct{
-    int *data;    // pinter to the contiguous block of int elements (capacity elements total)
-    int size;     // number of elements currently stored
-    int capacity; // total number of elements that can be stored before resizing
-} DynamicArray;
+#include "dynamic_array.h"
+#include "mapped_array.h"
+#include "io/format.h"
 
 // Core Functions
 
@@ -29,10 +27,13 @@ typedef struct{
  * @param arr              pointer to the DynamicArray to initialize
  * @param initial_capacity number of elements to allocate space for initially
  */
-void initArray(DynamicArray *arr, int initial_capacity) {
+void daInit(DynamicArray *arr, int initial_capacity) {
     arr->data = malloc(sizeof(int) * initial_capacity);
     arr->size = 0;
     arr->capacity = initial_capacity;
+    arr->growth = DA_GROWTH_DOUBLE;
+    arr->growth_increment = 0;
+    arr->mapping = NULL;
 
     if (arr->data == NULL) {
         fprintf(stderr, "Memory allocation failed\n");
@@ -42,12 +43,18 @@ void initArray(DynamicArray *arr, int initial_capacity) {
 
 /**
  * Frees the memory used by a dynamic array.
+ * A memory-mapped array is unmapped instead, leaving its file in place.
  * Sets the data pointer to NULL and resets size and capacity to 0.
  * 
  * @param arr pointer to the DynamicArray to free
  */
-void freeArray(DynamicArray *arr) {
-    free(arr->data);
+void daFree(DynamicArray *arr) {
+    if (arr->mapping != NULL) {
+        mfClose(arr->mapping, arr->size);
+        arr->mapping = NULL;
+    } else {
+        free(arr->data);
+    }
     arr->data = NULL;
     arr->size = 0;
     arr->capacity = 0;
@@ -55,36 +62,104 @@ void freeArray(DynamicArray *arr) {
 
 /**
  * Resizes the dynamic array to a new capacity.
- * Allocates a new memory block, copies existing elements into it,
- * frees the old memory, and updates the capacity field.
+ * Uses realloc so the block is extended in place when the allocator has
+ * room after it; otherwise the allocator moves the elements in one bulk copy.
+ * A memory-mapped array extends (or truncates) its file and remaps it.
+ * If the new capacity is smaller than the size, the array is truncated.
  * 
  * @param arr          pointer to the DynamicArray to resize
  * @param new_capacity new number of elements to allocate space for
  */
-void resizeArray(DynamicArray *arr, int new_capacity) {
-    int *new_data = malloc(sizeof(int) * new_capacity);
+void daResize(DynamicArray *arr, int new_capacity) {
+    if (arr->mapping != NULL) {
+        if (arr->size > new_capacity) {
+            arr->size = new_capacity;
+        }
+        arr->data = mfResize(arr->mapping, new_capacity, arr->size);
+        arr->capacity = new_capacity;
+        return;
+    }
 
-    for (int i = 0; i < arr->size; i++) {
-        new_data[i] = arr->data[i];
+    int *new_data = realloc(arr->data, sizeof(int) * (size_t)new_capacity);
+    if (new_data == NULL && new_capacity > 0) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
     }
 
-    free(arr->data);
     arr->data = new_data;
     arr->capacity = new_capacity;
+    if (arr->size > new_capacity) {
+        arr->size = new_capacity;
+    }
+}
+
+/**
+ * Sets the policy used to grow a dynamic array once it is full.
+ * 
+ * @param arr       pointer to the DynamicArray
+ * @param policy    DA_GROWTH_DOUBLE, DA_GROWTH_ONE_HALF or DA_GROWTH_FIXED
+ * @param increment number of elements added per resize under DA_GROWTH_FIXED
+ *                  (ignored by the other policies)
+ */
+void daSetGrowthPolicy(DynamicArray *arr, DaGrowthPolicy policy, int increment) {
+    if (policy == DA_GROWTH_FIXED && increment <= 0) {
+        fprintf(stderr, "Error: Invalid growth increment\n");
+        exit(EXIT_FAILURE);
+    }
+
+    arr->growth = policy;
+    arr->growth_increment = increment;
+}
+
+// Helpers
+
+/**
+ * Helper function to compute the capacity of a full dynamic array
+ * after one resize under its growth policy.
+ * Always grows by at least one element and never overflows an int.
+ * 
+ * @param arr pointer to the DynamicArray
+ * @return the next capacity
+ */
+static int nextCapacity(DynamicArray *arr) {
+    long long capacity = arr->capacity;
+    long long next;
+
+    switch (arr->growth) {
+        case DA_GROWTH_ONE_HALF:
+            next = capacity + capacity / 2;
+            break;
+        case DA_GROWTH_FIXED:
+            next = capacity + arr->growth_increment;
+            break;
+        case DA_GROWTH_DOUBLE:
+        default:
+            next = capacity * 2;
+            break;
+    }
+
+    if (next <= capacity) next = capacity + 1;
+    if (next > INT_MAX) next = INT_MAX;
+    if (next <= capacity) {
+        fprintf(stderr, "Error: DynamicArray capacity overflow\n");
+        exit(EXIT_FAILURE);
+    }
+    return (int)next;
 }
 
 // Element Insertion
 
 /**
  * Adds a element to the end of a dynamic array.
- * Automatically resizes the array if it has reached capacity.
+ * Automatically resizes the array according to its growth policy
+ * if it has reached capacity.
  * 
  * @param arr     pointer to the DynamicArray
  * @param element the element to be added
  */
-void pushBack(DynamicArray *arr, int element) {
+void daPushBack(DynamicArray *arr, int element) {
     if (arr->size == arr->capacity) {
-        resizeArray(arr, (2 * arr->capacity));
+        daResize(arr, nextCapacity(arr));
     }
 
     arr->data[arr->size++] = element;
@@ -98,14 +173,14 @@ void pushBack(DynamicArray *arr, int element) {
  * @param index   the index to insert the element at
  * @param element the element to be inserted 
  */
-void insertAt(DynamicArray *arr, int index, int element) {
+void daInsertAt(DynamicArray *arr, int index, int element) {
     if (index < 0 || index > arr->size) {
         fprintf(stderr, "Error: Invalid index");
         exit(EXIT_FAILURE);
     }
 
     if (arr->size + 1 > arr->capacity) {
-        resizeArray(arr, (2 * arr->capacity));
+        daResize(arr, nextCapacity(arr));
     }
 
     for (int i = arr->size - 1; i >= index; i--) {
@@ -124,7 +199,7 @@ void insertAt(DynamicArray *arr, int index, int element) {
  * @param arr pointer to the DynamicArray
  * @return the value removed
 */
-int popBack(DynamicArray *arr) {
+int daPopBack(DynamicArray *arr) {
     if (arr->size == 0) {
         fprintf(stderr, "Error: popBack on empty array\n");
         exit(EXIT_FAILURE);
@@ -141,7 +216,7 @@ int popBack(DynamicArray *arr) {
  * @param arr   pointer to the DynamicArray
  * @param index the index to remove the element at
 */
-void removeAt(DynamicArray *arr, int index) {
+void daRemoveAt(DynamicArray *arr, int index) {
     if (index < 0 || index >= arr->size) {
         fprintf(stderr, "Error: Invalid index");
         exit(EXIT_FAILURE);
@@ -162,7 +237,7 @@ void removeAt(DynamicArray *arr, int index) {
  * @param arr   pointer to the DynamicArray
  * @param index the index to get the element at
 */
-int get(DynamicArray *arr, int index) {
+int daGet(DynamicArray *arr, int index) {
     if (index < 0 || index >= arr->size) {
         fprintf(stderr, "Error: Invalid index");
         exit(EXIT_FAILURE);
@@ -179,7 +254,7 @@ int get(DynamicArray *arr, int index) {
  * @param index   the index to set the element at
  * @param element the element to set in the dynamic array
 */
-void set(DynamicArray *arr, int index, int element) {
+void daSet(DynamicArray *arr, int index, int element) {
     if (index < 0 || index > arr->size) {
         fprintf(stderr, "Error: Invalid index");
         exit(EXIT_FAILURE);
@@ -194,7 +269,7 @@ void set(DynamicArray *arr, int index, int element) {
  * @param arr pointer to the DynamicArray
  * @return the size of the dynamic array
  */
-int size(DynamicArray *arr) {
+int daSize(DynamicArray *arr) {
     return arr->size;
 }
 
@@ -204,67 +279,19 @@ int size(DynamicArray *arr) {
  * @param arr pointer to the DynamicArray
  * @return true if empty; false otherwise 
  */
-bool isEmpty(DynamicArray *arr) {
+bool daIsEmpty(DynamicArray *arr) {
     return (arr->size == 0);
 }
 
 /**
  * Prints out a string representation of a dynamic array.
+ * The text is rendered through a buffered OutputBuffer (see io/format.h).
  * 
  * @param arr pointer to the DynamicArray
 */
-void printArray(DynamicArray *arr) {
-    if (isEmpty(arr)) {
-        printf("[]\n");
-        return;
-    }
-
-    printf("[");
-    for (int i = 0; i < arr->size; i++) {
-        if (i == (arr->size - 1)) {
-            printf("%d]\n", arr->data[i]);
-        } else printf("%d,", arr->data[i]);
-    }
-
-}
-
-int main () {
-    DynamicArray arr;
-    initArray(&arr, 10);
-
-    printf("Initializing and printing an empty DynamicArray of size 10: \n");
-    printArray(&arr);
-    printf("isEmpty: %s\n", isEmpty(&arr) ? "true" : "false");
-
-    printf("Adding elements to the array:\n");
-    for (int i = 0 ; i < 10; i++) {
-        pushBack(&arr, i);
-    }
-    printArray(&arr);
-
-    printf("Size of the DynamicArray: %d\n", size(&arr));
-
-    printf("Popping an element from the back:\n");
-    int back = popBack(&arr);
-    printArray(&arr);
-
-    printf("Adding the element back in the middle:\n");
-    insertAt(&arr, 4, back);
-    printArray(&arr);
-
-    printf("Removing the element again:\n");
-    removeAt(&arr, 4);
-    printArray(&arr);
-
-    printf("Getting element at index 0\n");
-    int x = get(&arr, 0);
-
-    printf("Adding two values to the back to test resize:\n");
-    pushBack(&arr, 9);
-    pushBack(&arr, x);
-    printArray(&arr);
-
-    freeArray(&arr);
-
-    return 0;
+void daPrint(DynamicArray *arr) {
+    OutputBuffer out;
+    obInit(&out, stdout, 0);
+    daFormat(arr, &out, OUTPUT_TEXT);
+    obFree(&out);
 }
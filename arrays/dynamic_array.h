@@ -0,0 +1,58 @@
+/**
+ * @file dynamic_array.h
+ * @brief Public interface of the dynamic array for integers.
+ *
+ * All functions are prefixed with `da` so the array can be linked
+ * into the same binary as the other containers in this library.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#ifndef DYNAMIC_ARRAY_H
+#define DYNAMIC_ARRAY_H
+
+#include <stdbool.h>
+
+// Backing file of a memory-mapped array (see mapped_array.h).
+struct MappedFile;
+
+// Policy used to pick the next capacity when a dynamic array is full.
+typedef enum {
+    DA_GROWTH_DOUBLE,     // capacity * 2 (default)
+    DA_GROWTH_ONE_HALF,   // capacity * 1.5, less slack memory per array
+    DA_GROWTH_FIXED       // capacity + growth_increment, for very large arrays
+} DaGrowthPolicy;
+
+// Structure to represent a dynamic array.
+typedef struct {
+    int *data;                  // pointer to the contiguous block of int elements (capacity elements total)
+    int size;                   // number of elements currently stored
+    int capacity;               // total number of elements that can be stored before resizing
+    DaGrowthPolicy growth;      // how capacity grows when the array is full
+    int growth_increment;       // elements added per resize under DA_GROWTH_FIXED
+    struct MappedFile *mapping; // file holding the elements after daMapOpen (NULL when on the heap)
+} DynamicArray;
+
+// Core Functions
+void daInit(DynamicArray *arr, int initial_capacity);
+void daFree(DynamicArray *arr);
+void daResize(DynamicArray *arr, int new_capacity);
+void daSetGrowthPolicy(DynamicArray *arr, DaGrowthPolicy policy, int increment);
+
+// Element Insertion
+void daPushBack(DynamicArray *arr, int element);
+void daInsertAt(DynamicArray *arr, int index, int element);
+
+// Element Deletion
+int daPopBack(DynamicArray *arr);
+void daRemoveAt(DynamicArray *arr, int index);
+
+// Access/Utility
+int daGet(DynamicArray *arr, int index);
+void daSet(DynamicArray *arr, int index, int element);
+int daSize(DynamicArray *arr);
+bool daIsEmpty(DynamicArray *arr);
+void daPrint(DynamicArray *arr);
+
+#endif // DYNAMIC_ARRAY_H
@@ -0,0 +1,597 @@
+/**
+ * @file dynamic_array_scan.c
+ * @brief Implementation of the vectorized DynamicArray scans.
+ *
+ * Each scan is written three times: a scalar reference, an SSE2 kernel
+ * (4 ints per vector) and an AVX2 kernel (8 ints per vector) compiled with
+ * a target attribute so the rest of the library does not need -mavx2.
+ * The vector kernels unroll over several independent accumulators so that
+ * a scan is limited by memory bandwidth rather than by instruction latency,
+ * and finish the last few elements with the scalar loop.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include "dynamic_array_scan.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define HAVE_AVX2_KERNEL 1
+#include <immintrin.h>
+#endif
+
+#if defined(__SSE2__)
+#define HAVE_SSE2_KERNEL 1
+#include <emmintrin.h>
+#endif
+
+// Elements of slack daFilter keeps past the output so kernels can store whole vectors.
+#define FILTER_SLACK 8
+
+// Helpers
+
+/**
+ * Helper function to evaluate a DaCompare on one element.
+ *
+ * @param element the array element
+ * @param op      the comparison
+ * @param value   the operand
+ * @return true if `element op value` holds; false otherwise
+ */
+static inline bool compareScalar(int element, DaCompare op, int value) {
+    switch (op) {
+        case DA_CMP_EQ: return element == value;
+        case DA_CMP_NE: return element != value;
+        case DA_CMP_LT: return element < value;
+        case DA_CMP_LE: return element <= value;
+        case DA_CMP_GT: return element > value;
+        case DA_CMP_GE: return element >= value;
+    }
+    return false;
+}
+
+/**
+ * Helper function to find the first occurrence of a value (scalar reference).
+ *
+ * @param data  the elements
+ * @param n     the number of elements
+ * @param value the value to search for
+ * @return the index of the first occurrence if found; -1 otherwise
+ */
+static int findScalar(const int *data, int n, int value) {
+    for (int i = 0; i < n; i++) {
+        if (data[i] == value) return i;
+    }
+    return -1;
+}
+
+/**
+ * Helper function to count the occurrences of a value (scalar reference).
+ *
+ * @param data  the elements
+ * @param n     the number of elements
+ * @param value the value to count
+ * @return the number of elements equal to value
+ */
+static int countScalar(const int *data, int n, int value) {
+    int count = 0;
+    for (int i = 0; i < n; i++) {
+        count += (data[i] == value);
+    }
+    return count;
+}
+
+/**
+ * Helper function to fold elements into a running min and max (scalar reference).
+ *
+ * @param data the elements
+ * @param n    the number of elements
+ * @param min  in/out: the running minimum
+ * @param max  in/out: the running maximum
+ */
+static void minMaxScalar(const int *data, int n, int *min, int *max) {
+    for (int i = 0; i < n; i++) {
+        if (data[i] < *min) *min = data[i];
+        if (data[i] > *max) *max = data[i];
+    }
+}
+
+/**
+ * Helper function to add up elements in 64 bits (scalar reference).
+ *
+ * @param data the elements
+ * @param n    the number of elements
+ * @return the sum of the elements
+ */
+static long long sumScalar(const int *data, int n) {
+    long long sum = 0;
+    for (int i = 0; i < n; i++) {
+        sum += data[i];
+    }
+    return sum;
+}
+
+/**
+ * Helper function to copy the matching elements, branch-free (scalar reference).
+ * Every element is written, but the output position only advances on a match.
+ *
+ * @param data  the elements
+ * @param n     the number of elements
+ * @param op    the comparison
+ * @param value the operand
+ * @param out   output: the matches, with room for n elements
+ * @return the number of matches
+ */
+static int filterScalar(const int *data, int n, DaCompare op, int value, int *out) {
+    int count = 0;
+    for (int i = 0; i < n; i++) {
+        out[count] = data[i];
+        count += compareScalar(data[i], op, value);
+    }
+    return count;
+}
+
+// The SSE2 and AVX2 kernels below follow the contract of their scalar references.
+
+#ifdef HAVE_SSE2_KERNEL
+
+/**
+ * Helper function to compute the lane mask of a DaCompare on 4 elements.
+ * Every comparison is one of ==, > or < (swapped >), possibly negated.
+ *
+ * @param x     the elements
+ * @param op    the comparison
+ * @param value the operand, broadcast
+ * @return bit j set if lane j matches
+ */
+static inline int compareSse2(__m128i x, DaCompare op, __m128i value) {
+    __m128i match;
+    int negate = (op == DA_CMP_NE || op == DA_CMP_LE || op == DA_CMP_GE) ? 0xF : 0;
+
+    if (op == DA_CMP_EQ || op == DA_CMP_NE) match = _mm_cmpeq_epi32(x, value);
+    else if (op == DA_CMP_GT || op == DA_CMP_LE) match = _mm_cmpgt_epi32(x, value);
+    else match = _mm_cmpgt_epi32(value, x);
+
+    return _mm_movemask_ps(_mm_castsi128_ps(match)) ^ negate;
+}
+
+static int findSse2(const int *data, int n, int value) {
+    __m128i target = _mm_set1_epi32(value);
+    int i = 0;
+
+    for (; i + 16 <= n; i += 16) {
+        __m128i m0 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(data + i)), target);
+        __m128i m1 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(data + i + 4)), target);
+        __m128i m2 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(data + i + 8)), target);
+        __m128i m3 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(data + i + 12)), target);
+        __m128i any = _mm_or_si128(_mm_or_si128(m0, m1), _mm_or_si128(m2, m3));
+
+        if (_mm_movemask_epi8(any) != 0) break;
+    }
+    for (; i < n; i++) {
+        if (data[i] == value) return i;
+    }
+    return -1;
+}
+
+static int countSse2(const int *data, int n, int value) {
+    __m128i target = _mm_set1_epi32(value);
+    __m128i c0 = _mm_setzero_si128();
+    __m128i c1 = _mm_setzero_si128();
+    int lanes[4];
+    int i = 0;
+
+    // cmpeq yields -1 per match, so subtracting it counts.
+    for (; i + 8 <= n; i += 8) {
+        c0 = _mm_sub_epi32(c0, _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(data + i)), target));
+        c1 = _mm_sub_epi32(c1, _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(data + i + 4)), target));
+    }
+    _mm_storeu_si128((__m128i *)lanes, _mm_add_epi32(c0, c1));
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + countScalar(data + i, n - i, value);
+}
+
+static void minMaxSse2(const int *data, int n, int *min, int *max) {
+    __m128i lo = _mm_set1_epi32(*min);
+    __m128i hi = _mm_set1_epi32(*max);
+    int lanes[4];
+    int i = 0;
+
+    // SSE2 has no 32-bit min/max, so select with a compare mask.
+    for (; i + 4 <= n; i += 4) {
+        __m128i x = _mm_loadu_si128((const __m128i *)(data + i));
+        __m128i less = _mm_cmpgt_epi32(lo, x);
+        __m128i greater = _mm_cmpgt_epi32(x, hi);
+        lo = _mm_or_si128(_mm_and_si128(less, x), _mm_andnot_si128(less, lo));
+        hi = _mm_or_si128(_mm_and_si128(greater, x), _mm_andnot_si128(greater, hi));
+    }
+
+    _mm_storeu_si128((__m128i *)lanes, lo);
+    minMaxScalar(lanes, 4, min, max);
+    _mm_storeu_si128((__m128i *)lanes, hi);
+    minMaxScalar(lanes, 4, min, max);
+    minMaxScalar(data + i, n - i, min, max);
+}
+
+static long long sumSse2(const int *data, int n) {
+    __m128i zero = _mm_setzero_si128();
+    __m128i s0 = _mm_setzero_si128();
+    __m128i s1 = _mm_setzero_si128();
+    long long lanes[2];
+    int i = 0;
+
+    // Sign-extend to 64 bits by interleaving with the sign mask.
+    for (; i + 4 <= n; i += 4) {
+        __m128i x = _mm_loadu_si128((const __m128i *)(data + i));
+        __m128i sign = _mm_cmpgt_epi32(zero, x);
+        s0 = _mm_add_epi64(s0, _mm_unpacklo_epi32(x, sign));
+        s1 = _mm_add_epi64(s1, _mm_unpackhi_epi32(x, sign));
+    }
+    _mm_storeu_si128((__m128i *)lanes, _mm_add_epi64(s0, s1));
+    return lanes[0] + lanes[1] + sumScalar(data + i, n - i);
+}
+
+static int filterSse2(const int *data, int n, DaCompare op, int value, int *out) {
+    __m128i operand = _mm_set1_epi32(value);
+    int count = 0;
+    int i = 0;
+
+    // No variable shuffle in SSE2: store every lane and advance by its match bit.
+    for (; i + 4 <= n; i += 4) {
+        int mask = compareSse2(_mm_loadu_si128((const __m128i *)(data + i)), op, operand);
+        out[count] = data[i];
+        count += mask & 1;
+        out[count] = data[i + 1];
+        count += (mask >> 1) & 1;
+        out[count] = data[i + 2];
+        count += (mask >> 2) & 1;
+        out[count] = data[i + 3];
+        count += (mask >> 3) & 1;
+    }
+    return count + filterScalar(data + i, n - i, op, value, out + count);
+}
+
+#endif // HAVE_SSE2_KERNEL
+
+#ifdef HAVE_AVX2_KERNEL
+
+// compactTable[mask] lists the lanes set in mask first, for _mm256_permutevar8x32_epi32.
+static unsigned char compactTable[256][8];
+
+/**
+ * Helper function to fill compactTable (once, from detectLevel).
+ */
+static void buildCompactTable(void) {
+    for (int mask = 0; mask < 256; mask++) {
+        int k = 0;
+        for (int lane = 0; lane < 8; lane++) {
+            if (mask & (1 << lane)) compactTable[mask][k++] = (unsigned char)lane;
+        }
+        while (k < 8) compactTable[mask][k++] = 0;
+    }
+}
+
+/**
+ * Helper function to compute the lane mask of a DaCompare on 8 elements.
+ *
+ * @param x     the elements
+ * @param op    the comparison
+ * @param value the operand, broadcast
+ * @return bit j set if lane j matches
+ */
+__attribute__((target("avx2")))
+static inline int compareAvx2(__m256i x, DaCompare op, __m256i value) {
+    __m256i match;
+    int negate = (op == DA_CMP_NE || op == DA_CMP_LE || op == DA_CMP_GE) ? 0xFF : 0;
+
+    if (op == DA_CMP_EQ || op == DA_CMP_NE) match = _mm256_cmpeq_epi32(x, value);
+    else if (op == DA_CMP_GT || op == DA_CMP_LE) match = _mm256_cmpgt_epi32(x, value);
+    else match = _mm256_cmpgt_epi32(value, x);
+
+    return _mm256_movemask_ps(_mm256_castsi256_ps(match)) ^ negate;
+}
+
+__attribute__((target("avx2")))
+static int findAvx2(const int *data, int n, int value) {
+    __m256i target = _mm256_set1_epi32(value);
+    int i = 0;
+
+    for (; i + 32 <= n; i += 32) {
+        __m256i m0 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(data + i)), target);
+        __m256i m1 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(data + i + 8)), target);
+        __m256i m2 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(data + i + 16)), target);
+        __m256i m3 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(data + i + 24)), target);
+        __m256i any = _mm256_or_si256(_mm256_or_si256(m0, m1), _mm256_or_si256(m2, m3));
+
+        if (!_mm256_testz_si256(any, any)) break;
+    }
+    for (; i < n; i++) {
+        if (data[i] == value) return i;
+    }
+    return -1;
+}
+
+__attribute__((target("avx2")))
+static int countAvx2(const int *data, int n, int value) {
+    __m256i target = _mm256_set1_epi32(value);
+    __m256i c0 = _mm256_setzero_si256();
+    __m256i c1 = _mm256_setzero_si256();
+    __m256i c2 = _mm256_setzero_si256();
+    __m256i c3 = _mm256_setzero_si256();
+    int lanes[8];
+    int i = 0;
+
+    for (; i + 32 <= n; i += 32) {
+        c0 = _mm256_sub_epi32(c0, _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(data + i)), target));
+        c1 = _mm256_sub_epi32(c1, _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(data + i + 8)), target));
+        c2 = _mm256_sub_epi32(c2, _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(data + i + 16)), target));
+        c3 = _mm256_sub_epi32(c3, _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(data + i + 24)), target));
+    }
+    _mm256_storeu_si256((__m256i *)lanes, _mm256_add_epi32(_mm256_add_epi32(c0, c1), _mm256_add_epi32(c2, c3)));
+
+    int count = countScalar(data + i, n - i, value);
+    for (int j = 0; j < 8; j++) {
+        count += lanes[j];
+    }
+    return count;
+}
+
+__attribute__((target("avx2")))
+static void minMaxAvx2(const int *data, int n, int *min, int *max) {
+    __m256i lo0 = _mm256_set1_epi32(*min);
+    __m256i hi0 = _mm256_set1_epi32(*max);
+    __m256i lo1 = lo0;
+    __m256i hi1 = hi0;
+    int lanes[8];
+    int i = 0;
+
+    for (; i + 16 <= n; i += 16) {
+        __m256i x0 = _mm256_loadu_si256((const __m256i *)(data + i));
+        __m256i x1 = _mm256_loadu_si256((const __m256i *)(data + i + 8));
+        lo0 = _mm256_min_epi32(lo0, x0);
+        hi0 = _mm256_max_epi32(hi0, x0);
+        lo1 = _mm256_min_epi32(lo1, x1);
+        hi1 = _mm256_max_epi32(hi1, x1);
+    }
+
+    _mm256_storeu_si256((__m256i *)lanes, _mm256_min_epi32(lo0, lo1));
+    minMaxScalar(lanes, 8, min, max);
+    _mm256_storeu_si256((__m256i *)lanes, _mm256_max_epi32(hi0, hi1));
+    minMaxScalar(lanes, 8, min, max);
+    minMaxScalar(data + i, n - i, min, max);
+}
+
+__attribute__((target("avx2")))
+static long long sumAvx2(const int *data, int n) {
+    __m256i s0 = _mm256_setzero_si256();
+    __m256i s1 = _mm256_setzero_si256();
+    long long lanes[4];
+    int i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(data + i));
+        s0 = _mm256_add_epi64(s0, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(x)));
+        s1 = _mm256_add_epi64(s1, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(x, 1)));
+    }
+    _mm256_storeu_si256((__m256i *)lanes, _mm256_add_epi64(s0, s1));
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + sumScalar(data + i, n - i);
+}
+
+__attribute__((target("avx2")))
+static int filterAvx2(const int *data, int n, DaCompare op, int value, int *out) {
+    __m256i operand = _mm256_set1_epi32(value);
+    int count = 0;
+    int i = 0;
+
+    // Pack the matching lanes to the front and store the whole vector.
+    for (; i + 8 <= n; i += 8) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(data + i));
+        int mask = compareAvx2(x, op, operand);
+        __m256i lanes = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)compactTable[mask]));
+
+        _mm256_storeu_si256((__m256i *)(out + count), _mm256_permutevar8x32_epi32(x, lanes));
+        count += __builtin_popcount((unsigned)mask);
+    }
+    return count + filterScalar(data + i, n - i, op, value, out + count);
+}
+
+#endif // HAVE_AVX2_KERNEL
+
+// Kernel selection
+
+// Only the level itself is shared, so relaxed loads and stores suffice.
+static atomic_int pinnedLevel = -1;
+static DaScanLevel detectedLevel = DA_SCAN_SCALAR;
+static pthread_once_t detectOnce = PTHREAD_ONCE_INIT;
+
+/**
+ * Helper function to find the fastest kernel level the CPU supports and
+ * build the tables it needs. Runs once under detectOnce, so no scan can
+ * see the AVX2 level before compactTable is complete.
+ */
+static void detectLevel(void) {
+#ifdef HAVE_SSE2_KERNEL
+    detectedLevel = DA_SCAN_SSE2;
+#endif
+#if defined(HAVE_AVX2_KERNEL) && defined(HAVE_SSE2_KERNEL)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        buildCompactTable();
+        detectedLevel = DA_SCAN_AVX2;
+    }
+#endif
+}
+
+/**
+ * Helper function to return the fastest kernel level the CPU supports.
+ *
+ * @return the best supported DaScanLevel
+ */
+static DaScanLevel bestLevel(void) {
+    pthread_once(&detectOnce, detectLevel);
+    return detectedLevel;
+}
+
+/**
+ * Returns the kernel level the scans currently use.
+ *
+ * @return the pinned level if one was set; otherwise the fastest supported
+ */
+DaScanLevel daScanGetLevel(void) {
+    DaScanLevel best = bestLevel();
+    int pinned = atomic_load_explicit(&pinnedLevel, memory_order_relaxed);
+    return (pinned >= 0 && pinned < (int)best) ? (DaScanLevel)pinned : best;
+}
+
+/**
+ * Pins the scans to a kernel level. Levels the CPU does not support fall
+ * back to the fastest one it does, so results never depend on the choice.
+ *
+ * @param level the level to use
+ */
+void daScanSetLevel(DaScanLevel level) {
+    atomic_store_explicit(&pinnedLevel, (int)level, memory_order_relaxed);
+}
+
+// Scans
+
+/**
+ * Finds the first occurrence of a value in a dynamic array.
+ *
+ * @param arr   pointer to the DynamicArray
+ * @param value the value to search for
+ * @return the index of the first occurrence if found; -1 otherwise
+ */
+int daFind(DynamicArray *arr, int value) {
+    switch (daScanGetLevel()) {
+#ifdef HAVE_AVX2_KERNEL
+        case DA_SCAN_AVX2: return findAvx2(arr->data, arr->size, value);
+#endif
+#ifdef HAVE_SSE2_KERNEL
+        case DA_SCAN_SSE2: return findSse2(arr->data, arr->size, value);
+#endif
+        default: return findScalar(arr->data, arr->size, value);
+    }
+}
+
+/**
+ * Counts the occurrences of a value in a dynamic array.
+ *
+ * @param arr   pointer to the DynamicArray
+ * @param value the value to count
+ * @return the number of elements equal to value
+ */
+int daCount(DynamicArray *arr, int value) {
+    switch (daScanGetLevel()) {
+#ifdef HAVE_AVX2_KERNEL
+        case DA_SCAN_AVX2: return countAvx2(arr->data, arr->size, value);
+#endif
+#ifdef HAVE_SSE2_KERNEL
+        case DA_SCAN_SSE2: return countSse2(arr->data, arr->size, value);
+#endif
+        default: return countScalar(arr->data, arr->size, value);
+    }
+}
+
+/**
+ * Finds the smallest and largest elements of a dynamic array in one pass.
+ *
+ * @param arr pointer to the DynamicArray (must not be empty)
+ * @param min output: the smallest element
+ * @param max output: the largest element
+ */
+void daMinMax(DynamicArray *arr, int *min, int *max) {
+    if (arr->size == 0) {
+        fprintf(stderr, "Error: minMax on empty array\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // Seed with a real element so every vector lane only ever holds elements.
+    *min = arr->data[0];
+    *max = arr->data[0];
+    switch (daScanGetLevel()) {
+#ifdef HAVE_AVX2_KERNEL
+        case DA_SCAN_AVX2: minMaxAvx2(arr->data, arr->size, min, max); break;
+#endif
+#ifdef HAVE_SSE2_KERNEL
+        case DA_SCAN_SSE2: minMaxSse2(arr->data, arr->size, min, max); break;
+#endif
+        default: minMaxScalar(arr->data, arr->size, min, max); break;
+    }
+}
+
+/**
+ * Finds the smallest element of a dynamic array.
+ *
+ * @param arr pointer to the DynamicArray (must not be empty)
+ * @return the smallest element
+ */
+int daMin(DynamicArray *arr) {
+    int min, max;
+    daMinMax(arr, &min, &max);
+    return min;
+}
+
+/**
+ * Finds the largest element of a dynamic array.
+ *
+ * @param arr pointer to the DynamicArray (must not be empty)
+ * @return the largest element
+ */
+int daMax(DynamicArray *arr) {
+    int min, max;
+    daMinMax(arr, &min, &max);
+    return max;
+}
+
+/**
+ * Adds up the elements of a dynamic array. The sum is kept in 64 bits,
+ * so it cannot overflow for any array that fits in an int-sized index.
+ *
+ * @param arr pointer to the DynamicArray
+ * @return the sum of all elements (0 if empty)
+ */
+long long daSum(DynamicArray *arr) {
+    switch (daScanGetLevel()) {
+#ifdef HAVE_AVX2_KERNEL
+        case DA_SCAN_AVX2: return sumAvx2(arr->data, arr->size);
+#endif
+#ifdef HAVE_SSE2_KERNEL
+        case DA_SCAN_SSE2: return sumSse2(arr->data, arr->size);
+#endif
+        default: return sumScalar(arr->data, arr->size);
+    }
+}
+
+/**
+ * Copies the elements of a dynamic array that satisfy `element op value`
+ * into a new dynamic array, preserving their order.
+ *
+ * @param arr   pointer to the DynamicArray to scan
+ * @param op    the comparison to apply
+ * @param value the operand of the comparison
+ * @param out   pointer to an uninitialized DynamicArray to receive the
+ *              matches (must not be arr); free it with daFree
+ */
+void daFilter(DynamicArray *arr, DaCompare op, int value, DynamicArray *out) {
+    daInit(out, arr->size + FILTER_SLACK);
+
+    switch (daScanGetLevel()) {
+#ifdef HAVE_AVX2_KERNEL
+        case DA_SCAN_AVX2: out->size = filterAvx2(arr->data, arr->size, op, value, out->data); break;
+#endif
+#ifdef HAVE_SSE2_KERNEL
+        case DA_SCAN_SSE2: out->size = filterSse2(arr->data, arr->size, op, value, out->data); break;
+#endif
+        default: out->size = filterScalar(arr->data, arr->size, op, value, out->data); break;
+    }
+
+    // Give back the memory of a selective filter.
+    if (out->size < out->capacity / 2) {
+        daResize(out, out->size > 0 ? out->size : 1);
+    }
+}
@@ -0,0 +1,48 @@
+/**
+ * @file dynamic_array_scan.h
+ * @brief Public interface of vectorized whole-array scans over a DynamicArray.
+ *
+ * Every scan has a scalar, an SSE2 and an AVX2 kernel that return identical
+ * results. The fastest kernel the CPU supports is picked at runtime, and
+ * daScanSetLevel can pin a slower one (e.g. to compare them).
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#ifndef DYNAMIC_ARRAY_SCAN_H
+#define DYNAMIC_ARRAY_SCAN_H
+
+#include "dynamic_array.h"
+
+// Instruction set used by the scan kernels, from slowest to fastest.
+typedef enum {
+    DA_SCAN_SCALAR,
+    DA_SCAN_SSE2,
+    DA_SCAN_AVX2
+} DaScanLevel;
+
+// Comparison applied by daFilter between each element and the operand.
+typedef enum {
+    DA_CMP_EQ, // element == value
+    DA_CMP_NE, // element != value
+    DA_CMP_LT, // element <  value
+    DA_CMP_LE, // element <= value
+    DA_CMP_GT, // element >  value
+    DA_CMP_GE  // element >= value
+} DaCompare;
+
+// Kernel selection
+DaScanLevel daScanGetLevel(void);
+void daScanSetLevel(DaScanLevel level);
+
+// Scans
+int daFind(DynamicArray *arr, int value);
+int daCount(DynamicArray *arr, int value);
+int daMin(DynamicArray *arr);
+int daMax(DynamicArray *arr);
+void daMinMax(DynamicArray *arr, int *min, int *max);
+long long daSum(DynamicArray *arr);
+void daFilter(DynamicArray *arr, DaCompare op, int value, DynamicArray *out);
+
+#endif // DYNAMIC_ARRAY_SCAN_H
@@ -14,14 +14,10 @@
 #include <stdlib.h>
 #include <stdbool.h>
 #include <string.h>
+#include <limits.h>
 
-// Structure to represent a generic dynamic array.
-typedef struct {
-    void *data;          // pointer to the raw data buffer (element_size * capacity bytes)
-    int size;            // number of elements currently stored
-    int capacity;        // total number of elements that can be stored before resizing
-    size_t element_size; // size (in bytes) of each element stored in the array
-} GenericArray;
+#include "generic_array.h"
+#include "mapped_array.h"
 
 // Core Functions
 
@@ -34,11 +30,12 @@ typedef struct {
  * @param initial_capacity number of elements to allocate space for initially
  * 
  */
-void initArray(GenericArray *arr, size_t element_size, int initial_capacity) {
+void gaInit(GenericArray *arr, size_t element_size, int initial_capacity) {
     arr->element_size = element_size;
     arr->capacity = initial_capacity;
     arr->data = malloc(arr->capacity * arr->element_size);
     arr->size = 0;
+    arr->mapping = NULL;
 
     if (arr->data == NULL) {
         fprintf(stderr, "Memory allocation failed\n");
@@ -52,8 +49,13 @@ void initArray(GenericArray *arr, size_t element_size, int initial_capacity) {
  * 
  * @param arr pointer to the GenericArray to free
  */
-void freeArray(GenericArray *arr) {
-    free(arr->data);
+void gaFree(GenericArray *arr) {
+    if (arr->mapping != NULL) {
+        mfClose(arr->mapping, arr->size);
+        arr->mapping = NULL;
+    } else {
+        free(arr->data);
+    }
     arr->data = NULL;
     arr->size = 0;
     arr->capacity = 0;
@@ -62,28 +64,56 @@ void freeArray(GenericArray *arr) {
 
 /**
  * Resizes the generic arry to a new capacity.
- * Allocates a new memory block, copies existing elements into it,
- * frees the old memory, and updates the capcity field.
+ * Uses realloc so the block is extended in place when possible; otherwise
+ * the existing elements are moved in one bulk copy.
+ * A memory-mapped array extends (or truncates) its file and remaps it.
+ * If the new capacity is smaller than the size, the array is truncated.
  * 
  * @param arr          pointer to the GenericArray to resize
  * @param new_capacity new number of elements to allocate space for
  */
-void resizeArray(GenericArray *arr, int new_capacity) {
-    char *new_data = malloc(new_capacity * arr->element_size);
-    if (new_data == NULL) {
-        fprintf(stderr, "Memory allocation failed\n");
-        exit(EXIT_FAILURE);
+void gaResize(GenericArray *arr, int new_capacity) {
+    if (arr->mapping != NULL) {
+        if (arr->size > new_capacity) {
+            arr->size = new_capacity;
+        }
+        arr->data = mfResize(arr->mapping, new_capacity, arr->size);
+        arr->capacity = new_capacity;
+        return;
     }
 
-    for (int i = 0; i < arr->size; i++) {
-        void *src = (char *)arr->data + i * arr->element_size; 
-        void *dest = new_data + i * arr->element_size;
-        mempcpy(dest, src, arr->element_size);
+    void *new_data = realloc(arr->data, (size_t)new_capacity * arr->element_size);
+    if (new_data == NULL && new_capacity > 0) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
     }
 
-    free(arr->data);
     arr->data = new_data;
     arr->capacity = new_capacity;
+    if (arr->size > new_capacity) {
+        arr->size = new_capacity;
+    }
+}
+
+// Helpers
+
+/**
+ * Helper function to double the capacity of a generic array until it
+ * can hold at least the given number of elements.
+ * 
+ * @param arr          pointer to the GenericArray
+ * @param min_capacity number of elements the array must be able to hold
+ */
+static void ensureCapacity(GenericArray *arr, int min_capacity) {
+    if (min_capacity <= arr->capacity) return;
+
+    long long new_capacity = arr->capacity > 0 ? arr->capacity : 1;
+    while (new_capacity < min_capacity) {
+        new_capacity *= 2;
+    }
+    if (new_capacity > INT_MAX) new_capacity = INT_MAX;
+
+    gaResize(arr, (int)new_capacity);
 }
 
 // Element Insertion
@@ -95,10 +125,8 @@ void resizeArray(GenericArray *arr, int new_capacity) {
  * @param arr     pointer to the GenericArray
  * @param element pointer to the element to be added
  */
-void pushBack(GenericArray *arr, void *element) {
-    if (arr->size == arr->capacity) {
-        resizeArray(arr, arr->capacity * 2);
-    }
+void gaPushBack(GenericArray *arr, void *element) {
+    ensureCapacity(arr, arr->size + 1);
 
     void *target = (char *)arr->data + arr->size * arr->element_size;
     memcpy(target, element, arr->element_size);
@@ -113,27 +141,44 @@ void pushBack(GenericArray *arr, void *element) {
  * @param index   the index to insert the element at
  * @param element pointer to the element to be inserted 
  */
-void insertAt(GenericArray *arr, int index, void *element) {
+void gaInsertAt(GenericArray *arr, int index, void *element) {
     if (index < 0 || index > arr->size) {
         fprintf(stderr, "Error: Invalid index");
         exit(EXIT_FAILURE);
     }
 
-    if (arr->size + 1 > arr->capacity) {
-        resizeArray(arr, arr->capacity * 2);
-    }
-
-    for (int i = arr->size -1; i >= index; i--) {
-        void *src = (char *)arr->data + i * arr->element_size;
-        void *dest = (char *)arr->data + (i + 1) * arr->element_size;
-        memcpy(dest, src, arr->element_size);
-    }
+    ensureCapacity(arr, arr->size + 1);
 
-    void *target = (char *)arr->data + index * arr->element_size;
+    char *target = (char *)arr->data + index * arr->element_size;
+    memmove(target + arr->element_size, target, (arr->size - index) * arr->element_size);
     memcpy(target, element, arr->element_size);
     arr->size++;
 }
 
+/**
+ * Inserts several contiguous elements into a generic array at a specific index.
+ * The tail is shifted right once to make room for all of them.
+ * 
+ * @param arr      pointer to the GenericArray
+ * @param index    the index to insert the first element at
+ * @param elements pointer to count elements stored back to back
+ * @param count    the number of elements to insert
+ */
+void gaInsertRangeAt(GenericArray *arr, int index, const void *elements, int count) {
+    if (index < 0 || index > arr->size || count < 0 || count > INT_MAX - arr->size) {
+        fprintf(stderr, "Error: Invalid index");
+        exit(EXIT_FAILURE);
+    }
+
+    if (count == 0) return;
+    ensureCapacity(arr, arr->size + count);
+
+    char *target = (char *)arr->data + index * arr->element_size;
+    memmove(target + count * arr->element_size, target, (arr->size - index) * arr->element_size);
+    memcpy(target, elements, count * arr->element_size);
+    arr->size += count;
+}
+
 /**
  * Removes an element from the back of a dynamic array and copies it
  * to the given output location
@@ -141,7 +186,7 @@ void insertAt(GenericArray *arr, int index, void *element) {
  * @param arr         pointer to the GenericArray
  * @param out_element pointer to a memory location where the removed element will be copied
 */
-void popBack(GenericArray *arr, void *out_element) {
+void gaPopBack(GenericArray *arr, void *out_element) {
     if (arr->size == 0) {
         fprintf(stderr, "Error: popBack on empty array\n");
         exit(EXIT_FAILURE);
@@ -158,21 +203,37 @@ void popBack(GenericArray *arr, void *out_element) {
  * @param arr   pointer to the GenericArray
  * @param index the index to remove the element at
 */
-void removeAt(GenericArray *arr, int index) {
+void gaRemoveAt(GenericArray *arr, int index) {
     if (index < 0 || index >= arr->size) {
         fprintf(stderr, "Error: Invalid index");
         exit(EXIT_FAILURE);
     }
 
-    for (int i = index; i < arr->size - 1; i++) {
-        void *src = (char *)arr->data + (i + 1) * arr->element_size;
-        void *dest = (char *)arr->data + i * arr->element_size;
-        memcpy(dest, src, arr->element_size);
-    }
-    
+    char *target = (char *)arr->data + index * arr->element_size;
+    memmove(target, target + arr->element_size, (arr->size - index - 1) * arr->element_size);
     arr->size--;
 }
 
+/**
+ * Removes several contiguous elements of a generic array starting at a specific index.
+ * The tail is shifted left once to close the gap.
+ * 
+ * @param arr   pointer to the GenericArray
+ * @param index the index of the first element to remove
+ * @param count the number of elements to remove
+*/
+void gaRemoveRange(GenericArray *arr, int index, int count) {
+    if (index < 0 || count < 0 || index > arr->size - count) {
+        fprintf(stderr, "Error: Invalid index");
+        exit(EXIT_FAILURE);
+    }
+
+    char *target = (char *)arr->data + index * arr->element_size;
+    memmove(target, target + count * arr->element_size,
+            (arr->size - index - count) * arr->element_size);
+    arr->size -= count;
+}
+
 // Access/Utility
 
 /**
@@ -183,7 +244,7 @@ void removeAt(GenericArray *arr, int index) {
  * @param index       the index to get the element at
  * @param out_element pointer to a memory location where the removed element will be copied
 */
-void get(GenericArray *arr, int index, void *out_element) {
+void gaGet(GenericArray *arr, int index, void *out_element) {
     if (index < 0 || index >= arr->size) {
         fprintf(stderr, "Error: Invalid index");
         exit(EXIT_FAILURE);
@@ -201,7 +262,7 @@ void get(GenericArray *arr, int index, void *out_element) {
  * @param index   the index to set the element at
  * @param element the element to set in the generic array
 */
-void set(GenericArray *arr, int index, void *element) {
+void gaSet(GenericArray *arr, int index, void *element) {
     if (index < 0 || index >= arr->size) {
         fprintf(stderr, "Error: Invalid index");
         exit(EXIT_FAILURE);
@@ -217,7 +278,7 @@ void set(GenericArray *arr, int index, void *element) {
  * @param arr pointer to the GenericArray
  * @return the size of the generic array
  */
-int size(GenericArray *arr) {
+int gaSize(GenericArray *arr) {
     return arr->size;
 }
 
@@ -227,7 +288,7 @@ int size(GenericArray *arr) {
  * @param arr pointer to the GenericArray
  * @return true if empty; false otherwise 
  */
-bool isEmpty(GenericArray *arr) {
+bool gaIsEmpty(GenericArray *arr) {
     return (arr->size == 0);
 }
 
@@ -237,8 +298,8 @@ bool isEmpty(GenericArray *arr) {
  * @param arr       pointer to the GenericArray
  * @param printFunc function that prints a single element; accepts a void pointer to the element
  */
-void printArray(GenericArray *arr, void (*printFunc)(void *)) {
-    if (isEmpty(arr)) {
+void gaPrint(GenericArray *arr, void (*printFunc)(void *)) {
+    if (gaIsEmpty(arr)) {
         printf("[]\n");
         return;
     }
@@ -253,56 +314,3 @@ void printArray(GenericArray *arr, void (*printFunc)(void *)) {
     }
     printf("]\n");
 }
-
-/**
- * Print function for elements of type char.
- * 
- * @param elem pointer to the element to print
- */
-void printChar(void *elem) {
-    printf("%c", *(char *)elem);
-}
-
-int main() {
-    GenericArray arr;
-    initArray(&arr, sizeof(char), 10);
-
-    printf("Initializing and printing an empty GenericArray of chars:\n");
-    printArray(&arr, printChar);
-    printf("isEmpty: %s\n", isEmpty(&arr) ? "true" : "false");
-
-    printf("Adding elements to the array:\n");
-    for (char c = 'a'; c < 'a' + 10; c++) {
-        pushBack(&arr, &c);
-    }
-    printArray(&arr, printChar);
-
-    printf("Size of the GenericArray: %d\n", size(&arr));
-
-    printf("Popping an element from the back:\n");
-    char back;
-    popBack(&arr, &back);
-    printArray(&arr, printChar);
-
-    printf("Adding the popped element '%c' back in the middle:\n", back);
-    insertAt(&arr, 4, &back);
-    printArray(&arr, printChar);
-
-    printf("Removing the element again:\n");
-    removeAt(&arr, 4);
-    printArray(&arr, printChar);
-
-    printf("Getting element at index 0:\n");
-    char x;
-    get(&arr, 0, &x);
-    printf("Element at index 0: '%c'\n", x);
-
-    printf("Adding two values to the back to test resize:\n");
-    pushBack(&arr, &back);
-    pushBack(&arr, &x);
-    printArray(&arr, printChar);
-
-    freeArray(&arr);
-
-    return 0;
-}
@@ -0,0 +1,52 @@
+/**
+ * @file generic_array.h
+ * @brief Public interface of the generic dynamic array using void pointers.
+ *
+ * All functions are prefixed with `ga` so the array can be linked
+ * into the same binary as the other containers in this library.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#ifndef GENERIC_ARRAY_H
+#define GENERIC_ARRAY_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// Backing file of a memory-mapped array (see mapped_array.h).
+struct MappedFile;
+
+// Structure to represent a generic dynamic array.
+typedef struct {
+    void *data;                 // pointer to the raw data buffer (element_size * capacity bytes)
+    int size;                   // number of elements currently stored
+    int capacity;               // total number of elements that can be stored before resizing
+    size_t element_size;        // size (in bytes) of each element stored in the array
+    struct MappedFile *mapping; // file holding the elements after gaMapOpen (NULL when on the heap)
+} GenericArray;
+
+// Core Functions
+void gaInit(GenericArray *arr, size_t element_size, int initial_capacity);
+void gaFree(GenericArray *arr);
+void gaResize(GenericArray *arr, int new_capacity);
+
+// Element Insertion
+void gaPushBack(GenericArray *arr, void *element);
+void gaInsertAt(GenericArray *arr, int index, void *element);
+void gaInsertRangeAt(GenericArray *arr, int index, const void *elements, int count);
+
+// Element Deletion
+void gaPopBack(GenericArray *arr, void *out_element);
+void gaRemoveAt(GenericArray *arr, int index);
+void gaRemoveRange(GenericArray *arr, int index, int count);
+
+// Access/Utility
+void gaGet(GenericArray *arr, int index, void *out_element);
+void gaSet(GenericArray *arr, int index, void *element);
+int gaSize(GenericArray *arr);
+bool gaIsEmpty(GenericArray *arr);
+void gaPrint(GenericArray *arr, void (*printFunc)(void *));
+
+#endif // GENERIC_ARRAY_H
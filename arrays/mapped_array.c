@@ -0,0 +1,352 @@
+/**
+ * @file mapped_array.c
+ * @brief Implementation of the memory-mapped DynamicArray and GenericArray.
+ *
+ * The whole file is mapped shared and read-write, header included. Growth
+ * reserves the new blocks with posix_fallocate before remapping, so a full
+ * disk is reported as an error instead of a SIGBUS on the first store.
+ * On Linux the mapping grows with mremap, which moves page table entries
+ * instead of copying; elsewhere it is unmapped and mapped again.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#ifdef __linux__
+#define _GNU_SOURCE
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "mapped_array.h"
+
+// Structure to represent the header at the start of a mapped array file.
+typedef struct {
+    char magic[8];         // "DSALGOMA"
+    uint32_t version;      // MAPPED_ARRAY_VERSION
+    uint32_t header_size;  // MAPPED_ARRAY_HEADER_SIZE
+    uint64_t element_size; // size (in bytes) of each element
+    int64_t size;          // number of elements stored
+    int64_t capacity;      // number of elements the file has room for
+    uint8_t reserved[24];  // zero; pads the header to 64 bytes
+} MappedHeader;
+
+_Static_assert(sizeof(MappedHeader) == MAPPED_ARRAY_HEADER_SIZE, "MappedHeader must fill the header");
+
+// Structure to represent an open, mapped array file.
+struct MappedFile {
+    int fd;              // open file descriptor (holds an exclusive flock)
+    char *base;          // start of the mapping (the header)
+    size_t length;       // bytes mapped (the whole file)
+    size_t element_size; // size (in bytes) of each element
+};
+
+static const char MAPPED_MAGIC[8] = {'D', 'S', 'A', 'L', 'G', 'O', 'M', 'A'};
+
+// Helpers
+
+/**
+ * Helper function to compute the file length holding a given capacity.
+ *
+ * @param element_size size (in bytes) of each element
+ * @param capacity     number of elements
+ * @return the length in bytes
+ */
+static size_t fileLength(size_t element_size, int capacity) {
+    return MAPPED_ARRAY_HEADER_SIZE + element_size * (size_t)capacity;
+}
+
+/**
+ * Helper function to check a header read from an existing file.
+ *
+ * @param header       header at the start of the mapping
+ * @param element_size element size the caller expects
+ * @param file_size    length of the file in bytes
+ * @param path         file name used in error messages
+ * @return 0 if the header is valid; -1 otherwise
+ */
+static int checkHeader(const MappedHeader *header, size_t element_size, size_t file_size,
+                       const char *path) {
+    if (memcmp(header->magic, MAPPED_MAGIC, sizeof(MAPPED_MAGIC)) != 0) {
+        fprintf(stderr, "Error: %s is not a mapped array file\n", path);
+        return -1;
+    }
+    if (header->version != MAPPED_ARRAY_VERSION || header->header_size != MAPPED_ARRAY_HEADER_SIZE) {
+        fprintf(stderr, "Error: %s has unsupported format version %u\n", path, header->version);
+        return -1;
+    }
+    if (header->element_size != element_size) {
+        fprintf(stderr, "Error: %s holds %llu-byte elements, not %zu-byte elements\n", path,
+                (unsigned long long)header->element_size, element_size);
+        return -1;
+    }
+    if (header->capacity < 0 || header->capacity > INT_MAX || header->size < 0 ||
+        header->size > header->capacity ||
+        fileLength(element_size, (int)header->capacity) > file_size) {
+        fprintf(stderr, "Error: %s is corrupt\n", path);
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * Helper function to open or create a mapped array file and map it.
+ * A new (or empty) file gets a header and room for initial_capacity
+ * elements; an existing file is checked and mapped as it is.
+ *
+ * @param path             file to open or create
+ * @param element_size     size (in bytes) of each element
+ * @param initial_capacity capacity of a new file
+ * @param size             receives the number of elements stored
+ * @param capacity         receives the capacity of the file
+ * @return the open file, or NULL on error
+ */
+static struct MappedFile *mapOpen(const char *path, size_t element_size, int initial_capacity,
+                                  int *size, int *capacity) {
+    if (element_size == 0 || initial_capacity < 0 ||
+        (size_t)initial_capacity > (SIZE_MAX - MAPPED_ARRAY_HEADER_SIZE) / element_size) {
+        fprintf(stderr, "Error: Invalid mapped array size\n");
+        return NULL;
+    }
+
+    int fd = open(path, O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+        fprintf(stderr, "Error: cannot open %s\n", path);
+        return NULL;
+    }
+    if (flock(fd, LOCK_EX | LOCK_NB) != 0) {
+        fprintf(stderr, "Error: %s is already open\n", path);
+        close(fd);
+        return NULL;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        fprintf(stderr, "Error: cannot stat %s\n", path);
+        close(fd);
+        return NULL;
+    }
+
+    bool created = (st.st_size == 0);
+    size_t length = created ? fileLength(element_size, initial_capacity) : (size_t)st.st_size;
+    if (created) {
+        int err = posix_fallocate(fd, 0, (off_t)length);
+        if (err != 0) {
+            fprintf(stderr, "Error: cannot allocate %zu bytes for %s\n", length, path);
+            close(fd);
+            return NULL;
+        }
+    } else if (length < MAPPED_ARRAY_HEADER_SIZE) {
+        fprintf(stderr, "Error: %s is not a mapped array file\n", path);
+        close(fd);
+        return NULL;
+    }
+
+    char *base = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED) {
+        fprintf(stderr, "Error: cannot map %s\n", path);
+        close(fd);
+        return NULL;
+    }
+
+    MappedHeader *header = (MappedHeader *)base;
+    if (created) {
+        memset(header, 0, sizeof(*header));
+        memcpy(header->magic, MAPPED_MAGIC, sizeof(MAPPED_MAGIC));
+        header->version = MAPPED_ARRAY_VERSION;
+        header->header_size = MAPPED_ARRAY_HEADER_SIZE;
+        header->element_size = element_size;
+        header->size = 0;
+        header->capacity = initial_capacity;
+    } else if (checkHeader(header, element_size, length, path) != 0) {
+        munmap(base, length);
+        close(fd);
+        return NULL;
+    }
+
+    struct MappedFile *file = malloc(sizeof(*file));
+    if (file == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    file->fd = fd;
+    file->base = base;
+    file->length = length;
+    file->element_size = element_size;
+
+    *size = (int)header->size;
+    *capacity = (int)header->capacity;
+    return file;
+}
+
+/**
+ * Helper function to record the element count and flush the mapping and
+ * the file to disk.
+ *
+ * @param file open mapped file
+ * @param size number of elements stored
+ * @return 0 on success; -1 on error
+ */
+static int mapSync(struct MappedFile *file, int size) {
+    ((MappedHeader *)file->base)->size = size;
+    if (msync(file->base, file->length, MS_SYNC) != 0 || fsync(file->fd) != 0) {
+        fprintf(stderr, "Error: cannot sync mapped array\n");
+        return -1;
+    }
+    return 0;
+}
+
+// Opening and syncing
+
+/**
+ * Opens a dynamic array backed by a memory-mapped file.
+ * If the file is missing or empty it is created with room for
+ * initial_capacity elements; otherwise the array holds exactly the
+ * elements stored in it, without copying them. The growth policy starts
+ * as DA_GROWTH_DOUBLE. Free the array with daFree.
+ *
+ * @param arr              pointer to the DynamicArray to initialize
+ * @param path             file to open or create
+ * @param initial_capacity number of elements to make room for in a new file
+ * @return 0 on success; -1 on error (arr is left untouched)
+ */
+int daMapOpen(DynamicArray *arr, const char *path, int initial_capacity) {
+    int size, capacity;
+    struct MappedFile *file = mapOpen(path, sizeof(int), initial_capacity, &size, &capacity);
+    if (file == NULL) return -1;
+
+    arr->data = (int *)(file->base + MAPPED_ARRAY_HEADER_SIZE);
+    arr->size = size;
+    arr->capacity = capacity;
+    arr->growth = DA_GROWTH_DOUBLE;
+    arr->growth_increment = 0;
+    arr->mapping = file;
+    return 0;
+}
+
+/**
+ * Opens a generic array backed by a memory-mapped file.
+ * If the file is missing or empty it is created with room for
+ * initial_capacity elements; otherwise it must hold elements of
+ * element_size bytes, which the array then uses without copying them.
+ * Free the array with gaFree.
+ *
+ * @param arr              pointer to the GenericArray to initialize
+ * @param path             file to open or create
+ * @param element_size     size (in bytes) of each element stored in the array
+ * @param initial_capacity number of elements to make room for in a new file
+ * @return 0 on success; -1 on error (arr is left untouched)
+ */
+int gaMapOpen(GenericArray *arr, const char *path, size_t element_size, int initial_capacity) {
+    int size, capacity;
+    struct MappedFile *file = mapOpen(path, element_size, initial_capacity, &size, &capacity);
+    if (file == NULL) return -1;
+
+    arr->data = file->base + MAPPED_ARRAY_HEADER_SIZE;
+    arr->size = size;
+    arr->capacity = capacity;
+    arr->element_size = element_size;
+    arr->mapping = file;
+    return 0;
+}
+
+/**
+ * Writes the size of a mapped dynamic array to its header and waits until
+ * the header and the elements are on disk.
+ *
+ * @param arr pointer to a DynamicArray opened with daMapOpen
+ * @return 0 on success; -1 on error or if the array is not mapped
+ */
+int daMapSync(DynamicArray *arr) {
+    if (arr->mapping == NULL) {
+        fprintf(stderr, "Error: array is not memory-mapped\n");
+        return -1;
+    }
+    return mapSync(arr->mapping, arr->size);
+}
+
+/**
+ * Writes the size of a mapped generic array to its header and waits until
+ * the header and the elements are on disk.
+ *
+ * @param arr pointer to a GenericArray opened with gaMapOpen
+ * @return 0 on success; -1 on error or if the array is not mapped
+ */
+int gaMapSync(GenericArray *arr) {
+    if (arr->mapping == NULL) {
+        fprintf(stderr, "Error: array is not memory-mapped\n");
+        return -1;
+    }
+    return mapSync(arr->mapping, arr->size);
+}
+
+// Backing file
+
+/**
+ * Changes the capacity of a mapped file: the file is extended (or
+ * truncated) and remapped, and the header records the new capacity and
+ * size. The elements may move to a new address, like with realloc.
+ * Exits if the file cannot be resized, like a failed allocation.
+ *
+ * @param file         open mapped file
+ * @param new_capacity number of elements to make room for
+ * @param size         number of elements stored after the resize
+ * @return the new address of the first element
+ */
+void *mfResize(struct MappedFile *file, int new_capacity, int size) {
+    size_t length = fileLength(file->element_size, new_capacity);
+
+    if (length > file->length && posix_fallocate(file->fd, 0, (off_t)length) != 0) {
+        fprintf(stderr, "Error: cannot grow mapped array file\n");
+        exit(EXIT_FAILURE);
+    }
+
+#ifdef __linux__
+    char *base = mremap(file->base, file->length, length, MREMAP_MAYMOVE);
+#else
+    munmap(file->base, file->length);
+    char *base = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_SHARED, file->fd, 0);
+#endif
+    if (base == MAP_FAILED) {
+        fprintf(stderr, "Error: cannot remap mapped array file\n");
+        exit(EXIT_FAILURE);
+    }
+
+    if (length < file->length && ftruncate(file->fd, (off_t)length) != 0) {
+        fprintf(stderr, "Error: cannot shrink mapped array file\n");
+        exit(EXIT_FAILURE);
+    }
+
+    file->base = base;
+    file->length = length;
+
+    MappedHeader *header = (MappedHeader *)base;
+    header->capacity = new_capacity;
+    header->size = size;
+    return base + MAPPED_ARRAY_HEADER_SIZE;
+}
+
+/**
+ * Records the element count in the header, unmaps and closes a mapped
+ * file. The kernel writes the dirty pages back in the background; call
+ * daMapSync / gaMapSync first to wait for them.
+ *
+ * @param file open mapped file (freed by this call)
+ * @param size number of elements stored
+ */
+void mfClose(struct MappedFile *file, int size) {
+    ((MappedHeader *)file->base)->size = size;
+    munmap(file->base, file->length);
+    close(file->fd);
+    free(file);
+}
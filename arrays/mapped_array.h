@@ -0,0 +1,47 @@
+/**
+ * @file mapped_array.h
+ * @brief Public interface of the memory-mapped DynamicArray and GenericArray.
+ *
+ * daMapOpen and gaMapOpen back an array with a file instead of the heap.
+ * The file starts with a MAPPED_ARRAY_HEADER_SIZE-byte header (size,
+ * capacity, element_size and format version) followed by the elements
+ * exactly as they sit in memory, so reopening a file maps it back without
+ * copying or parsing anything: arr->data points straight into the mapping
+ * and can be handed to binarySearchIterative and the other raw-array
+ * functions as is. Every other da and ga function works unchanged; growth
+ * extends the file and remaps it, and daFree / gaFree unmap it.
+ *
+ * The element count is written to the header on every resize, on
+ * daMapSync / gaMapSync and on daFree / gaFree. Only the sync functions
+ * wait for the data to reach the disk. Elements are stored in native byte
+ * order, and a file can be open in one process at a time.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#ifndef MAPPED_ARRAY_H
+#define MAPPED_ARRAY_H
+
+#include <stddef.h>
+
+#include "dynamic_array.h"
+#include "generic_array.h"
+
+// Current version of the file format.
+#define MAPPED_ARRAY_VERSION 1
+
+// Bytes before the first element; keeps the elements cache-line aligned.
+#define MAPPED_ARRAY_HEADER_SIZE 64
+
+// Opening and syncing
+int daMapOpen(DynamicArray *arr, const char *path, int initial_capacity);
+int gaMapOpen(GenericArray *arr, const char *path, size_t element_size, int initial_capacity);
+int daMapSync(DynamicArray *arr);
+int gaMapSync(GenericArray *arr);
+
+// Backing file (used by the da and ga resize and free functions)
+void *mfResize(struct MappedFile *file, int new_capacity, int size);
+void mfClose(struct MappedFile *file, int size);
+
+#endif // MAPPED_ARRAY_H
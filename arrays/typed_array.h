@@ -0,0 +1,203 @@
+/**
+ * @file typed_array.h
+ * @brief Compile-time specialized dynamic array generated by a macro.
+ *
+ * DEFINE_ARRAY(Name, prefix, T) defines a struct Name holding elements of
+ * type T and the same operations as GenericArray, named prefix##Init,
+ * prefix##PushBack, ... Elements are passed and returned by value and the
+ * element size is sizeof(T), so every operation can be inlined and the
+ * copies compile to plain loads and stores like in DynamicArray.
+ *
+ * Example:
+ *     typedef struct { int64_t key; int64_t value; } Pair;
+ *     DEFINE_ARRAY(PairArray, pa, Pair)
+ *
+ *     PairArray arr;
+ *     paInit(&arr, 16);
+ *     paPushBack(&arr, (Pair){1, 2});
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#ifndef TYPED_ARRAY_H
+#define TYPED_ARRAY_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <limits.h>
+
+#define DEFINE_ARRAY(Name, prefix, T)                                              \
+                                                                                   \
+/* Structure to represent a dynamic array of T. */                                 \
+typedef struct {                                                                   \
+    T *data;      /* pointer to the contiguous block of T (capacity elements) */   \
+    int size;     /* number of elements currently stored */                        \
+    int capacity; /* total number of elements that can be stored before resizing */ \
+} Name;                                                                            \
+                                                                                   \
+/* Core Functions */                                                               \
+                                                                                   \
+static inline void prefix##Init(Name *arr, int initial_capacity) {                 \
+    arr->data = malloc(sizeof(T) * (size_t)initial_capacity);                      \
+    arr->size = 0;                                                                 \
+    arr->capacity = initial_capacity;                                              \
+                                                                                   \
+    if (arr->data == NULL && initial_capacity > 0) {                               \
+        fprintf(stderr, "Memory allocation failed\n");                             \
+        exit(EXIT_FAILURE);                                                        \
+    }                                                                              \
+}                                                                                  \
+                                                                                   \
+static inline void prefix##Free(Name *arr) {                                       \
+    free(arr->data);                                                               \
+    arr->data = NULL;                                                              \
+    arr->size = 0;                                                                 \
+    arr->capacity = 0;                                                             \
+}                                                                                  \
+                                                                                   \
+static inline void prefix##Resize(Name *arr, int new_capacity) {                   \
+    T *new_data = realloc(arr->data, sizeof(T) * (size_t)new_capacity);            \
+    if (new_data == NULL && new_capacity > 0) {                                    \
+        fprintf(stderr, "Memory allocation failed\n");                             \
+        exit(EXIT_FAILURE);                                                        \
+    }                                                                              \
+                                                                                   \
+    arr->data = new_data;                                                          \
+    arr->capacity = new_capacity;                                                  \
+    if (arr->size > new_capacity) {                                                \
+        arr->size = new_capacity;                                                  \
+    }                                                                              \
+}                                                                                  \
+                                                                                   \
+/* Grows the capacity by doubling until min_capacity elements fit. */              \
+static inline void prefix##EnsureCapacity(Name *arr, int min_capacity) {           \
+    if (min_capacity <= arr->capacity) return;                                     \
+                                                                                   \
+    long long new_capacity = arr->capacity > 0 ? arr->capacity : 1;                \
+    while (new_capacity < min_capacity) {                                          \
+        new_capacity *= 2;                                                         \
+    }                                                                              \
+    if (new_capacity > INT_MAX) new_capacity = INT_MAX;                            \
+                                                                                   \
+    prefix##Resize(arr, (int)new_capacity);                                        \
+}                                                                                  \
+                                                                                   \
+/* Element Insertion */                                                            \
+                                                                                   \
+static inline void prefix##PushBack(Name *arr, T element) {                        \
+    if (arr->size == arr->capacity) {                                              \
+        prefix##EnsureCapacity(arr, arr->size + 1);                                \
+    }                                                                              \
+                                                                                   \
+    arr->data[arr->size++] = element;                                              \
+}                                                                                  \
+                                                                                   \
+static inline void prefix##InsertAt(Name *arr, int index, T element) {             \
+    if (index < 0 || index > arr->size) {                                          \
+        fprintf(stderr, "Error: Invalid index");                                   \
+        exit(EXIT_FAILURE);                                                        \
+    }                                                                              \
+                                                                                   \
+    prefix##EnsureCapacity(arr, arr->size + 1);                                    \
+    memmove(arr->data + index + 1, arr->data + index,                              \
+            sizeof(T) * (size_t)(arr->size - index));                              \
+    arr->data[index] = element;                                                    \
+    arr->size++;                                                                   \
+}                                                                                  \
+                                                                                   \
+static inline void prefix##InsertRangeAt(Name *arr, int index,                     \
+                                         const T *elements, int count) {           \
+    if (index < 0 || index > arr->size || count < 0 || count > INT_MAX - arr->size) { \
+        fprintf(stderr, "Error: Invalid index");                                   \
+        exit(EXIT_FAILURE);                                                        \
+    }                                                                              \
+                                                                                   \
+    if (count == 0) return;                                                        \
+    prefix##EnsureCapacity(arr, arr->size + count);                                \
+    memmove(arr->data + index + count, arr->data + index,                          \
+            sizeof(T) * (size_t)(arr->size - index));                              \
+    memcpy(arr->data + index, elements, sizeof(T) * (size_t)count);                \
+    arr->size += count;                                                            \
+}                                                                                  \
+                                                                                   \
+/* Element Deletion */                                                             \
+                                                                                   \
+static inline T prefix##PopBack(Name *arr) {                                       \
+    if (arr->size == 0) {                                                          \
+        fprintf(stderr, "Error: popBack on empty array\n");                        \
+        exit(EXIT_FAILURE);                                                        \
+    }                                                                              \
+                                                                                   \
+    return arr->data[--arr->size];                                                 \
+}                                                                                  \
+                                                                                   \
+static inline void prefix##RemoveAt(Name *arr, int index) {                        \
+    if (index < 0 || index >= arr->size) {                                         \
+        fprintf(stderr, "Error: Invalid index");                                   \
+        exit(EXIT_FAILURE);                                                        \
+    }                                                                              \
+                                                                                   \
+    memmove(arr->data + index, arr->data + index + 1,                              \
+            sizeof(T) * (size_t)(arr->size - index - 1));                          \
+    arr->size--;                                                                   \
+}                                                                                  \
+                                                                                   \
+static inline void prefix##RemoveRange(Name *arr, int index, int count) {          \
+    if (index < 0 || count < 0 || index > arr->size - count) {                     \
+        fprintf(stderr, "Error: Invalid index");                                   \
+        exit(EXIT_FAILURE);                                                        \
+    }                                                                              \
+                                                                                   \
+    memmove(arr->data + index, arr->data + index + count,                          \
+            sizeof(T) * (size_t)(arr->size - index - count));                      \
+    arr->size -= count;                                                            \
+}                                                                                  \
+                                                                                   \
+/* Access/Utility */                                                               \
+                                                                                   \
+static inline T prefix##Get(Name *arr, int index) {                                \
+    if (index < 0 || index >= arr->size) {                                         \
+        fprintf(stderr, "Error: Invalid index");                                   \
+        exit(EXIT_FAILURE);                                                        \
+    }                                                                              \
+                                                                                   \
+    return arr->data[index];                                                       \
+}                                                                                  \
+                                                                                   \
+static inline void prefix##Set(Name *arr, int index, T element) {                  \
+    if (index < 0 || index >= arr->size) {                                         \
+        fprintf(stderr, "Error: Invalid index");                                   \
+        exit(EXIT_FAILURE);                                                        \
+    }                                                                              \
+                                                                                   \
+    arr->data[index] = element;                                                    \
+}                                                                                  \
+                                                                                   \
+static inline int prefix##Size(Name *arr) {                                        \
+    return arr->size;                                                              \
+}                                                                                  \
+                                                                                   \
+static inline bool prefix##IsEmpty(Name *arr) {                                    \
+    return (arr->size == 0);                                                       \
+}                                                                                  \
+                                                                                   \
+static inline void prefix##Print(Name *arr, void (*printFunc)(T)) {                \
+    if (prefix##IsEmpty(arr)) {                                                    \
+        printf("[]\n");                                                            \
+        return;                                                                    \
+    }                                                                              \
+                                                                                   \
+    printf("[");                                                                   \
+    for (int i = 0; i < arr->size; i++) {                                          \
+        printFunc(arr->data[i]);                                                   \
+        if (i < arr->size - 1) {                                                   \
+            printf(", ");                                                          \
+        }                                                                          \
+    }                                                                              \
+    printf("]\n");                                                                 \
+}
+
+#endif // TYPED_ARRAY_H
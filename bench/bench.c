@@ -0,0 +1,192 @@
+/**
+ * @file bench.c
+ * @brief Benchmark driver and harness implementation.
+ *
+ * Usage: bench [--scale=F] [group ...]
+ * Runs every group, or only the named ones. --scale multiplies the
+ * workload size of every group (default 1.0).
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "bench.h"
+
+volatile long benchSink;
+
+static double scale = 1.0;
+static uint64_t rng_state = 0x9E3779B97F4A7C15ULL;
+
+// Structure to represent a named benchmark group.
+typedef struct {
+    const char *name;  // name used on the command line to select the group
+    void (*run)(void); // function that runs and reports every operation of the group
+} BenchGroup;
+
+static const BenchGroup groups[] = {
+    {"dynamic_array",      benchDynamicArray},
+    {"dynamic_array_growth", benchDynamicArrayGrowth},
+    {"dynamic_array_scan", benchDynamicArrayScan},
+    {"mapped_array",       benchMappedArray},
+    {"generic_array",      benchGenericArray},
+    {"generic_array_shift", benchGenericArrayShift},
+    {"typed_array",        benchTypedArray},
+    {"linked_list",        benchLinkedList},
+    {"linked_list_stress", benchLinkedListStress},
+    {"doubly_linked_list", benchDoublyLinkedList},
+    {"node_pool",          benchNodePool},
+    {"unrolled_list",      benchUnrolledList},
+    {"list_search",        benchListSearch},
+    {"binary_search",      benchBinarySearch},
+    {"search_kernels",     benchSearchKernels},
+    {"search_index",       benchSearchIndex},
+    {"batch_search",       benchBatchSearch},
+    {"search_distributions", benchSearchDistributions},
+    {"learned_index",      benchLearnedIndex},
+    {"sort",               benchSort},
+    {"parallel_sort",      benchParallelSort},
+    {"external_sort",      benchExternalSort},
+    {"snapshot",           benchSnapshot},
+    {"format",             benchFormat},
+    {"lock_free",          benchLockFree},
+    {"hash_map",           benchHashMap},
+    {"concurrent_hash_map", benchConcurrentHashMap},
+    {"priority_queue",     benchPriorityQueue},
+    {"min_queue",          benchMinQueue},
+    {"bplus_tree",         benchBPlusTree},
+};
+
+// Harness
+
+/**
+ * Returns the current value of a monotonic clock.
+ *
+ * @return seconds since an arbitrary fixed point
+ */
+double benchNow(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/**
+ * Scales a group's base workload size by the --scale factor.
+ *
+ * @param base workload size at scale 1.0
+ * @return the scaled workload size (at least 1)
+ */
+long benchSize(long base) {
+    long n = (long)(base * scale);
+    return n < 1 ? 1 : n;
+}
+
+/**
+ * Prints one result row: total operations, ns per operation and Mops/s.
+ *
+ * @param group   name of the benchmark group
+ * @param op      name of the timed operation
+ * @param ops     number of operations performed
+ * @param seconds elapsed wall-clock time
+ */
+void benchReport(const char *group, const char *op, long ops, double seconds) {
+    double ns_per_op = seconds * 1e9 / (double)ops;
+    double mops = (double)ops / seconds / 1e6;
+    printf("%-20s %-40s %12ld ops %10.2f ns/op %10.2f Mops/s\n",
+           group, op, ops, ns_per_op, mops);
+}
+
+/**
+ * Prints a free-form line (sizes, byte counts, ...) under a group.
+ *
+ * @param group name of the benchmark group
+ * @param fmt   printf-style format string
+ */
+void benchNote(const char *group, const char *fmt, ...) {
+    va_list args;
+    printf("%-20s ", group);
+    va_start(args, fmt);
+    vprintf(fmt, args);
+    va_end(args);
+    printf("\n");
+}
+
+/**
+ * Builds the path of a scratch file for a group that works on files.
+ * The file lives in $TMPDIR (or /tmp) and its name includes the process
+ * id, so concurrent runs do not collide. The caller removes it.
+ *
+ * @param path   receives the path
+ * @param size   the size of path
+ * @param suffix distinguishes the files of one group
+ */
+void benchTempPath(char *path, size_t size, const char *suffix) {
+    const char *dir = getenv("TMPDIR");
+    snprintf(path, size, "%s/dsalgo_bench_%ld_%s.bin", dir != NULL ? dir : "/tmp", (long)getpid(), suffix);
+}
+
+// Random numbers
+
+/**
+ * Returns the next value of the shared xorshift64 generator.
+ *
+ * @return a pseudo-random 64-bit value
+ */
+uint64_t benchRand(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+/**
+ * Resets the shared generator so every group sees the same sequence.
+ *
+ * @param seed non-zero seed value
+ */
+void benchSeed(uint64_t seed) {
+    rng_state = seed ? seed : 0x9E3779B97F4A7C15ULL;
+}
+
+int main(int argc, char *argv[]) {
+    int num_groups = sizeof(groups) / sizeof(groups[0]);
+    int selected = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strncmp(argv[i], "--scale=", 8) == 0) {
+            scale = atof(argv[i] + 8);
+        } else {
+            bool known = false;
+            for (int g = 0; g < num_groups && !known; g++) {
+                known = (strcmp(argv[i], groups[g].name) == 0);
+            }
+            if (!known) {
+                fprintf(stderr, "Error: unknown benchmark group '%s'; valid groups:\n", argv[i]);
+                for (int g = 0; g < num_groups; g++) {
+                    fprintf(stderr, "  %s\n", groups[g].name);
+                }
+                return EXIT_FAILURE;
+            }
+            selected++;
+        }
+    }
+
+    for (int g = 0; g < num_groups; g++) {
+        bool run = (selected == 0);
+        for (int i = 1; i < argc && !run; i++) {
+            run = (strcmp(argv[i], groups[g].name) == 0);
+        }
+        if (!run) continue;
+
+        benchSeed(0);
+        groups[g].run();
+    }
+
+    return 0;
+}
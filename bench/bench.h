@@ -0,0 +1,66 @@
+/**
+ * @file bench.h
+ * @brief Shared harness used by every benchmark group.
+ *
+ * Each group times the hot operations of one structure with the same
+ * clock, the same workload sizes and the same report format so that
+ * throughput can be compared across containers.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Sink that benchmark loops write results into so the compiler keeps them.
+extern volatile long benchSink;
+
+// Harness
+double benchNow(void);
+long benchSize(long base);
+void benchReport(const char *group, const char *op, long ops, double seconds);
+void benchNote(const char *group, const char *fmt, ...);
+void benchTempPath(char *path, size_t size, const char *suffix);
+
+// Random numbers (xorshift64, deterministic across runs)
+uint64_t benchRand(void);
+void benchSeed(uint64_t seed);
+
+// Benchmark groups
+void benchDynamicArray(void);
+void benchDynamicArrayGrowth(void);
+void benchDynamicArrayScan(void);
+void benchMappedArray(void);
+void benchGenericArray(void);
+void benchGenericArrayShift(void);
+void benchTypedArray(void);
+void benchLinkedList(void);
+void benchLinkedListStress(void);
+void benchDoublyLinkedList(void);
+void benchNodePool(void);
+void benchUnrolledList(void);
+void benchListSearch(void);
+void benchBinarySearch(void);
+void benchSearchKernels(void);
+void benchSearchIndex(void);
+void benchBatchSearch(void);
+void benchSearchDistributions(void);
+void benchLearnedIndex(void);
+void benchSort(void);
+void benchParallelSort(void);
+void benchExternalSort(void);
+void benchSnapshot(void);
+void benchFormat(void);
+void benchLockFree(void);
+void benchHashMap(void);
+void benchConcurrentHashMap(void);
+void benchPriorityQueue(void);
+void benchMinQueue(void);
+void benchBPlusTree(void);
+
+#endif // BENCH_H
@@ -0,0 +1,523 @@
+/**
+ * @file bench_arrays.c
+ * @brief Benchmarks of the DynamicArray and GenericArray hot operations.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "bench.h"
+#include "arrays/dynamic_array.h"
+#include "arrays/dynamic_array_scan.h"
+#include "arrays/generic_array.h"
+#include "arrays/mapped_array.h"
+#include "arrays/typed_array.h"
+#include "searching_sorting/binary_search.h"
+
+// Structure to represent a 16-byte record.
+typedef struct {
+    int64_t key;   // record key
+    int64_t value; // record payload
+} Record16;
+
+DEFINE_ARRAY(Int64Array, i64a, int64_t)
+DEFINE_ARRAY(Record16Array, r16a, Record16)
+
+/**
+ * Times pushBack, random get, popBack and front insertAt on a DynamicArray.
+ */
+void benchDynamicArray(void) {
+    const char *group = "dynamic_array";
+    long n = benchSize(1000000);
+    long shift_n = benchSize(20000);
+    DynamicArray arr;
+    double start;
+
+    daInit(&arr, 1);
+    start = benchNow();
+    for (long i = 0; i < n; i++) {
+        daPushBack(&arr, (int)i);
+    }
+    benchReport(group, "pushBack", n, benchNow() - start);
+
+    long sum = 0;
+    start = benchNow();
+    for (long i = 0; i < n; i++) {
+        sum += daGet(&arr, (int)(benchRand() % (uint64_t)n));
+    }
+    benchReport(group, "get (random)", n, benchNow() - start);
+    benchSink = sum;
+
+    start = benchNow();
+    for (long i = 0; i < n; i++) {
+        sum += daPopBack(&arr);
+    }
+    benchReport(group, "popBack", n, benchNow() - start);
+    benchSink = sum;
+
+    start = benchNow();
+    for (long i = 0; i < shift_n; i++) {
+        daInsertAt(&arr, 0, (int)i);
+    }
+    benchReport(group, "insertAt (front)", shift_n, benchNow() - start);
+
+    start = benchNow();
+    for (long i = 0; i < shift_n; i++) {
+        daRemoveAt(&arr, 0);
+    }
+    benchReport(group, "removeAt (front)", shift_n, benchNow() - start);
+
+    daFree(&arr);
+}
+
+/**
+ * Appends the same number of elements under each growth policy and reports
+ * how many bytes had to be moved because realloc could not grow in place
+ * (an upper bound: large blocks may be remapped rather than copied),
+ * next to the bytes a malloc-and-copy resize would have copied.
+ */
+void benchDynamicArrayGrowth(void) {
+    const char *group = "dynamic_array_growth";
+    long n = benchSize(1000000);
+    struct {
+        const char *name;
+        DaGrowthPolicy policy;
+        int increment;
+    } policies[] = {
+        {"pushBack (2x)",          DA_GROWTH_DOUBLE,   0},
+        {"pushBack (1.5x)",        DA_GROWTH_ONE_HALF, 0},
+        {"pushBack (+65536)",      DA_GROWTH_FIXED,    65536},
+    };
+    int num_policies = sizeof(policies) / sizeof(policies[0]);
+
+    for (int p = 0; p < num_policies; p++) {
+        DynamicArray arr;
+        long resizes = 0;
+        double moved_bytes = 0;
+        double copy_bytes = 0;
+
+        daInit(&arr, 1);
+        daSetGrowthPolicy(&arr, policies[p].policy, policies[p].increment);
+
+        double start = benchNow();
+        for (long i = 0; i < n; i++) {
+            if (arr.size == arr.capacity) {
+                int *old_data = arr.data;
+                daPushBack(&arr, (int)i);
+                resizes++;
+                copy_bytes += (double)(arr.size - 1) * sizeof(int);
+                if (arr.data != old_data) {
+                    moved_bytes += (double)(arr.size - 1) * sizeof(int);
+                }
+            } else {
+                daPushBack(&arr, (int)i);
+            }
+        }
+        benchReport(group, policies[p].name, n, benchNow() - start);
+        benchNote(group, "  %ld resizes, %.1f MB moved per 1M pushBack "
+                  "(malloc+copy resize: %.1f MB)", resizes,
+                  moved_bytes / n * 1e6 / 1e6, copy_bytes / n * 1e6 / 1e6);
+
+        daFree(&arr);
+    }
+}
+
+/**
+ * Times every DynamicArray scan at each kernel level the CPU supports on
+ * 16M random ints and reports the bandwidth reached. Aborts if a level
+ * returns a different result than the scalar reference.
+ */
+void benchDynamicArrayScan(void) {
+    const char *group = "dynamic_array_scan";
+    long n = benchSize(16L << 20);
+    int repeats = 5;
+    const char *level_names[] = {"scalar", "sse2", "avx2"};
+    DaScanLevel best = daScanGetLevel();
+    DynamicArray arr;
+    char name[64];
+
+    daInit(&arr, (int)n);
+    for (long i = 0; i < n; i++) {
+        daPushBack(&arr, (int)(benchRand() % 2000001) - 1000000);
+    }
+
+    int reference_find = 0, reference_count = 0, reference_min = 0, reference_max = 0;
+    long long reference_sum = 0;
+    DynamicArray reference_filter;
+
+    for (int level = DA_SCAN_SCALAR; level <= (int)best; level++) {
+        int found = 0, count = 0, min = 0, max = 0;
+        long long sum = 0;
+        DynamicArray filtered;
+        double start, elapsed;
+
+        daScanSetLevel((DaScanLevel)level);
+
+        // The target is out of range, so find scans the whole array.
+        start = benchNow();
+        for (int r = 0; r < repeats; r++) found = daFind(&arr, 2000000);
+        elapsed = benchNow() - start;
+        snprintf(name, sizeof(name), "find (%s)", level_names[level]);
+        benchReport(group, name, n * repeats, elapsed);
+        benchNote(group, "  %.2f GB/s", n * repeats * sizeof(int) / elapsed / 1e9);
+
+        start = benchNow();
+        for (int r = 0; r < repeats; r++) count = daCount(&arr, 42);
+        elapsed = benchNow() - start;
+        snprintf(name, sizeof(name), "count (%s)", level_names[level]);
+        benchReport(group, name, n * repeats, elapsed);
+        benchNote(group, "  %.2f GB/s", n * repeats * sizeof(int) / elapsed / 1e9);
+
+        start = benchNow();
+        for (int r = 0; r < repeats; r++) daMinMax(&arr, &min, &max);
+        elapsed = benchNow() - start;
+        snprintf(name, sizeof(name), "minMax (%s)", level_names[level]);
+        benchReport(group, name, n * repeats, elapsed);
+        benchNote(group, "  %.2f GB/s", n * repeats * sizeof(int) / elapsed / 1e9);
+
+        start = benchNow();
+        for (int r = 0; r < repeats; r++) sum = daSum(&arr);
+        elapsed = benchNow() - start;
+        snprintf(name, sizeof(name), "sum (%s)", level_names[level]);
+        benchReport(group, name, n * repeats, elapsed);
+        benchNote(group, "  %.2f GB/s", n * repeats * sizeof(int) / elapsed / 1e9);
+
+        // About half of the elements pass the filter.
+        start = benchNow();
+        daFilter(&arr, DA_CMP_LT, 0, &filtered);
+        elapsed = benchNow() - start;
+        snprintf(name, sizeof(name), "filter < 0 (%s)", level_names[level]);
+        benchReport(group, name, n, elapsed);
+        benchNote(group, "  %.2f GB/s", n * sizeof(int) / elapsed / 1e9);
+
+        if (level == DA_SCAN_SCALAR) {
+            reference_find = found;
+            reference_count = count;
+            reference_min = min;
+            reference_max = max;
+            reference_sum = sum;
+            reference_filter = filtered;
+            continue;
+        }
+
+        bool same = found == reference_find && count == reference_count &&
+                    min == reference_min && max == reference_max && sum == reference_sum &&
+                    filtered.size == reference_filter.size;
+        for (int i = 0; same && i < filtered.size; i++) {
+            same = filtered.data[i] == reference_filter.data[i];
+        }
+        if (!same) {
+            fprintf(stderr, "Error: %s scan differs from the scalar reference\n", level_names[level]);
+            exit(EXIT_FAILURE);
+        }
+        daFree(&filtered);
+    }
+
+    benchSink = reference_count + (long)reference_sum;
+    daScanSetLevel(best);
+    daFree(&reference_filter);
+    daFree(&arr);
+}
+
+/**
+ * Compares the startup paths of a sorted DynamicArray: rebuilding it on
+ * the heap with pushBack, filling a mapped file once, and reopening the
+ * file (zero-copy). Then times binarySearchIterative run directly on the
+ * mapped elements against the heap copy. Aborts if the reopened array or
+ * any search result differs from the heap array.
+ */
+void benchMappedArray(void) {
+    const char *group = "mapped_array";
+    long n = benchSize(16L << 20);
+    long lookups = benchSize(1000000);
+    int reopens = 100;
+    char path[256];
+    DynamicArray heap, mapped;
+    double start, elapsed, rebuild;
+
+    benchTempPath(path, sizeof(path), "mapped");
+    remove(path);
+
+    start = benchNow();
+    daInit(&heap, 1);
+    for (long i = 0; i < n; i++) {
+        daPushBack(&heap, (int)(i * 3));
+    }
+    rebuild = benchNow() - start;
+    benchReport(group, "rebuild on heap (pushBack)", n, rebuild);
+
+    start = benchNow();
+    if (daMapOpen(&mapped, path, 1) != 0) exit(EXIT_FAILURE);
+    for (long i = 0; i < n; i++) {
+        daPushBack(&mapped, (int)(i * 3));
+    }
+    daFree(&mapped);
+    benchReport(group, "fill new file (pushBack)", n, benchNow() - start);
+
+    start = benchNow();
+    for (int r = 0; r < reopens; r++) {
+        if (daMapOpen(&mapped, path, 0) != 0) exit(EXIT_FAILURE);
+        benchSink = mapped.data[mapped.size - 1];
+        daFree(&mapped);
+    }
+    elapsed = benchNow() - start;
+    benchReport(group, "reopen file", reopens, elapsed);
+    benchNote(group, "  %.0fx faster than the rebuild", rebuild / (elapsed / reopens));
+
+    if (daMapOpen(&mapped, path, 0) != 0) exit(EXIT_FAILURE);
+    if (mapped.size != heap.size || memcmp(mapped.data, heap.data, (size_t)n * sizeof(int)) != 0) {
+        fprintf(stderr, "Error: reopened mapped array differs from the heap array\n");
+        exit(EXIT_FAILURE);
+    }
+
+    int *targets = malloc(sizeof(int) * (size_t)lookups);
+    if (targets == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    for (long i = 0; i < lookups; i++) {
+        targets[i] = (int)(benchRand() % (uint64_t)(n * 3));
+    }
+
+    long heap_found = 0, mapped_found = 0;
+    start = benchNow();
+    for (long i = 0; i < lookups; i++) {
+        heap_found += binarySearchIterative(heap.data, heap.size, targets[i]);
+    }
+    benchReport(group, "binarySearchIterative (heap)", lookups, benchNow() - start);
+
+    start = benchNow();
+    for (long i = 0; i < lookups; i++) {
+        mapped_found += binarySearchIterative(mapped.data, mapped.size, targets[i]);
+    }
+    benchReport(group, "binarySearchIterative (mapped)", lookups, benchNow() - start);
+
+    if (heap_found != mapped_found) {
+        fprintf(stderr, "Error: search on the mapped array differs from the heap array\n");
+        exit(EXIT_FAILURE);
+    }
+    benchSink = mapped_found;
+
+    start = benchNow();
+    daMapSync(&mapped);
+    benchReport(group, "daMapSync", 1, benchNow() - start);
+
+    free(targets);
+    daFree(&mapped);
+    daFree(&heap);
+    remove(path);
+}
+
+/**
+ * Times the same operations as benchDynamicArray on a GenericArray of ints.
+ */
+void benchGenericArray(void) {
+    const char *group = "generic_array";
+    long n = benchSize(1000000);
+    long shift_n = benchSize(20000);
+    GenericArray arr;
+    double start;
+    int value;
+
+    gaInit(&arr, sizeof(int), 1);
+    start = benchNow();
+    for (long i = 0; i < n; i++) {
+        value = (int)i;
+        gaPushBack(&arr, &value);
+    }
+    benchReport(group, "pushBack", n, benchNow() - start);
+
+    long sum = 0;
+    start = benchNow();
+    for (long i = 0; i < n; i++) {
+        gaGet(&arr, (int)(benchRand() % (uint64_t)n), &value);
+        sum += value;
+    }
+    benchReport(group, "get (random)", n, benchNow() - start);
+    benchSink = sum;
+
+    start = benchNow();
+    for (long i = 0; i < n; i++) {
+        gaPopBack(&arr, &value);
+        sum += value;
+    }
+    benchReport(group, "popBack", n, benchNow() - start);
+    benchSink = sum;
+
+    start = benchNow();
+    for (long i = 0; i < shift_n; i++) {
+        value = (int)i;
+        gaInsertAt(&arr, 0, &value);
+    }
+    benchReport(group, "insertAt (front)", shift_n, benchNow() - start);
+
+    start = benchNow();
+    for (long i = 0; i < shift_n; i++) {
+        gaRemoveAt(&arr, 0);
+    }
+    benchReport(group, "removeAt (front)", shift_n, benchNow() - start);
+
+    gaFree(&arr);
+}
+
+/**
+ * Times front insertAt/removeAt and batched insertRangeAt/removeRange on
+ * GenericArrays of 1, 8, 64 and 512 byte elements holding the same count.
+ */
+void benchGenericArrayShift(void) {
+    const char *group = "generic_array_shift";
+    size_t element_sizes[] = {1, 8, 64, 512};
+    int num_sizes = sizeof(element_sizes) / sizeof(element_sizes[0]);
+    long n = benchSize(10000);
+    long ops = benchSize(500);
+    int batch = 16;
+    char name[64];
+
+    for (int e = 0; e < num_sizes; e++) {
+        size_t element_size = element_sizes[e];
+        char *elements = calloc(batch, element_size);
+        GenericArray arr;
+        double start;
+
+        if (elements == NULL) {
+            fprintf(stderr, "Memory allocation failed\n");
+            exit(EXIT_FAILURE);
+        }
+
+        gaInit(&arr, element_size, 1);
+        for (long i = 0; i < n; i++) {
+            gaPushBack(&arr, elements);
+        }
+
+        start = benchNow();
+        for (long i = 0; i < ops; i++) {
+            gaInsertAt(&arr, 0, elements);
+        }
+        snprintf(name, sizeof(name), "insertAt (front, %zuB)", element_size);
+        benchReport(group, name, ops, benchNow() - start);
+
+        start = benchNow();
+        for (long i = 0; i < ops; i++) {
+            gaRemoveAt(&arr, 0);
+        }
+        snprintf(name, sizeof(name), "removeAt (front, %zuB)", element_size);
+        benchReport(group, name, ops, benchNow() - start);
+
+        start = benchNow();
+        for (long i = 0; i < ops / batch; i++) {
+            gaInsertRangeAt(&arr, 0, elements, batch);
+        }
+        snprintf(name, sizeof(name), "insertRangeAt x%d (front, %zuB)", batch, element_size);
+        benchReport(group, name, ops / batch * batch, benchNow() - start);
+
+        start = benchNow();
+        for (long i = 0; i < ops / batch; i++) {
+            gaRemoveRange(&arr, 0, batch);
+        }
+        snprintf(name, sizeof(name), "removeRange x%d (front, %zuB)", batch, element_size);
+        benchReport(group, name, ops / batch * batch, benchNow() - start);
+
+        gaFree(&arr);
+        free(elements);
+    }
+}
+
+/**
+ * Times pushBack, random get and a sequential get/sum pass on 8-byte and
+ * 16-byte records, stored in a GenericArray and in DEFINE_ARRAY arrays.
+ */
+void benchTypedArray(void) {
+    const char *group = "typed_array";
+    long n = benchSize(1000000);
+    double start;
+    int64_t sum = 0;
+
+    GenericArray g8, g16;
+    Int64Array t8;
+    Record16Array t16;
+    gaInit(&g8, sizeof(int64_t), 1);
+    gaInit(&g16, sizeof(Record16), 1);
+    i64aInit(&t8, 1);
+    r16aInit(&t16, 1);
+
+    start = benchNow();
+    for (long i = 0; i < n; i++) {
+        int64_t v = i;
+        gaPushBack(&g8, &v);
+    }
+    benchReport(group, "pushBack (generic, 8B)", n, benchNow() - start);
+
+    start = benchNow();
+    for (long i = 0; i < n; i++) {
+        i64aPushBack(&t8, i);
+    }
+    benchReport(group, "pushBack (typed, 8B)", n, benchNow() - start);
+
+    start = benchNow();
+    for (long i = 0; i < n; i++) {
+        Record16 r = {i, -i};
+        gaPushBack(&g16, &r);
+    }
+    benchReport(group, "pushBack (generic, 16B)", n, benchNow() - start);
+
+    start = benchNow();
+    for (long i = 0; i < n; i++) {
+        r16aPushBack(&t16, (Record16){i, -i});
+    }
+    benchReport(group, "pushBack (typed, 16B)", n, benchNow() - start);
+
+    benchSeed(1);
+    start = benchNow();
+    for (long i = 0; i < n; i++) {
+        int64_t v;
+        gaGet(&g8, (int)(benchRand() % (uint64_t)n), &v);
+        sum += v;
+    }
+    benchReport(group, "get (generic, 8B, random)", n, benchNow() - start);
+
+    benchSeed(1);
+    start = benchNow();
+    for (long i = 0; i < n; i++) {
+        sum += i64aGet(&t8, (int)(benchRand() % (uint64_t)n));
+    }
+    benchReport(group, "get (typed, 8B, random)", n, benchNow() - start);
+
+    start = benchNow();
+    for (long i = 0; i < n; i++) {
+        int64_t v;
+        gaGet(&g8, (int)i, &v);
+        sum += v;
+    }
+    benchReport(group, "get (generic, 8B, sum)", n, benchNow() - start);
+
+    start = benchNow();
+    for (long i = 0; i < n; i++) {
+        sum += i64aGet(&t8, (int)i);
+    }
+    benchReport(group, "get (typed, 8B, sum)", n, benchNow() - start);
+
+    start = benchNow();
+    for (long i = 0; i < n; i++) {
+        Record16 r;
+        gaGet(&g16, (int)i, &r);
+        sum += r.value;
+    }
+    benchReport(group, "get (generic, 16B, sum)", n, benchNow() - start);
+
+    start = benchNow();
+    for (long i = 0; i < n; i++) {
+        sum += r16aGet(&t16, (int)i).value;
+    }
+    benchReport(group, "get (typed, 16B, sum)", n, benchNow() - start);
+    benchSink = (long)sum;
+
+    gaFree(&g8);
+    gaFree(&g16);
+    i64aFree(&t8);
+    r16aFree(&t16);
+}
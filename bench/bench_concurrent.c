@@ -0,0 +1,404 @@
+/**
+ * @file bench_concurrent.c
+ * @brief Benchmarks of the concurrent containers under many threads.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+
+#include "bench.h"
+#include "linked_lists/doubly_linked_list.h"
+#include "stacks_queues/lock_free.h"
+#include "stacks_queues/hazard_pointer.h"
+#include "hash_tables/hash_map.h"
+#include "hash_tables/concurrent_hash_map.h"
+
+// Largest thread count a group runs with.
+#define MAX_THREADS 64
+
+// Structure to represent the start line the workers of one timed run wait at.
+typedef struct {
+    pthread_barrier_t barrier;  // releases the workers once the timer has started
+    atomic_int ready;           // workers waiting at the barrier
+} StartLine;
+
+// Containers a lock_free worker can hammer.
+typedef enum {
+    CONTAINER_LOCK_FREE_STACK,
+    CONTAINER_LOCK_FREE_QUEUE,
+    CONTAINER_MUTEX_STACK,
+    CONTAINER_MUTEX_QUEUE
+} ContainerKind;
+
+// Structure to represent the shared state of one lock_free run.
+typedef struct {
+    ContainerKind kind;         // which container the workers use
+    LockFreeStack stack;        // used by CONTAINER_LOCK_FREE_STACK
+    LockFreeQueue queue;        // used by CONTAINER_LOCK_FREE_QUEUE
+    DoublyLinkedList list;      // used by the mutex containers
+    pthread_mutex_t lock;       // guards list
+    StartLine *start;           // where the workers wait for the timer
+    long pairs_per_thread;      // push/pop pairs each worker performs
+} ConcurrentRun;
+
+// Structure to represent one lock_free worker thread.
+typedef struct {
+    ConcurrentRun *run;         // shared state
+    int id;                     // worker index, used to make the pushed values unique
+    long pushed;                // sum of the values this worker pushed
+    long popped;                // sum of the values this worker popped
+} ConcurrentWorker;
+
+// Structure to represent the shared state of one concurrent_hash_map run.
+typedef struct {
+    bool sharded;               // ConcurrentHashMap if true, else HashMap behind one mutex
+    ConcurrentHashMap *map;     // the sharded map
+    HashMap *locked;            // the mutex-wrapped map
+    pthread_mutex_t lock;       // guards locked
+    StartLine *start;           // where the workers wait for the timer
+    int read_percent;           // share of lookups; the rest is half inserts, half erases
+    int key_range;              // keys are drawn from [0, key_range)
+    long ops_per_thread;        // operations each worker performs
+} MapRun;
+
+// Structure to represent one concurrent_hash_map worker thread.
+typedef struct {
+    MapRun *run;                // shared state
+    uint64_t seed;              // private xorshift64 state
+    long hits;                  // lookups that found their key
+} MapWorker;
+
+// Helpers
+
+/**
+ * Helper function called by a worker to wait until the timer has started.
+ *
+ * @param start the run's start line
+ */
+static void waitAtStart(StartLine *start) {
+    atomic_fetch_add(&start->ready, 1);
+    pthread_barrier_wait(&start->barrier);
+}
+
+/**
+ * Helper function to run one worker function per thread and time them
+ * from the common start to the last join.
+ *
+ * @param threads     number of worker threads
+ * @param start       the start line the workers call waitAtStart on
+ * @param worker      the thread function
+ * @param args        array of threads worker arguments
+ * @param arg_size    size (in bytes) of one argument
+ * @return elapsed seconds
+ */
+static double timeThreads(int threads, StartLine *start, void *(*worker)(void *), void *args, size_t arg_size) {
+    pthread_t handles[MAX_THREADS];
+
+    pthread_barrier_init(&start->barrier, NULL, (unsigned)threads + 1);
+    atomic_init(&start->ready, 0);
+    for (int t = 0; t < threads; t++) {
+        if (pthread_create(&handles[t], NULL, worker, (char *)args + (size_t)t * arg_size) != 0) {
+            fprintf(stderr, "Error: cannot create thread\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    // Read the clock before the release: with fewer cores than threads the
+    // workers may run to completion before this thread is scheduled again.
+    while (atomic_load(&start->ready) < threads) sched_yield();
+    double begin = benchNow();
+    pthread_barrier_wait(&start->barrier);
+    for (int t = 0; t < threads; t++) {
+        pthread_join(handles[t], NULL);
+    }
+    double elapsed = benchNow() - begin;
+
+    pthread_barrier_destroy(&start->barrier);
+    return elapsed;
+}
+
+/**
+ * Helper function to pop from the mutex-wrapped DoublyLinkedList.
+ *
+ * @param run   the shared state
+ * @param value output: the popped value
+ * @return true if a value was popped; false if the list was empty
+ */
+static bool mutexPop(ConcurrentRun *run, int *value) {
+    bool popped = false;
+
+    pthread_mutex_lock(&run->lock);
+    if (run->list.head != NULL) {
+        *value = run->list.head->data;
+        dllDeleteHead(&run->list);
+        popped = true;
+    }
+    pthread_mutex_unlock(&run->lock);
+    return popped;
+}
+
+/**
+ * Helper function run by every lock_free worker: waits for the start
+ * signal, then alternates a push and a pop. Each worker pushes before it
+ * pops, so a pop never finds the container empty.
+ *
+ * @param arg the ConcurrentWorker
+ * @return NULL
+ */
+static void *concurrentWorker(void *arg) {
+    ConcurrentWorker *worker = arg;
+    ConcurrentRun *run = worker->run;
+    int value = 0;
+
+    waitAtStart(run->start);
+    for (long i = 0; i < run->pairs_per_thread; i++) {
+        int pushed = (int)((i << 6) | worker->id);
+        bool popped;
+
+        switch (run->kind) {
+            case CONTAINER_LOCK_FREE_STACK:
+                lfsPush(&run->stack, pushed);
+                popped = lfsPop(&run->stack, &value);
+                break;
+            case CONTAINER_LOCK_FREE_QUEUE:
+                lfqEnqueue(&run->queue, pushed);
+                popped = lfqDequeue(&run->queue, &value);
+                break;
+            case CONTAINER_MUTEX_STACK:
+                pthread_mutex_lock(&run->lock);
+                dllInsertAtHead(&run->list, pushed);
+                pthread_mutex_unlock(&run->lock);
+                popped = mutexPop(run, &value);
+                break;
+            default:
+                pthread_mutex_lock(&run->lock);
+                dllInsertAtTail(&run->list, pushed);
+                pthread_mutex_unlock(&run->lock);
+                popped = mutexPop(run, &value);
+                break;
+        }
+
+        if (!popped) {
+            fprintf(stderr, "Error: concurrent pop found an empty container\n");
+            exit(EXIT_FAILURE);
+        }
+        worker->pushed += pushed;
+        worker->popped += value;
+    }
+    return NULL;
+}
+
+/**
+ * Helper function to time one lock_free container with a given number of
+ * threads and check that every pushed value was popped exactly once (by sum).
+ *
+ * @param kind    the container
+ * @param threads number of worker threads
+ * @param pairs   total push/pop pairs, split evenly over the threads
+ * @return elapsed seconds
+ */
+static double timeContainer(ContainerKind kind, int threads, long pairs) {
+    ConcurrentRun run;
+    StartLine start;
+    ConcurrentWorker workers[MAX_THREADS];
+
+    run.kind = kind;
+    run.start = &start;
+    run.pairs_per_thread = pairs / threads;
+    lfsInit(&run.stack);
+    lfqInit(&run.queue);
+    dllInit(&run.list);
+    pthread_mutex_init(&run.lock, NULL);
+    for (int t = 0; t < threads; t++) {
+        workers[t] = (ConcurrentWorker){&run, t, 0, 0};
+    }
+
+    double elapsed = timeThreads(threads, &start, concurrentWorker, workers, sizeof(ConcurrentWorker));
+
+    long pushed = 0, popped = 0;
+    for (int t = 0; t < threads; t++) {
+        pushed += workers[t].pushed;
+        popped += workers[t].popped;
+    }
+    if (pushed != popped || !lfsIsEmpty(&run.stack) || !lfqIsEmpty(&run.queue) || !dllIsEmpty(&run.list)) {
+        fprintf(stderr, "Error: concurrent container lost or duplicated values\n");
+        exit(EXIT_FAILURE);
+    }
+    benchSink = popped;
+
+    pthread_mutex_destroy(&run.lock);
+    dllFree(&run.list);
+    lfqFree(&run.queue);
+    lfsFree(&run.stack);
+    hpCollect();
+    return elapsed;
+}
+
+/**
+ * Helper function run by every concurrent_hash_map worker: waits for the
+ * start signal, then performs a random mix of lookups, inserts and erases
+ * on random keys.
+ *
+ * @param arg the MapWorker
+ * @return NULL
+ */
+static void *mapWorker(void *arg) {
+    MapWorker *worker = arg;
+    MapRun *run = worker->run;
+    uint64_t x = worker->seed;
+    long hits = 0;
+
+    waitAtStart(run->start);
+    for (long i = 0; i < run->ops_per_thread; i++) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        int key = (int)((x >> 32) % (uint64_t)run->key_range);
+        int roll = (int)((x & 0xFFFF) % 100);
+        int value = 0;
+
+        if (run->sharded) {
+            if (roll < run->read_percent) {
+                hits += chmGet(run->map, key, &value);
+            } else if (roll & 1) {
+                chmInsert(run->map, key, key);
+            } else {
+                chmErase(run->map, key);
+            }
+        } else {
+            pthread_mutex_lock(&run->lock);
+            if (roll < run->read_percent) {
+                hits += hmGet(run->locked, key, &value);
+            } else if (roll & 1) {
+                hmInsert(run->locked, key, &key);
+            } else {
+                hmErase(run->locked, key);
+            }
+            pthread_mutex_unlock(&run->lock);
+        }
+        if (value != 0 && value != key) {
+            fprintf(stderr, "Error: concurrent lookup returned a wrong value\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    worker->hits = hits;
+    return NULL;
+}
+
+/**
+ * Helper function to time one map with a given number of threads and
+ * operation mix, starting from every other key of the range present.
+ *
+ * @param sharded      ConcurrentHashMap if true, else HashMap behind one mutex
+ * @param threads      number of worker threads
+ * @param read_percent share of lookups (0 to 100)
+ * @param key_range    keys are drawn from [0, key_range)
+ * @param ops          total operations, split evenly over the threads
+ * @return elapsed seconds
+ */
+static double timeMap(bool sharded, int threads, int read_percent, int key_range, long ops) {
+    MapRun run = {sharded, NULL, NULL, PTHREAD_MUTEX_INITIALIZER, NULL, read_percent, key_range, ops / threads};
+    StartLine start;
+    MapWorker workers[MAX_THREADS];
+    ConcurrentHashMap *map = malloc(sizeof(ConcurrentHashMap));
+    HashMap locked;
+
+    if (map == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    chmInit(map, key_range / 2);
+    hmInit(&locked, sizeof(int), key_range / 2);
+    for (int key = 0; key < key_range; key += 2) {
+        if (sharded) chmInsert(map, key, key);
+        else hmInsert(&locked, key, &key);
+    }
+    run.map = map;
+    run.locked = &locked;
+    run.start = &start;
+    for (int t = 0; t < threads; t++) {
+        workers[t] = (MapWorker){&run, 0x9E3779B97F4A7C15ULL * (uint64_t)(t + 1), 0};
+    }
+
+    double elapsed = timeThreads(threads, &start, mapWorker, workers, sizeof(MapWorker));
+
+    // Every key the map reports must be found, and no other.
+    int present = 0;
+    for (int key = 0; key < key_range; key++) {
+        present += sharded ? chmContains(map, key) : hmContains(&locked, key);
+    }
+    if (present != (sharded ? chmSize(map) : hmSize(&locked))) {
+        fprintf(stderr, "Error: concurrent map size does not match its keys\n");
+        exit(EXIT_FAILURE);
+    }
+    long hits = 0;
+    for (int t = 0; t < threads; t++) {
+        hits += workers[t].hits;
+    }
+    benchSink = hits + present;
+
+    hmFree(&locked);
+    chmFree(map);
+    free(map);
+    pthread_mutex_destroy(&run.lock);
+    hpCollect();
+    return elapsed;
+}
+
+/**
+ * Times push/pop pairs on the lock-free stack and queue next to a
+ * DoublyLinkedList behind one mutex (used as a stack and as a queue),
+ * with 1 to 64 threads sharing the same total work. On a machine with
+ * fewer cores than threads the rows show the cost of preemption: a
+ * preempted lock holder stalls every other thread, a preempted lock-free
+ * thread stalls nobody.
+ */
+void benchLockFree(void) {
+    const char *group = "lock_free";
+    long pairs = benchSize(1 << 20);
+    static const char *names[] = {"lock-free stack", "lock-free queue", "mutex list (stack)", "mutex list (queue)"};
+    char op[64];
+
+    benchNote(group, "%ld push/pop pairs per run", pairs);
+    for (int threads = 1; threads <= MAX_THREADS; threads *= 2) {
+        for (int kind = CONTAINER_LOCK_FREE_STACK; kind <= CONTAINER_MUTEX_QUEUE; kind++) {
+            long total = pairs / threads * threads;
+            double seconds = timeContainer((ContainerKind)kind, threads, total);
+            snprintf(op, sizeof(op), "%s, %d threads (pair)", names[kind], threads);
+            benchReport(group, op, total, seconds);
+        }
+    }
+}
+
+/**
+ * Times a read-heavy (95% lookups) and a write-heavy (50% lookups, 25%
+ * inserts, 25% erases) mix of random operations on the ConcurrentHashMap
+ * next to a HashMap behind one mutex, with 1 to 64 threads sharing the
+ * same total work, and checks afterwards that each map is consistent.
+ */
+void benchConcurrentHashMap(void) {
+    const char *group = "concurrent_hash_map";
+    long ops = benchSize(1 << 20);
+    int key_range = (int)benchSize(1 << 18);
+    static const int mixes[] = {95, 50};
+    char op[64];
+
+    benchNote(group, "%ld operations per run, keys in [0, %d), half present at the start", ops, key_range);
+    for (int m = 0; m < 2; m++) {
+        for (int threads = 1; threads <= MAX_THREADS; threads *= 2) {
+            long total = ops / threads * threads;
+
+            snprintf(op, sizeof(op), "sharded %d/%d, %d threads", mixes[m], 100 - mixes[m], threads);
+            benchReport(group, op, total, timeMap(true, threads, mixes[m], key_range, total));
+            snprintf(op, sizeof(op), "mutex hash map %d/%d, %d threads", mixes[m], 100 - mixes[m], threads);
+            benchReport(group, op, total, timeMap(false, threads, mixes[m], key_range, total));
+        }
+    }
+}
@@ -0,0 +1,160 @@
+/**
+ * @file bench_hash.c
+ * @brief Benchmarks of the hash map against the list and sorted-array lookups.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+#include "arrays/dynamic_array.h"
+#include "linked_lists/linked_list.h"
+#include "searching_sorting/binary_search.h"
+#include "searching_sorting/sort.h"
+#include "hash_tables/hash_map.h"
+
+/**
+ * Helper function to allocate an int buffer or abort the benchmark.
+ *
+ * @param count number of ints
+ * @return the buffer
+ */
+static int *allocInts(long count) {
+    int *buffer = malloc(sizeof(int) * (size_t)count);
+    if (buffer == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    return buffer;
+}
+
+/**
+ * Times insert, hit and miss lookups, churn (erase one key, insert
+ * another) and erase on a HashMap (int values) filled to load factors 0.5
+ * to 0.875 of a fixed table, then compares hit lookups with binarySearch
+ * on a sorted DynamicArray of the same keys and with searchIterative on a
+ * LinkedList (on a smaller set, since every list lookup is O(n)). Keys
+ * are odd and missing keys even, so hits and misses never mix.
+ */
+void benchHashMap(void) {
+    const char *group = "hash_map";
+    static const int loads[] = {4, 5, 6, 7}; // eighths
+    int slots = HM_GROUP_SIZE;
+    char op[64];
+    double start;
+
+    while (slots < benchSize(1 << 20)) slots *= 2;
+    long max_keys = (long)slots * 7 / 8;
+    int *keys = allocInts(max_keys);
+    int *misses = allocInts(max_keys);
+    for (long i = 0; i < max_keys; i++) {
+        keys[i] = (int)(benchRand() | 1);
+        misses[i] = (int)(benchRand() & ~1ULL);
+    }
+    benchNote(group, "%d slots, int keys and int values", slots);
+
+    for (int l = 0; l < 4; l++) {
+        long n = (long)slots * loads[l] / 8;
+        long half = n / 2;
+        double load = loads[l] / 8.0;
+        HashMap map;
+        long found = 0;
+
+        hmInit(&map, sizeof(int), (int)max_keys);
+
+        start = benchNow();
+        for (long i = 0; i < n; i++) {
+            int value = (int)i;
+            hmInsert(&map, keys[i], &value);
+        }
+        snprintf(op, sizeof(op), "insert (load %.3f)", load);
+        benchReport(group, op, n, benchNow() - start);
+
+        start = benchNow();
+        for (long i = 0; i < n; i++) {
+            found += hmContains(&map, keys[i]);
+        }
+        snprintf(op, sizeof(op), "lookup hit (load %.3f)", load);
+        benchReport(group, op, n, benchNow() - start);
+
+        start = benchNow();
+        for (long i = 0; i < n; i++) {
+            found += hmContains(&map, misses[i]);
+        }
+        snprintf(op, sizeof(op), "lookup miss (load %.3f)", load);
+        benchReport(group, op, n, benchNow() - start);
+
+        // Replace the first half of the keys with missing ones: the load
+        // stays put and freed slots are reused, with no tombstones left behind.
+        start = benchNow();
+        for (long i = 0; i < half; i++) {
+            int value = (int)i;
+            hmErase(&map, keys[i]);
+            hmInsert(&map, misses[i], &value);
+        }
+        snprintf(op, sizeof(op), "erase + insert (load %.3f)", load);
+        benchReport(group, op, half, benchNow() - start);
+
+        start = benchNow();
+        for (long i = 0; i < n; i++) {
+            found += hmErase(&map, i < half ? misses[i] : keys[i]);
+        }
+        snprintf(op, sizeof(op), "erase (load %.3f)", load);
+        benchReport(group, op, n, benchNow() - start);
+
+        benchSink = found + hmSize(&map) + map.capacity;
+        hmFree(&map);
+    }
+
+    // Sorted DynamicArray + binarySearch on the largest key set.
+    DynamicArray sorted;
+    long found = 0;
+    daInit(&sorted, (int)max_keys);
+    for (long i = 0; i < max_keys; i++) {
+        daPushBack(&sorted, keys[i]);
+    }
+    start = benchNow();
+    daSort(&sorted);
+    benchReport(group, "sorted array: build (sort)", max_keys, benchNow() - start);
+
+    start = benchNow();
+    for (long i = 0; i < max_keys; i++) {
+        found += binarySearch(sorted.data, sorted.size, keys[i]) >= 0;
+    }
+    benchReport(group, "sorted array: binarySearch hit", max_keys, benchNow() - start);
+    daFree(&sorted);
+
+    // LinkedList searchIterative against a HashSet on a small key set.
+    long small = 4096;
+    LinkedList list;
+    HashSet set;
+    llInit(&list);
+    hsInit(&set, (int)small);
+    for (long i = 0; i < small; i++) {
+        llInsertAtHead(&list, keys[i]);
+        hsInsert(&set, keys[i]);
+    }
+
+    start = benchNow();
+    for (long i = 0; i < small; i++) {
+        found += llSearchIterative(&list, keys[i]);
+    }
+    snprintf(op, sizeof(op), "linked list: search hit (n=%ld)", small);
+    benchReport(group, op, small, benchNow() - start);
+
+    start = benchNow();
+    for (long i = 0; i < small; i++) {
+        found += hsContains(&set, keys[i]);
+    }
+    snprintf(op, sizeof(op), "hash set: contains hit (n=%ld)", small);
+    benchReport(group, op, small, benchNow() - start);
+
+    benchSink = found;
+    hsFree(&set);
+    llFree(&list);
+    free(misses);
+    free(keys);
+}
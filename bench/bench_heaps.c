@@ -0,0 +1,362 @@
+/**
+ * @file bench_heaps.c
+ * @brief Benchmarks of the priority queues against a sorted list, and of
+ *        every MinQueue kind on the same operation trace.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+#include "arrays/dynamic_array.h"
+#include "linked_lists/doubly_linked_list.h"
+#include "heaps/priority_queue.h"
+#include "heaps/min_queue.h"
+
+// Largest increment added to a popped key before it is pushed back.
+#define HOLD_INCREMENT 1024
+
+// Longest trace recorded, in steps (each step is up to 4 operations).
+#define TRACE_MAX_STEPS (1L << 22)
+
+// Operations of a trace.
+typedef enum {
+    TRACE_PUSH,                 // push key as element id
+    TRACE_POP,                  // pop the smallest key
+    TRACE_DECREASE              // lower the key of element id to key
+} TraceOp;
+
+// Structure to represent one operation of a trace.
+typedef struct {
+    TraceOp op;                 // the operation
+    int id;                     // element the operation applies to (push, decrease)
+    int key;                    // the new key (push, decrease)
+} TraceEntry;
+
+// Structure to represent a recorded trace.
+typedef struct {
+    TraceEntry *entries;        // the operations, in order
+    long count;                 // number of operations
+    long warm;                  // operations that only fill the queue (not timed)
+    int pushes;                 // number of element ids
+} Trace;
+
+/**
+ * Helper function to run the hold model on a sorted DoublyLinkedList:
+ * pop the head, then insert the key plus a random increment at its
+ * sorted position with insertAtPosition.
+ *
+ * @param queue the queue size
+ * @param ops   number of pop + push pairs
+ * @return elapsed seconds
+ */
+static double holdSortedList(long queue, long ops) {
+    DoublyLinkedList list;
+
+    dllInit(&list);
+    for (long i = 0; i < queue; i++) {
+        dllInsertAtHead(&list, 0);
+    }
+
+    double start = benchNow();
+    for (long i = 0; i < ops; i++) {
+        int key = list.head->data + (int)(benchRand() % HOLD_INCREMENT);
+        dllDeleteHead(&list);
+
+        int index = 0;
+        for (DLLNode *curr = list.head; curr != NULL && curr->data < key; curr = curr->next) {
+            index++;
+        }
+        dllInsertAtPosition(&list, key, index);
+    }
+    double elapsed = benchNow() - start;
+
+    benchSink = list.head->data;
+    dllFree(&list);
+    return elapsed;
+}
+
+/**
+ * Helper function to run the hold model on a PriorityQueue.
+ *
+ * @param arity         the heap's arity
+ * @param track_handles whether the queue maintains handles
+ * @param queue         the queue size
+ * @param ops           number of pop + push pairs
+ * @return elapsed seconds
+ */
+static double holdHeap(int arity, bool track_handles, long queue, long ops) {
+    PriorityQueue pq;
+
+    pqInit(&pq, arity, track_handles);
+    for (long i = 0; i < queue; i++) {
+        pqPush(&pq, (int)(benchRand() % (1 << 20)));
+    }
+
+    double start = benchNow();
+    for (long i = 0; i < ops; i++) {
+        int key = pqPop(&pq);
+        pqPush(&pq, key + (int)(benchRand() % HOLD_INCREMENT));
+    }
+    double elapsed = benchNow() - start;
+
+    benchSink = pqPeek(&pq);
+    pqFree(&pq);
+    return elapsed;
+}
+
+/**
+ * Times the hold model (pop the smallest key, push it back with a random
+ * increment, as an event scheduler does) on a sorted DoublyLinkedList
+ * and on binary, 4-ary and 8-ary heaps, then bulk heapify against one
+ * push per key, and decreaseKey through handles. The default is about
+ * 1M operations per row; --scale=100 runs 100M.
+ */
+void benchPriorityQueue(void) {
+    const char *group = "priority_queue";
+    long ops = benchSize(1 << 20);
+    long small = 1024;
+    long large = benchSize(1 << 20);
+    static const int arities[] = {2, 4, 8};
+    char op[64];
+    double start;
+
+    long list_ops = ops / 8 > 0 ? ops / 8 : 1;
+    snprintf(op, sizeof(op), "sorted list hold (queue %ld)", small);
+    benchReport(group, op, list_ops, holdSortedList(small, list_ops));
+    for (int a = 0; a < 3; a++) {
+        snprintf(op, sizeof(op), "%d-ary heap hold (queue %ld)", arities[a], small);
+        benchReport(group, op, ops, holdHeap(arities[a], false, small, ops));
+    }
+    for (int a = 0; a < 3; a++) {
+        snprintf(op, sizeof(op), "%d-ary heap hold (queue %ld)", arities[a], large);
+        benchReport(group, op, ops, holdHeap(arities[a], false, large, ops));
+        snprintf(op, sizeof(op), "%d-ary heap hold, handles (queue %ld)", arities[a], large);
+        benchReport(group, op, ops, holdHeap(arities[a], true, large, ops));
+    }
+
+    DynamicArray keys;
+    daInit(&keys, (int)large);
+    for (long i = 0; i < large; i++) {
+        daPushBack(&keys, (int)(benchRand() % (1 << 30)));
+    }
+
+    for (int a = 0; a < 3; a++) {
+        PriorityQueue pq;
+
+        pqInit(&pq, arities[a], true);
+        start = benchNow();
+        for (long i = 0; i < large; i++) {
+            pqPush(&pq, keys.data[i]);
+        }
+        snprintf(op, sizeof(op), "%d-ary push (one per key)", arities[a]);
+        benchReport(group, op, large, benchNow() - start);
+
+        start = benchNow();
+        pqHeapify(&pq, &keys);
+        snprintf(op, sizeof(op), "%d-ary heapify (per key)", arities[a]);
+        benchReport(group, op, large, benchNow() - start);
+
+        start = benchNow();
+        for (long i = 0; i < ops; i++) {
+            int handle = (int)(benchRand() % (uint64_t)large);
+            pqDecreaseKey(&pq, handle, pqGetKey(&pq, handle) - (int)(benchRand() % HOLD_INCREMENT));
+        }
+        snprintf(op, sizeof(op), "%d-ary decreaseKey (queue %ld)", arities[a], large);
+        benchReport(group, op, ops, benchNow() - start);
+
+        benchSink = pqPeek(&pq);
+        pqFree(&pq);
+    }
+    daFree(&keys);
+}
+
+/**
+ * Helper function to append an operation to a trace being recorded.
+ *
+ * @param trace    pointer to the Trace
+ * @param capacity pointer to the capacity of trace->entries
+ * @param op       the operation
+ * @param id       its element
+ * @param key      its key
+ */
+static void traceAppend(Trace *trace, long *capacity, TraceOp op, int id, int key) {
+    if (trace->count == *capacity) {
+        *capacity *= 2;
+        trace->entries = realloc(trace->entries, sizeof(TraceEntry) * (size_t)*capacity);
+        if (trace->entries == NULL) {
+            fprintf(stderr, "Memory allocation failed\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    trace->entries[trace->count++] = (TraceEntry){op, id, key};
+}
+
+/**
+ * Helper function to record a monotone trace by running it on a 4-ary
+ * heap: the queue is filled with queue keys, then every step pops the
+ * smallest key (the current time), pushes one key up to HOLD_INCREMENT
+ * later, and lowers up to decreases random queued keys to somewhere
+ * between the current time and their key, as Dijkstra's relaxations do.
+ *
+ * @param queue     the queue size
+ * @param steps     number of steps
+ * @param decreases decreaseKeys per step
+ * @return the trace; free its entries when done
+ */
+static Trace recordTrace(long queue, long steps, int decreases) {
+    Trace trace = {NULL, 0, 0, 0};
+    long capacity = queue + steps * (2 + decreases);
+    PriorityQueue pq;
+    DynamicArray id_of_handle, handle_of_id, live, live_index;
+
+    trace.entries = malloc(sizeof(TraceEntry) * (size_t)capacity);
+    if (trace.entries == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    pqInit(&pq, 4, true);
+    daInit(&id_of_handle, 16);
+    daInit(&handle_of_id, 16);
+    daInit(&live, 16);
+    daInit(&live_index, 16);
+
+    int now = 0;
+    for (long i = 0; i < queue + steps; i++) {
+        if (i >= queue) {
+            // Pop, removing the element from the live set by swapping in the last one.
+            int id = id_of_handle.data[pqPeekHandle(&pq)];
+            now = pqPop(&pq);
+            traceAppend(&trace, &capacity, TRACE_POP, 0, 0);
+            int moved = live.data[live.size - 1];
+            live.data[live_index.data[id]] = moved;
+            live_index.data[moved] = live_index.data[id];
+            live.size--;
+        }
+
+        int id = trace.pushes++;
+        int key = now + (int)(benchRand() % HOLD_INCREMENT);
+        int handle = pqPush(&pq, key);
+        traceAppend(&trace, &capacity, TRACE_PUSH, id, key);
+        while (id_of_handle.size <= handle) daPushBack(&id_of_handle, 0);
+        id_of_handle.data[handle] = id;
+        daPushBack(&handle_of_id, handle);
+        daPushBack(&live_index, live.size);
+        daPushBack(&live, id);
+
+        for (int d = 0; d < decreases && i >= queue; d++) {
+            int target = live.data[benchRand() % (uint64_t)live.size];
+            int target_handle = handle_of_id.data[target];
+            int current = pqGetKey(&pq, target_handle);
+
+            // Kinds may pop tied keys in different orders, so only an element
+            // whose key is above the current time is queued in all of them.
+            if (current == now) continue;
+            int lowered = now + (int)(benchRand() % (uint64_t)(current - now + 1));
+            pqDecreaseKey(&pq, target_handle, lowered);
+            traceAppend(&trace, &capacity, TRACE_DECREASE, target, lowered);
+        }
+        if (i == queue - 1) trace.warm = trace.count;
+    }
+
+    pqFree(&pq);
+    daFree(&id_of_handle);
+    daFree(&handle_of_id);
+    daFree(&live);
+    daFree(&live_index);
+    return trace;
+}
+
+/**
+ * Helper function to replay a trace on a MinQueue, timing everything
+ * after the warm-up operations.
+ *
+ * @param kind     the implementation to replay on
+ * @param trace    pointer to the Trace
+ * @param checksum set to a checksum of the popped keys, in order
+ * @return elapsed seconds
+ */
+static double replayTrace(MinQueueKind kind, const Trace *trace, long *checksum) {
+    MinQueue q;
+    MQHandle *handles = malloc(sizeof(MQHandle) * (size_t)(trace->pushes > 0 ? trace->pushes : 1));
+    unsigned long sum = 0;
+    double start = 0.0;
+
+    if (handles == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    mqInit(&q, kind, true);
+
+    for (long i = 0; i < trace->count; i++) {
+        const TraceEntry *entry = &trace->entries[i];
+        if (i == trace->warm) start = benchNow();
+        switch (entry->op) {
+            case TRACE_PUSH:
+                handles[entry->id] = mqPush(&q, entry->key);
+                break;
+            case TRACE_POP:
+                sum = sum * 31 + (unsigned long)mqPop(&q);
+                break;
+            case TRACE_DECREASE:
+                mqDecreaseKey(&q, handles[entry->id], entry->key);
+                break;
+        }
+    }
+    double elapsed = benchNow() - start;
+
+    *checksum = (long)sum;
+    benchSink = (long)sum;
+    mqFree(&q);
+    free(handles);
+    return elapsed;
+}
+
+/**
+ * Records monotone operation traces (a hold model at two queue sizes and
+ * a Dijkstra-like mix with two decreaseKeys per pop) and replays each
+ * one on every MinQueue kind: binary, 4-ary and 8-ary heaps, the pairing
+ * heap and the radix heap. Every kind must pop the same keys in the same
+ * order; a mismatch is reported as a note. The default is about 1M steps
+ * per trace; --scale multiplies it, up to TRACE_MAX_STEPS.
+ */
+void benchMinQueue(void) {
+    const char *group = "min_queue";
+    long steps = benchSize(1 << 20);
+    static const MinQueueKind kinds[] = {MQ_HEAP_2, MQ_HEAP_4, MQ_HEAP_8, MQ_PAIRING, MQ_RADIX};
+    static const struct {
+        const char *name;
+        long queue;
+        int decreases;
+    } shapes[] = {
+        {"hold", 1024, 0},
+        {"hold", 1 << 20, 0},
+        {"dijkstra", 1 << 16, 2},
+    };
+    char op[64];
+
+    if (steps > TRACE_MAX_STEPS) steps = TRACE_MAX_STEPS;
+
+    for (int s = 0; s < 3; s++) {
+        Trace trace = recordTrace(shapes[s].queue, steps, shapes[s].decreases);
+        long ops = trace.count - trace.warm;
+        long reference = 0;
+
+        for (int k = 0; k < 5; k++) {
+            long checksum;
+            double seconds = replayTrace(kinds[k], &trace, &checksum);
+
+            snprintf(op, sizeof(op), "%s %s (queue %ld)", mqKindName(kinds[k]), shapes[s].name, shapes[s].queue);
+            benchReport(group, op, ops, seconds);
+            if (k == 0) {
+                reference = checksum;
+            } else if (checksum != reference) {
+                benchNote(group, "%s popped a different key sequence on the %s trace", mqKindName(kinds[k]), shapes[s].name);
+            }
+        }
+        free(trace.entries);
+    }
+}
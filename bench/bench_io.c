@@ -0,0 +1,270 @@
+/**
+ * @file bench_io.c
+ * @brief Benchmarks of saving, loading and printing structures.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "arrays/dynamic_array.h"
+#include "linked_lists/linked_list.h"
+#include "linked_lists/doubly_linked_list.h"
+#include "io/snapshot.h"
+#include "io/format.h"
+
+/**
+ * Helper function to open a scratch file or abort the benchmark.
+ *
+ * @param path the file
+ * @param mode fopen mode
+ * @return the open stream
+ */
+static FILE *openOrDie(const char *path, const char *mode) {
+    FILE *file = fopen(path, mode);
+    if (file == NULL) {
+        fprintf(stderr, "Error: cannot open %s\n", path);
+        exit(EXIT_FAILURE);
+    }
+    return file;
+}
+
+/**
+ * Times snapshot save and load of a DynamicArray next to a raw fwrite and
+ * fread of the same bytes (the disk speed, or the page cache once the file
+ * is cached), then of pooled LinkedList and DoublyLinkedList snapshots
+ * next to rebuilding the lists with insertAtTail (one malloc per node). Aborts if anything loads
+ * back different from what was saved.
+ */
+void benchSnapshot(void) {
+    const char *group = "snapshot";
+    long n = benchSize(100000000);
+    long list_n = benchSize(16L << 20);
+    char path[256];
+    DynamicArray arr, loaded;
+    double start, elapsed;
+    FILE *file;
+
+    benchTempPath(path, sizeof(path), "snapshot");
+
+    daInit(&arr, (int)n);
+    for (long i = 0; i < n; i++) {
+        daPushBack(&arr, (int)benchRand());
+    }
+    double mb = n * (double)sizeof(int) / (1 << 20);
+    benchNote(group, "  %.0f MB of ints", mb);
+
+    start = benchNow();
+    benchSink = (long)snapshotCrc32c(0, arr.data, sizeof(int) * (size_t)n);
+    elapsed = benchNow() - start;
+    benchNote(group, "  CRC-32C %.0f MB/s", mb / elapsed);
+
+    file = openOrDie(path, "wb");
+    start = benchNow();
+    fwrite(arr.data, sizeof(int), (size_t)n, file);
+    fclose(file);
+    elapsed = benchNow() - start;
+    benchReport(group, "raw fwrite", n, elapsed);
+    benchNote(group, "  %.0f MB/s", mb / elapsed);
+
+    file = openOrDie(path, "rb");
+    daInit(&loaded, (int)n);
+    start = benchNow();
+    benchSink = (long)fread(loaded.data, sizeof(int), (size_t)n, file);
+    elapsed = benchNow() - start;
+    fclose(file);
+    daFree(&loaded);
+    benchReport(group, "raw fread", n, elapsed);
+    benchNote(group, "  %.0f MB/s", mb / elapsed);
+
+    file = openOrDie(path, "wb");
+    start = benchNow();
+    int status = daSave(&arr, file);
+    fclose(file);
+    elapsed = benchNow() - start;
+    benchReport(group, "daSave", n, elapsed);
+    benchNote(group, "  %.0f MB/s", mb / elapsed);
+
+    file = openOrDie(path, "rb");
+    start = benchNow();
+    if (status == 0) status = daLoad(&loaded, file);
+    elapsed = benchNow() - start;
+    fclose(file);
+    benchReport(group, "daLoad", n, elapsed);
+    benchNote(group, "  %.0f MB/s", mb / elapsed);
+
+    if (status != 0 || loaded.size != arr.size ||
+        memcmp(loaded.data, arr.data, sizeof(int) * (size_t)n) != 0) {
+        fprintf(stderr, "Error: loaded DynamicArray differs from the saved one\n");
+        exit(EXIT_FAILURE);
+    }
+    daFree(&loaded);
+
+    LinkedList list, loaded_list;
+    llInit(&list);
+    start = benchNow();
+    for (long i = 0; i < list_n; i++) {
+        llInsertAtTail(&list, arr.data[i % n]);
+    }
+    benchReport(group, "rebuild list (insertAtTail)", list_n, benchNow() - start);
+
+    file = openOrDie(path, "wb");
+    start = benchNow();
+    status = llSave(&list, file);
+    fclose(file);
+    benchReport(group, "llSave", list_n, benchNow() - start);
+
+    file = openOrDie(path, "rb");
+    start = benchNow();
+    if (status == 0) status = llLoad(&loaded_list, file);
+    benchReport(group, "llLoad", list_n, benchNow() - start);
+    fclose(file);
+
+    bool same = (status == 0 && loaded_list.size == list.size);
+    for (LLNode *a = list.head, *b = loaded_list.head; same && a != NULL; a = a->next, b = b->next) {
+        same = (b != NULL && a->data == b->data);
+    }
+    if (!same) {
+        fprintf(stderr, "Error: loaded LinkedList differs from the saved one\n");
+        exit(EXIT_FAILURE);
+    }
+    llFree(&loaded_list);
+    llFree(&list);
+
+    DoublyLinkedList dlist, loaded_dlist;
+    dllInit(&dlist);
+    start = benchNow();
+    for (long i = 0; i < list_n; i++) {
+        dllInsertAtTail(&dlist, arr.data[i % n]);
+    }
+    benchReport(group, "rebuild dlist (insertAtTail)", list_n, benchNow() - start);
+
+    file = openOrDie(path, "wb");
+    start = benchNow();
+    status = dllSave(&dlist, file);
+    fclose(file);
+    benchReport(group, "dllSave", list_n, benchNow() - start);
+
+    file = openOrDie(path, "rb");
+    start = benchNow();
+    if (status == 0) status = dllLoad(&loaded_dlist, file);
+    benchReport(group, "dllLoad", list_n, benchNow() - start);
+    fclose(file);
+
+    same = (status == 0 && loaded_dlist.size == dlist.size);
+    for (DLLNode *a = dlist.tail, *b = loaded_dlist.tail; same && a != NULL; a = a->prev, b = b->prev) {
+        same = (b != NULL && a->data == b->data);
+    }
+    if (!same) {
+        fprintf(stderr, "Error: loaded DoublyLinkedList differs from the saved one\n");
+        exit(EXIT_FAILURE);
+    }
+    dllFree(&loaded_dlist);
+    dllFree(&dlist);
+
+    daFree(&arr);
+    remove(path);
+}
+
+/**
+ * Times dumping a DynamicArray and a LinkedList as text to a file with one
+ * fprintf per element (the old xxPrint loops) and with the buffered
+ * formatter in each output format, including the reverse dump of a list
+ * far too long for the old recursive llPrintReverse. Aborts if the
+ * buffered text differs from the fprintf text.
+ */
+void benchFormat(void) {
+    const char *group = "format";
+    long n = benchSize(10000000);
+    char path[256];
+    DynamicArray arr;
+    LinkedList list;
+    OutputBuffer out;
+    double start;
+    FILE *file;
+
+    benchTempPath(path, sizeof(path), "format");
+
+    daInit(&arr, (int)n);
+    llInitPooled(&list, SNAPSHOT_LIST_SLAB_NODES);
+    for (long i = 0; i < n; i++) {
+        int value = (int)benchRand();
+        daPushBack(&arr, value);
+        llInsertAtTail(&list, value);
+    }
+
+    file = openOrDie(path, "w");
+    start = benchNow();
+    fprintf(file, "[");
+    for (long i = 0; i < n; i++) {
+        fprintf(file, i + 1 < n ? "%d," : "%d", arr.data[i]);
+    }
+    fprintf(file, "]\n");
+    fclose(file);
+    benchReport(group, "fprintf per element", n, benchNow() - start);
+
+    OutputBuffer text;
+    obInit(&text, NULL, 0);
+    daFormat(&arr, &text, OUTPUT_TEXT);
+
+    file = openOrDie(path, "r");
+    char *expected = malloc(text.length + 1);
+    if (expected == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    size_t expected_length = fread(expected, 1, text.length + 1, file);
+    fclose(file);
+    if (expected_length != text.length || memcmp(expected, text.data, text.length) != 0) {
+        fprintf(stderr, "Error: daFormat text differs from printf\n");
+        exit(EXIT_FAILURE);
+    }
+    free(expected);
+    obFree(&text);
+
+    const char *format_names[] = {"text", "csv", "json"};
+    char name[64];
+    for (int format = OUTPUT_TEXT; format <= OUTPUT_JSON; format++) {
+        file = openOrDie(path, "w");
+        start = benchNow();
+        obInit(&out, file, 0);
+        daFormat(&arr, &out, (OutputFormat)format);
+        obFree(&out);
+        fclose(file);
+        snprintf(name, sizeof(name), "daFormat (%s)", format_names[format]);
+        benchReport(group, name, n, benchNow() - start);
+    }
+
+    file = openOrDie(path, "w");
+    start = benchNow();
+    for (LLNode *curr = list.head; curr != NULL; curr = curr->next) {
+        fprintf(file, "%d -> ", curr->data);
+    }
+    fprintf(file, "NULL\n");
+    fclose(file);
+    benchReport(group, "list fprintf per element", n, benchNow() - start);
+
+    file = openOrDie(path, "w");
+    start = benchNow();
+    obInit(&out, file, 0);
+    llFormat(&list, &out, OUTPUT_TEXT);
+    obFree(&out);
+    fclose(file);
+    benchReport(group, "llFormat (text)", n, benchNow() - start);
+
+    file = openOrDie(path, "w");
+    start = benchNow();
+    obInit(&out, file, 0);
+    llFormatReverse(&list, &out, OUTPUT_TEXT);
+    obFree(&out);
+    fclose(file);
+    benchReport(group, "llFormatReverse (text)", n, benchNow() - start);
+
+    llFree(&list);
+    daFree(&arr);
+    remove(path);
+}
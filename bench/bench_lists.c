@@ -0,0 +1,450 @@
+/**
+ * @file bench_lists.c
+ * @brief Benchmarks of the LinkedList and DoublyLinkedList hot operations.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+
+#include "bench.h"
+#include "arrays/dynamic_array.h"
+#include "arrays/dynamic_array_scan.h"
+#include "linked_lists/linked_list.h"
+#include "linked_lists/doubly_linked_list.h"
+#include "linked_lists/unrolled_linked_list.h"
+
+/**
+ * Times head/tail insertion, a missing-value search and head deletion
+ * on a LinkedList.
+ */
+void benchLinkedList(void) {
+    const char *group = "linked_list";
+    long n = benchSize(1000000);
+    long searches = 100;
+    LinkedList list;
+    double start;
+
+    llInit(&list);
+    start = benchNow();
+    for (long i = 0; i < n; i++) {
+        llInsertAtHead(&list, (int)i);
+    }
+    benchReport(group, "insertAtHead", n, benchNow() - start);
+
+    int found = 0;
+    start = benchNow();
+    for (long i = 0; i < searches; i++) {
+        found += llSearchIterative(&list, -1);
+    }
+    benchReport(group, "searchIterative (per node)", searches * n, benchNow() - start);
+    benchSink = found;
+
+    start = benchNow();
+    for (long i = 0; i < n; i++) {
+        llDeleteByPosition(&list, 0);
+    }
+    benchReport(group, "deleteByPosition (head)", n, benchNow() - start);
+
+    start = benchNow();
+    for (long i = 0; i < n; i++) {
+        llInsertAtTail(&list, (int)i);
+    }
+    benchReport(group, "insertAtTail", n, benchNow() - start);
+
+    llFree(&list);
+}
+
+/**
+ * Helper function to abort the benchmark if a list's tail pointer is not
+ * on its last node.
+ *
+ * @param list the list to check
+ * @param last the value the last node must hold
+ * @param step description of the operation just performed
+ */
+static void checkTail(LinkedList *list, int last, const char *step) {
+    if (list->tail == NULL || list->tail->next != NULL || list->tail->data != last) {
+        fprintf(stderr, "Error: tail pointer is wrong after %s\n", step);
+        exit(EXIT_FAILURE);
+    }
+}
+
+/**
+ * Builds LinkedLists of 1M and 10M elements with insertAtTail.
+ * The ns/op of both builds should stay in the same range (a quadratic
+ * build of 10M nodes would not finish); aborts if the tail pointer does
+ * not end up on the last node. Then repeatedly removes the last node of
+ * a short list with deleteByPosition and deleteByValue (down to an empty
+ * list), appending after every removal and checking the tail again.
+ */
+void benchLinkedListStress(void) {
+    const char *group = "linked_list_stress";
+    long sizes[] = {benchSize(1000000), benchSize(10000000)};
+    char name[64];
+
+    for (int s = 0; s < 2; s++) {
+        LinkedList list;
+        llInit(&list);
+
+        double start = benchNow();
+        for (long i = 0; i < sizes[s]; i++) {
+            llInsertAtTail(&list, (int)i);
+        }
+        double elapsed = benchNow() - start;
+
+        snprintf(name, sizeof(name), "insertAtTail (build %ld)", sizes[s]);
+        benchReport(group, name, sizes[s], elapsed);
+
+        if (list.size != sizes[s] || list.tail == NULL || list.tail->next != NULL ||
+            list.tail->data != (int)(sizes[s] - 1)) {
+            fprintf(stderr, "Error: tail pointer is wrong after building %ld nodes\n", sizes[s]);
+            exit(EXIT_FAILURE);
+        }
+        llFree(&list);
+    }
+
+    // Removing the last node must move the tail back to its predecessor.
+    long rounds = benchSize(1000);
+    long length = 1000;
+    LinkedList list;
+    llInit(&list);
+    for (long i = 0; i < length; i++) {
+        llInsertAtTail(&list, (int)i);
+    }
+
+    int next = (int)length;
+    double start = benchNow();
+    for (long i = 0; i < rounds; i++) {
+        llDeleteByPosition(&list, list.size - 1);
+        llInsertAtTail(&list, next);
+        checkTail(&list, next++, "deleteByPosition of the last node");
+
+        llDeleteByValue(&list, next - 1);
+        llInsertAtTail(&list, next);
+        checkTail(&list, next++, "deleteByValue of the last node");
+    }
+    snprintf(name, sizeof(name), "delete last + insertAtTail (list %ld)", length);
+    benchReport(group, name, 2 * rounds, benchNow() - start);
+
+    // Down to a single node, whose removal empties the list.
+    while (list.size > 1) {
+        llDeleteByPosition(&list, list.size - 1);
+    }
+    llDeleteByValue(&list, list.head->data);
+    if (list.head != NULL || list.tail != NULL) {
+        fprintf(stderr, "Error: tail pointer is wrong after deleting the only node\n");
+        exit(EXIT_FAILURE);
+    }
+    llInsertAtTail(&list, next);
+    checkTail(&list, next, "insertAtTail into an emptied list");
+    llFree(&list);
+}
+
+/**
+ * Times the same operations as benchLinkedList on a DoublyLinkedList.
+ */
+void benchDoublyLinkedList(void) {
+    const char *group = "doubly_linked_list";
+    long n = benchSize(1000000);
+    long tail_n = benchSize(20000);
+    long searches = 100;
+    DoublyLinkedList list;
+    double start;
+
+    dllInit(&list);
+    start = benchNow();
+    for (long i = 0; i < n; i++) {
+        dllInsertAtHead(&list, (int)i);
+    }
+    benchReport(group, "insertAtHead", n, benchNow() - start);
+
+    int found = 0;
+    start = benchNow();
+    for (long i = 0; i < searches; i++) {
+        found += dllSearchIterative(&list, -1);
+    }
+    benchReport(group, "searchIterative (per node)", searches * n, benchNow() - start);
+    benchSink = found;
+
+    start = benchNow();
+    for (long i = 0; i < n; i++) {
+        dllDeleteHead(&list);
+    }
+    benchReport(group, "deleteHead", n, benchNow() - start);
+
+    start = benchNow();
+    for (long i = 0; i < tail_n; i++) {
+        dllInsertAtTail(&list, (int)i);
+    }
+    benchReport(group, "insertAtTail", tail_n, benchNow() - start);
+
+    dllFree(&list);
+}
+
+/**
+ * Runs one build/churn/traverse/free cycle on a LinkedList and reports each phase.
+ * Churn mixes head inserts with deletes at random positions near the head,
+ * so the nodes end up in a different order than they were allocated in.
+ *
+ * @param group  name of the benchmark group
+ * @param label  suffix identifying the allocation path in the report
+ * @param pooled true to give the list a node pool
+ */
+static void churnLinkedList(const char *group, const char *label, bool pooled) {
+    long n = benchSize(1000000);
+    long churn = benchSize(2000000);
+    long searches = 20;
+    char name[64];
+    LinkedList list;
+    double start;
+
+    if (pooled) llInitPooled(&list, 4096);
+    else llInit(&list);
+
+    benchSeed(7);
+    start = benchNow();
+    for (long i = 0; i < n; i++) {
+        llInsertAtHead(&list, (int)i);
+    }
+    snprintf(name, sizeof(name), "ll insertAtHead (%s)", label);
+    benchReport(group, name, n, benchNow() - start);
+
+    start = benchNow();
+    for (long i = 0; i < churn; i++) {
+        if (i & 1) llInsertAtHead(&list, (int)i);
+        else llDeleteByPosition(&list, (int)(benchRand() % 64));
+    }
+    snprintf(name, sizeof(name), "ll churn (%s)", label);
+    benchReport(group, name, churn, benchNow() - start);
+
+    int found = 0;
+    start = benchNow();
+    for (long i = 0; i < searches; i++) {
+        found += llSearchIterative(&list, -1);
+    }
+    snprintf(name, sizeof(name), "ll traverse/node (%s)", label);
+    benchReport(group, name, searches * list.size, benchNow() - start);
+    benchSink = found;
+
+    long size = list.size;
+    start = benchNow();
+    llFree(&list);
+    snprintf(name, sizeof(name), "ll free/node (%s)", label);
+    benchReport(group, name, size, benchNow() - start);
+}
+
+/**
+ * Same cycle as churnLinkedList on a DoublyLinkedList.
+ *
+ * @param group  name of the benchmark group
+ * @param label  suffix identifying the allocation path in the report
+ * @param pooled true to give the list a node pool
+ */
+static void churnDoublyLinkedList(const char *group, const char *label, bool pooled) {
+    long n = benchSize(1000000);
+    long churn = benchSize(2000000);
+    long searches = 20;
+    char name[64];
+    DoublyLinkedList list;
+    double start;
+
+    if (pooled) dllInitPooled(&list, 4096);
+    else dllInit(&list);
+
+    benchSeed(7);
+    start = benchNow();
+    for (long i = 0; i < n; i++) {
+        dllInsertAtHead(&list, (int)i);
+    }
+    snprintf(name, sizeof(name), "dll insertAtHead (%s)", label);
+    benchReport(group, name, n, benchNow() - start);
+
+    start = benchNow();
+    for (long i = 0; i < churn; i++) {
+        if (i & 1) dllInsertAtHead(&list, (int)i);
+        else dllDeleteByPosition(&list, (int)(benchRand() % 64));
+    }
+    snprintf(name, sizeof(name), "dll churn (%s)", label);
+    benchReport(group, name, churn, benchNow() - start);
+
+    int found = 0;
+    start = benchNow();
+    for (long i = 0; i < searches; i++) {
+        found += dllSearchIterative(&list, -1);
+    }
+    snprintf(name, sizeof(name), "dll traverse/node (%s)", label);
+    benchReport(group, name, searches * list.size, benchNow() - start);
+    benchSink = found;
+
+    long size = list.size;
+    start = benchNow();
+    dllFree(&list);
+    snprintf(name, sizeof(name), "dll free/node (%s)", label);
+    benchReport(group, name, size, benchNow() - start);
+}
+
+/**
+ * Compares malloc-per-node lists with node-pool lists under the same workload.
+ */
+void benchNodePool(void) {
+    const char *group = "node_pool";
+
+    churnLinkedList(group, "malloc", false);
+    churnLinkedList(group, "pool", true);
+    churnDoublyLinkedList(group, "malloc", false);
+    churnDoublyLinkedList(group, "pool", true);
+}
+
+/**
+ * Compares an UnrolledLinkedList with LinkedList and DoublyLinkedList:
+ * building by appending, traversal per value, memory per value, and
+ * random positional inserts and deletes.
+ */
+void benchUnrolledList(void) {
+    const char *group = "unrolled_list";
+    long n = benchSize(1000000);
+    long searches = 20;
+    long positional_n = benchSize(100000);
+    long positional_ops = benchSize(20000);
+    LinkedList ll;
+    DoublyLinkedList dll;
+    UnrolledLinkedList ull;
+    double start;
+    int found = 0;
+
+    llInit(&ll);
+    dllInit(&dll);
+    ullInit(&ull);
+
+    start = benchNow();
+    for (long i = 0; i < n; i++) llInsertAtTail(&ll, (int)i);
+    benchReport(group, "insertAtTail (ll)", n, benchNow() - start);
+
+    start = benchNow();
+    for (long i = 0; i < n; i++) dllInsertAtTail(&dll, (int)i);
+    benchReport(group, "insertAtTail (dll)", n, benchNow() - start);
+
+    start = benchNow();
+    for (long i = 0; i < n; i++) ullInsertAtTail(&ull, (int)i);
+    benchReport(group, "insertAtTail (unrolled)", n, benchNow() - start);
+
+    start = benchNow();
+    for (long i = 0; i < searches; i++) found += llSearchIterative(&ll, -1);
+    benchReport(group, "traverse/value (ll)", searches * n, benchNow() - start);
+
+    start = benchNow();
+    for (long i = 0; i < searches; i++) found += dllSearchIterative(&dll, -1);
+    benchReport(group, "traverse/value (dll)", searches * n, benchNow() - start);
+
+    start = benchNow();
+    for (long i = 0; i < searches; i++) found += ullSearchIterative(&ull, -1);
+    benchReport(group, "traverse/value (unrolled)", searches * n, benchNow() - start);
+    benchSink = found;
+
+    benchNote(group, "  bytes/value: ll %.1f, dll %.1f, unrolled %.1f (%d values per node)",
+              (double)sizeof(LLNode), (double)sizeof(DLLNode),
+              (double)ull.nodes * sizeof(ULLNode) / ull.size, ULL_NODE_CAPACITY);
+
+    llFree(&ll);
+    dllFree(&dll);
+    ullFree(&ull);
+
+    for (long i = 0; i < positional_n; i++) {
+        dllInsertAtTail(&dll, (int)i);
+        ullInsertAtTail(&ull, (int)i);
+    }
+
+    benchSeed(11);
+    start = benchNow();
+    for (long i = 0; i < positional_ops; i++) {
+        dllInsertAtPosition(&dll, (int)i, (int)(benchRand() % (uint64_t)(dll.size + 1)));
+        dllDeleteByPosition(&dll, (int)(benchRand() % (uint64_t)dll.size));
+    }
+    benchReport(group, "insert+delete at random (dll)", positional_ops, benchNow() - start);
+
+    benchSeed(11);
+    start = benchNow();
+    for (long i = 0; i < positional_ops; i++) {
+        ullInsertAtPosition(&ull, (int)i, (int)(benchRand() % (uint64_t)(ull.size + 1)));
+        ullDeleteByPosition(&ull, (int)(benchRand() % (uint64_t)ull.size));
+    }
+    benchReport(group, "insert+delete at random (unrolled)", positional_ops, benchNow() - start);
+    benchNote(group, "  unrolled fill after churn: %.1f values per node",
+              (double)ull.size / ull.nodes);
+
+    dllFree(&dll);
+    ullFree(&ull);
+}
+
+/**
+ * Times a full-length (missing value) search on pooled LinkedList and
+ * DoublyLinkedList, an UnrolledLinkedList and a flat DynamicArray scan,
+ * for 1K to 100M values, and reports the cost per value.
+ * Aborts if a search misses a value that is in the list.
+ */
+void benchListSearch(void) {
+    const char *group = "list_search";
+    long max_n = benchSize(100000000);
+    long budget = 200000000;
+    char name[64];
+
+    for (long n = 1000; n <= max_n && n <= INT_MAX; n *= 10) {
+        long searches = budget / n > 0 ? budget / n : 1;
+        int last = (int)n - 1;
+        long found = 0;
+        double start;
+
+        DynamicArray arr;
+        daInit(&arr, (int)n);
+        for (long i = 0; i < n; i++) daPushBack(&arr, (int)i);
+        start = benchNow();
+        for (long s = 0; s < searches; s++) found += daFind(&arr, -1) >= 0;
+        snprintf(name, sizeof(name), "daFind (%ld)", n);
+        benchReport(group, name, searches * n, benchNow() - start);
+        found += daFind(&arr, last) < 0;
+        daFree(&arr);
+
+        LinkedList ll;
+        llInitPooled(&ll, 4096);
+        for (long i = 0; i < n; i++) llInsertAtTail(&ll, (int)i);
+        start = benchNow();
+        for (long s = 0; s < searches; s++) found += llSearchIterative(&ll, -1);
+        snprintf(name, sizeof(name), "llSearchIterative (%ld)", n);
+        benchReport(group, name, searches * n, benchNow() - start);
+        start = benchNow();
+        for (long s = 0; s < searches; s++) found += llSearchRecursive(ll.head, -1);
+        snprintf(name, sizeof(name), "llSearchRecursive (%ld)", n);
+        benchReport(group, name, searches * n, benchNow() - start);
+        found += !llSearchIterative(&ll, last) + !llSearchRecursive(ll.head, last);
+        llFree(&ll);
+
+        DoublyLinkedList dll;
+        dllInitPooled(&dll, 4096);
+        for (long i = 0; i < n; i++) dllInsertAtTail(&dll, (int)i);
+        start = benchNow();
+        for (long s = 0; s < searches; s++) found += dllSearchIterative(&dll, -1);
+        snprintf(name, sizeof(name), "dllSearchIterative (%ld)", n);
+        benchReport(group, name, searches * n, benchNow() - start);
+        found += !dllSearchIterative(&dll, last) + !dllSearchRecursive(dll.head, last);
+        dllFree(&dll);
+
+        UnrolledLinkedList ull;
+        ullInit(&ull);
+        for (long i = 0; i < n; i++) ullInsertAtTail(&ull, (int)i);
+        start = benchNow();
+        for (long s = 0; s < searches; s++) found += ullSearchIterative(&ull, -1);
+        snprintf(name, sizeof(name), "ullSearchIterative (%ld)", n);
+        benchReport(group, name, searches * n, benchNow() - start);
+        found += !ullSearchIterative(&ull, last);
+        ullFree(&ull);
+
+        if (found != 0) {
+            fprintf(stderr, "Error: list search returned a wrong result\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+}
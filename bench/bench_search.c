@@ -0,0 +1,495 @@
+/**
+ * @file bench_search.c
+ * @brief Benchmarks of the binary search functions.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+
+#include "bench.h"
+#include "searching_sorting/binary_search.h"
+#include "searching_sorting/search_index.h"
+#include "searching_sorting/batch_search.h"
+#include "searching_sorting/interpolation_search.h"
+#include "searching_sorting/exponential_search.h"
+#include "searching_sorting/learned_index.h"
+
+/**
+ * Times random hit/miss lookups with both binary search variants
+ * on a sorted array of even numbers.
+ */
+void benchBinarySearch(void) {
+    const char *group = "binary_search";
+    long n = benchSize(1000000);
+    long lookups = benchSize(1000000);
+    int *arr = malloc(sizeof(int) * n);
+    int *targets = malloc(sizeof(int) * lookups);
+    double start;
+
+    if (arr == NULL || targets == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+
+    for (long i = 0; i < n; i++) {
+        arr[i] = (int)(2 * i);
+    }
+    for (long i = 0; i < lookups; i++) {
+        targets[i] = (int)(benchRand() % (uint64_t)(2 * n));
+    }
+
+    long sum = 0;
+    start = benchNow();
+    for (long i = 0; i < lookups; i++) {
+        sum += binarySearchIterative(arr, (int)n, targets[i]);
+    }
+    benchReport(group, "binarySearchIterative", lookups, benchNow() - start);
+
+    start = benchNow();
+    for (long i = 0; i < lookups; i++) {
+        sum += binarySearchRecursive(arr, 0, (int)n - 1, targets[i]);
+    }
+    benchReport(group, "binarySearchRecursive", lookups, benchNow() - start);
+    benchSink = sum;
+
+    free(arr);
+    free(targets);
+}
+
+/**
+ * Sweeps array sizes from L1-resident (1K ints) up to 64M ints (256 MB;
+ * raise with --scale) and times every binary search kernel on the same
+ * random lookups. Aborts if a kernel disagrees with binarySearchIterative.
+ */
+void benchSearchKernels(void) {
+    const char *group = "search_kernels";
+    long max_n = benchSize(64L * 1024 * 1024);
+    long lookups = 1000000;
+    struct {
+        const char *name;
+        int (*search)(int arr[], int size, int target);
+    } kernels[] = {
+        {"iterative",  binarySearchIterative},
+        {"branchless", binarySearchBranchless},
+        {"prefetch",   binarySearchPrefetch},
+        {"selector",   binarySearch},
+    };
+    int num_kernels = sizeof(kernels) / sizeof(kernels[0]);
+    int *targets = malloc(sizeof(int) * lookups);
+    int *expected = malloc(sizeof(int) * lookups);
+    char name[64];
+
+    if (targets == NULL || expected == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+
+    for (long n = 1024; n <= max_n && n <= INT_MAX / 2; n *= 4) {
+        int *arr = malloc(sizeof(int) * n);
+        if (arr == NULL) {
+            fprintf(stderr, "Memory allocation failed\n");
+            exit(EXIT_FAILURE);
+        }
+
+        for (long i = 0; i < n; i++) {
+            arr[i] = (int)(2 * i);
+        }
+        for (long i = 0; i < lookups; i++) {
+            targets[i] = (int)(benchRand() % (uint64_t)(2 * n));
+            expected[i] = binarySearchIterative(arr, (int)n, targets[i]);
+        }
+
+        for (int k = 0; k < num_kernels; k++) {
+            long sum = 0;
+            double start = benchNow();
+            for (long i = 0; i < lookups; i++) {
+                sum += kernels[k].search(arr, (int)n, targets[i]);
+            }
+            double elapsed = benchNow() - start;
+            benchSink = sum;
+
+            for (long i = 0; i < lookups; i++) {
+                if (kernels[k].search(arr, (int)n, targets[i]) != expected[i]) {
+                    fprintf(stderr, "Error: %s disagrees with binarySearchIterative\n", kernels[k].name);
+                    exit(EXIT_FAILURE);
+                }
+            }
+
+            snprintf(name, sizeof(name), "%s (%ld KB)", kernels[k].name, n * (long)sizeof(int) / 1024);
+            benchReport(group, name, lookups, elapsed);
+        }
+
+        free(arr);
+    }
+
+    free(targets);
+    free(expected);
+}
+
+/**
+ * Compares the Eytzinger and S-tree indexes with binary search on the
+ * sorted array, from 4 KB up to 64 MB (raise with --scale). Reports build
+ * time and lookup throughput; aborts if an index disagrees with
+ * binarySearchIterative.
+ */
+void benchSearchIndex(void) {
+    const char *group = "search_index";
+    long max_n = benchSize(16L * 1024 * 1024);
+    long lookups = 1000000;
+    int *targets = malloc(sizeof(int) * lookups);
+    int *expected = malloc(sizeof(int) * lookups);
+    char name[64];
+
+    if (targets == NULL || expected == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+
+    for (long n = 1024; n <= max_n && n <= INT_MAX / 2; n *= 4) {
+        int *arr = malloc(sizeof(int) * n);
+        EytzingerIndex eytzinger;
+        STreeIndex stree;
+        double start;
+        long sum = 0;
+        long kb = n * (long)sizeof(int) / 1024;
+
+        if (arr == NULL) {
+            fprintf(stderr, "Memory allocation failed\n");
+            exit(EXIT_FAILURE);
+        }
+
+        for (long i = 0; i < n; i++) {
+            arr[i] = (int)(2 * i);
+        }
+        for (long i = 0; i < lookups; i++) {
+            targets[i] = (int)(benchRand() % (uint64_t)(2 * n));
+            expected[i] = binarySearchIterative(arr, (int)n, targets[i]);
+        }
+
+        start = benchNow();
+        eiBuild(&eytzinger, arr, (int)n);
+        double eytzinger_build = benchNow() - start;
+
+        start = benchNow();
+        stiBuild(&stree, arr, (int)n);
+        double stree_build = benchNow() - start;
+
+        benchNote(group, "  %ld KB: build eytzinger %.2f ms, s-tree %.2f ms",
+                  kb, eytzinger_build * 1e3, stree_build * 1e3);
+
+        start = benchNow();
+        for (long i = 0; i < lookups; i++) sum += binarySearchIterative(arr, (int)n, targets[i]);
+        snprintf(name, sizeof(name), "binarySearchIterative (%ld KB)", kb);
+        benchReport(group, name, lookups, benchNow() - start);
+
+        start = benchNow();
+        for (long i = 0; i < lookups; i++) sum += binarySearch(arr, (int)n, targets[i]);
+        snprintf(name, sizeof(name), "binarySearch (%ld KB)", kb);
+        benchReport(group, name, lookups, benchNow() - start);
+
+        start = benchNow();
+        for (long i = 0; i < lookups; i++) sum += eiSearch(&eytzinger, targets[i]);
+        snprintf(name, sizeof(name), "eiSearch (%ld KB)", kb);
+        benchReport(group, name, lookups, benchNow() - start);
+
+        start = benchNow();
+        for (long i = 0; i < lookups; i++) sum += stiSearch(&stree, targets[i]);
+        snprintf(name, sizeof(name), "stiSearch (%ld KB)", kb);
+        benchReport(group, name, lookups, benchNow() - start);
+        benchSink = sum;
+
+        for (long i = 0; i < lookups; i++) {
+            if (eiSearch(&eytzinger, targets[i]) != expected[i] ||
+                stiSearch(&stree, targets[i]) != expected[i]) {
+                fprintf(stderr, "Error: search index disagrees with binarySearchIterative\n");
+                exit(EXIT_FAILURE);
+            }
+        }
+
+        eiFree(&eytzinger);
+        stiFree(&stree);
+        free(arr);
+    }
+
+    free(targets);
+    free(expected);
+}
+
+/**
+ * Compares one-at-a-time lookups with the batched kernels on arrays of
+ * 1M and 16M ints, reporting the speedup over binarySearchIterative.
+ * Aborts if a batch result disagrees with binarySearchIterative.
+ */
+void benchBatchSearch(void) {
+    const char *group = "batch_search";
+    long sizes[] = {benchSize(1L << 20), benchSize(16L << 20)};
+    long lookups = 2000000;
+    int *targets = malloc(sizeof(int) * lookups);
+    int *expected = malloc(sizeof(int) * lookups);
+    int *indices = malloc(sizeof(int) * lookups);
+    char name[64];
+
+    if (targets == NULL || expected == NULL || indices == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+
+    for (int s = 0; s < 2; s++) {
+        long n = sizes[s] < INT_MAX / 2 ? sizes[s] : INT_MAX / 2;
+        int *arr = malloc(sizeof(int) * n);
+        double start, baseline;
+        long sum = 0;
+
+        if (arr == NULL) {
+            fprintf(stderr, "Memory allocation failed\n");
+            exit(EXIT_FAILURE);
+        }
+
+        for (long i = 0; i < n; i++) {
+            arr[i] = (int)(2 * i);
+        }
+        for (long i = 0; i < lookups; i++) {
+            targets[i] = (int)(benchRand() % (uint64_t)(2 * n));
+        }
+
+        start = benchNow();
+        for (long i = 0; i < lookups; i++) {
+            expected[i] = binarySearchIterative(arr, (int)n, targets[i]);
+        }
+        baseline = benchNow() - start;
+        snprintf(name, sizeof(name), "binarySearchIterative (%ldM)", n >> 20);
+        benchReport(group, name, lookups, baseline);
+
+        start = benchNow();
+        for (long i = 0; i < lookups; i++) {
+            sum += binarySearch(arr, (int)n, targets[i]);
+        }
+        snprintf(name, sizeof(name), "binarySearch (%ldM)", n >> 20);
+        benchReport(group, name, lookups, benchNow() - start);
+        benchSink = sum;
+
+        struct {
+            const char *name;
+            void (*search)(int arr[], int size, const int targets[], int indices[], int count);
+        } kernels[] = {
+            {"batch scalar", binarySearchBatchScalar},
+            {"batch avx2",   binarySearchBatchAvx2},
+            {"batch",        binarySearchBatch},
+        };
+
+        for (int k = 0; k < 3; k++) {
+            start = benchNow();
+            kernels[k].search(arr, (int)n, targets, indices, (int)lookups);
+            double elapsed = benchNow() - start;
+
+            snprintf(name, sizeof(name), "%s (%ldM)", kernels[k].name, n >> 20);
+            benchReport(group, name, lookups, elapsed);
+            benchNote(group, "  %.2fx binarySearchIterative", baseline / elapsed);
+
+            for (long i = 0; i < lookups; i++) {
+                if (indices[i] != expected[i]) {
+                    fprintf(stderr, "Error: %s disagrees with binarySearchIterative\n", kernels[k].name);
+                    exit(EXIT_FAILURE);
+                }
+            }
+        }
+
+        free(arr);
+    }
+
+    benchNote(group, "  avx2 kernel %s on this CPU",
+              binarySearchBatchHasAvx2() ? "available" : "not available");
+    free(targets);
+    free(expected);
+    free(indices);
+}
+
+// Distributions of sorted keys used by benchSearchDistributions.
+typedef enum {
+    DIST_UNIFORM,   // evenly spaced with small jitter, like sequence IDs
+    DIST_ZIPFIAN,   // heavy-tailed gaps: most keys packed, a few huge jumps
+    DIST_CLUSTERED  // dense runs of keys separated by large random gaps
+} KeyDistribution;
+
+/**
+ * Fills an array with sorted keys drawn from a distribution and rescales
+ * them into the int range.
+ *
+ * @param arr  the array to fill
+ * @param n    the number of keys
+ * @param dist the distribution of the gaps between consecutive keys
+ */
+static void fillSortedKeys(int *arr, long n, KeyDistribution dist) {
+    double *keys = malloc(sizeof(double) * n);
+    double value = 0;
+
+    if (keys == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+
+    for (long i = 0; i < n; i++) {
+        double u = (double)((benchRand() >> 11) + 1) / 9007199254740993.0;
+        switch (dist) {
+            case DIST_UNIFORM:
+                value += 1.0 + u;
+                break;
+            case DIST_ZIPFIAN:
+                value += 1.0 / u;
+                break;
+            case DIST_CLUSTERED:
+                value += (i % 1000 == 0) ? 1e6 * u : 1.0;
+                break;
+        }
+        keys[i] = value;
+    }
+
+    double scale = (INT_MAX / 2) / keys[n - 1];
+    for (long i = 0; i < n; i++) {
+        arr[i] = (int)(keys[i] * scale);
+    }
+    free(keys);
+}
+
+/**
+ * Times every single-target search on uniform, Zipfian and clustered keys,
+ * with half of the lookups hitting and half drawn from the key range.
+ * Aborts if a search returns a wrong index.
+ */
+void benchSearchDistributions(void) {
+    const char *group = "search_distributions";
+    long n = benchSize(1L << 22);
+    long lookups = 1000000;
+    int *arr = malloc(sizeof(int) * n);
+    int *targets = malloc(sizeof(int) * lookups);
+    const char *dist_names[] = {"uniform", "zipfian", "clustered"};
+    struct {
+        const char *name;
+        int (*search)(int arr[], int size, int target);
+    } kernels[] = {
+        {"binarySearchIterative",         binarySearchIterative},
+        {"binarySearch",                  binarySearch},
+        {"interpolationSearch",           interpolationSearch},
+        {"interpolationSequentialSearch", interpolationSequentialSearch},
+        {"exponentialSearch",             exponentialSearch},
+    };
+    int num_kernels = sizeof(kernels) / sizeof(kernels[0]);
+    char name[64];
+
+    if (arr == NULL || targets == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+
+    for (int d = DIST_UNIFORM; d <= DIST_CLUSTERED; d++) {
+        fillSortedKeys(arr, n, (KeyDistribution)d);
+        for (long i = 0; i < lookups; i++) {
+            targets[i] = (i & 1) ? arr[benchRand() % (uint64_t)n]
+                                 : (int)(benchRand() % (uint64_t)arr[n - 1]);
+        }
+
+        for (int k = 0; k < num_kernels; k++) {
+            long sum = 0;
+            double start = benchNow();
+            for (long i = 0; i < lookups; i++) {
+                sum += kernels[k].search(arr, (int)n, targets[i]);
+            }
+            double elapsed = benchNow() - start;
+            benchSink = sum;
+
+            for (long i = 0; i < lookups; i++) {
+                int index = kernels[k].search(arr, (int)n, targets[i]);
+                bool found = binarySearchIterative(arr, (int)n, targets[i]) != -1;
+                if ((index == -1) == found || (found && arr[index] != targets[i])) {
+                    fprintf(stderr, "Error: %s returned a wrong index\n", kernels[k].name);
+                    exit(EXIT_FAILURE);
+                }
+            }
+
+            snprintf(name, sizeof(name), "%s (%s)", kernels[k].name, dist_names[d]);
+            benchReport(group, name, lookups, elapsed);
+        }
+    }
+
+    free(arr);
+    free(targets);
+}
+
+/**
+ * Compares the learned index with binary search on uniform, Zipfian and
+ * clustered keys, reporting lookup latency, build time and model memory
+ * for several error bounds. Aborts if a lookup returns a wrong index.
+ */
+void benchLearnedIndex(void) {
+    const char *group = "learned_index";
+    long n = benchSize(16L << 20);
+    long lookups = 1000000;
+    int *arr = malloc(sizeof(int) * n);
+    int *targets = malloc(sizeof(int) * lookups);
+    const char *dist_names[] = {"uniform", "zipfian", "clustered"};
+    int epsilons[] = {16, LI_DEFAULT_EPSILON, 256};
+    int num_epsilons = sizeof(epsilons) / sizeof(epsilons[0]);
+    char name[64];
+
+    if (arr == NULL || targets == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+
+    benchNote(group, "  searched array is %ld KB", n * (long)sizeof(int) / 1024);
+
+    for (int d = DIST_UNIFORM; d <= DIST_CLUSTERED; d++) {
+        long sum = 0;
+        double start;
+
+        fillSortedKeys(arr, n, (KeyDistribution)d);
+        for (long i = 0; i < lookups; i++) {
+            targets[i] = (i & 1) ? arr[benchRand() % (uint64_t)n]
+                                 : (int)(benchRand() % (uint64_t)arr[n - 1]);
+        }
+
+        start = benchNow();
+        for (long i = 0; i < lookups; i++) sum += binarySearchIterative(arr, (int)n, targets[i]);
+        snprintf(name, sizeof(name), "binarySearchIterative (%s)", dist_names[d]);
+        benchReport(group, name, lookups, benchNow() - start);
+
+        start = benchNow();
+        for (long i = 0; i < lookups; i++) sum += binarySearch(arr, (int)n, targets[i]);
+        snprintf(name, sizeof(name), "binarySearch (%s)", dist_names[d]);
+        benchReport(group, name, lookups, benchNow() - start);
+
+        for (int e = 0; e < num_epsilons; e++) {
+            LearnedIndex index;
+
+            start = benchNow();
+            liBuild(&index, arr, (int)n, epsilons[e]);
+            double build = benchNow() - start;
+
+            start = benchNow();
+            for (long i = 0; i < lookups; i++) sum += liSearch(&index, targets[i]);
+            snprintf(name, sizeof(name), "liSearch eps=%d (%s)", epsilons[e], dist_names[d]);
+            benchReport(group, name, lookups, benchNow() - start);
+            benchNote(group, "  eps=%d: %d segments in %d levels, %.1f KB model, built in %.2f ms",
+                      epsilons[e], index.count, index.depth,
+                      liMemoryUsage(&index) / 1024.0, build * 1e3);
+
+            for (long i = 0; i < lookups; i++) {
+                int found = liSearch(&index, targets[i]);
+                int expected = binarySearchIterative(arr, (int)n, targets[i]);
+                if ((found == -1) != (expected == -1) || (found != -1 && arr[found] != targets[i])) {
+                    fprintf(stderr, "Error: liSearch disagrees with binarySearchIterative\n");
+                    exit(EXIT_FAILURE);
+                }
+            }
+            liFree(&index);
+        }
+        benchSink = sum;
+    }
+
+    free(arr);
+    free(targets);
+}
@@ -0,0 +1,349 @@
+/**
+ * @file bench_sort.c
+ * @brief Benchmarks of the in-memory sorts against qsort and of the external sort.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <unistd.h>
+
+#include "bench.h"
+#include "searching_sorting/sort.h"
+#include "searching_sorting/external_sort.h"
+
+// Structure to represent a 16-byte record sorted by key.
+typedef struct {
+    int key;        // sort key
+    int payload[3]; // carried along with the key
+} SortRecord;
+
+/**
+ * Comparator of ints for qsort and genericSort.
+ */
+static int compareInts(const void *a, const void *b) {
+    int x = *(const int *)a;
+    int y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * Comparator of SortRecords by key.
+ */
+static int compareRecords(const void *a, const void *b) {
+    return compareInts(&((const SortRecord *)a)->key, &((const SortRecord *)b)->key);
+}
+
+/**
+ * Helper function to fill the payload of a SortRecord from its key, so a
+ * sorted record can be checked to still carry its own payload.
+ *
+ * @param record the record, with its key set
+ */
+static void recordPayload(SortRecord *record) {
+    unsigned key = (unsigned)record->key;
+    record->payload[0] = (int)(key ^ 0x9e3779b9u);
+    record->payload[1] = (int)~key;
+    record->payload[2] = (int)(key * 2654435761u);
+}
+
+/**
+ * Helper function to abort unless two int arrays are identical.
+ *
+ * @param sorted   the array under test
+ * @param expected the reference result
+ * @param n        the number of elements
+ * @param label    the sort being checked
+ */
+static void checkSorted(const int *sorted, const int *expected, long n, const char *label) {
+    if (memcmp(sorted, expected, sizeof(int) * n) != 0) {
+        fprintf(stderr, "Error: %s produced a different order than qsort\n", label);
+        exit(EXIT_FAILURE);
+    }
+}
+
+/**
+ * Sorts the same random ints with qsort, introSort, radixSort and
+ * parallelSort, plus 16-byte records in a GenericArray with gaSort and
+ * qsort. Aborts if a sort disagrees with qsort.
+ */
+void benchSort(void) {
+    const char *group = "sort";
+    long n = benchSize(10000000);
+    int *input = malloc(sizeof(int) * n);
+    int *expected = malloc(sizeof(int) * n);
+    int *work = malloc(sizeof(int) * n);
+    double start;
+
+    if (input == NULL || expected == NULL || work == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+
+    for (long i = 0; i < n; i++) input[i] = (int)benchRand();
+
+    memcpy(expected, input, sizeof(int) * n);
+    start = benchNow();
+    qsort(expected, n, sizeof(int), compareInts);
+    benchReport(group, "qsort (int)", n, benchNow() - start);
+
+    memcpy(work, input, sizeof(int) * n);
+    start = benchNow();
+    introSort(work, (int)n);
+    benchReport(group, "introSort", n, benchNow() - start);
+    checkSorted(work, expected, n, "introSort");
+
+    memcpy(work, input, sizeof(int) * n);
+    start = benchNow();
+    radixSort(work, (int)n);
+    benchReport(group, "radixSort", n, benchNow() - start);
+    checkSorted(work, expected, n, "radixSort");
+
+    memcpy(work, input, sizeof(int) * n);
+    start = benchNow();
+    parallelSort(work, (int)n, 0);
+    benchReport(group, "parallelSort (all CPUs)", n, benchNow() - start);
+    checkSorted(work, expected, n, "parallelSort");
+
+    // Already sorted input is a classic quicksort worst case without good pivots.
+    start = benchNow();
+    introSort(work, (int)n);
+    benchReport(group, "introSort (sorted input)", n, benchNow() - start);
+    checkSorted(work, expected, n, "introSort");
+
+    long records = n / 4;
+    GenericArray g;
+    SortRecord *copy = malloc(sizeof(SortRecord) * records);
+
+    if (copy == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+
+    gaInit(&g, sizeof(SortRecord), (int)records);
+    for (long i = 0; i < records; i++) {
+        SortRecord r = {input[i], {(int)i, 0, 0}};
+        gaPushBack(&g, &r);
+    }
+    memcpy(copy, g.data, sizeof(SortRecord) * records);
+
+    start = benchNow();
+    qsort(copy, records, sizeof(SortRecord), compareRecords);
+    benchReport(group, "qsort (16B records)", records, benchNow() - start);
+
+    start = benchNow();
+    gaSort(&g, compareRecords);
+    benchReport(group, "gaSort (16B records)", records, benchNow() - start);
+
+    for (long i = 0; i < records; i++) {
+        if (((SortRecord *)g.data)[i].key != copy[i].key) {
+            fprintf(stderr, "Error: gaSort produced a different order than qsort\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    gaFree(&g);
+    free(copy);
+    free(input);
+    free(expected);
+    free(work);
+}
+
+/**
+ * Times parallelSort with 1, 2, 4, 8 and 16 threads on the same random
+ * ints and reports the speedup over one thread (a plain radix sort), which
+ * only exceeds 1 with at least as many CPUs as threads.
+ */
+void benchParallelSort(void) {
+    const char *group = "parallel_sort";
+    long n = benchSize(20000000);
+    int *input = malloc(sizeof(int) * n);
+    int *work = malloc(sizeof(int) * n);
+    int *expected = malloc(sizeof(int) * n);
+    double single = 0;
+    char name[64];
+
+    if (input == NULL || work == NULL || expected == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+
+    for (long i = 0; i < n; i++) input[i] = (int)benchRand();
+    memcpy(expected, input, sizeof(int) * n);
+    radixSort(expected, (int)n);
+    benchNote(group, "  %ld CPUs online", sysconf(_SC_NPROCESSORS_ONLN));
+
+    for (int threads = 1; threads <= 16; threads *= 2) {
+        memcpy(work, input, sizeof(int) * n);
+        double start = benchNow();
+        parallelSort(work, (int)n, threads);
+        double elapsed = benchNow() - start;
+        checkSorted(work, expected, n, "parallelSort");
+
+        if (threads == 1) single = elapsed;
+        snprintf(name, sizeof(name), "parallelSort (%d threads)", threads);
+        benchReport(group, name, n, elapsed);
+        benchNote(group, "  speedup over 1 thread: %.2fx", single / elapsed);
+    }
+
+    free(input);
+    free(work);
+    free(expected);
+}
+
+/**
+ * Sorts a file of random ints with externalSortInts under two memory
+ * budgets (one merge pass, and several) and reports MB/s of input next to
+ * the sequential read and write bandwidth of the same file. The raw
+ * numbers include the page cache, as does the sort. Then sorts the same
+ * volume of 16-byte SortRecords with externalSort and compareRecords.
+ * Aborts if an output is not the sorted input, or if a record's payload
+ * no longer matches its key.
+ */
+void benchExternalSort(void) {
+    const char *group = "external_sort";
+    long n = benchSize(64L << 20);
+    size_t budgets[] = {64u << 20, 4u << 20};
+    size_t block = 1 << 20;
+    int *buffer = malloc(block);
+    char input_path[256], output_path[256];
+    long long input_sum = 0;
+    double start, elapsed;
+
+    if (buffer == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    benchTempPath(input_path, sizeof(input_path), "in");
+    benchTempPath(output_path, sizeof(output_path), "out");
+
+    double mb = n * (double)sizeof(int) / (1 << 20);
+    long per_block = (long)(block / sizeof(int));
+
+    FILE *file = fopen(input_path, "wb");
+    if (file == NULL) {
+        fprintf(stderr, "Error: cannot open %s\n", input_path);
+        exit(EXIT_FAILURE);
+    }
+    start = benchNow();
+    for (long written = 0; written < n; written += per_block) {
+        long count = n - written < per_block ? n - written : per_block;
+        for (long i = 0; i < count; i++) {
+            buffer[i] = (int)benchRand();
+            input_sum += buffer[i];
+        }
+        fwrite(buffer, sizeof(int), count, file);
+    }
+    fclose(file);
+    elapsed = benchNow() - start;
+    benchNote(group, "  %.0f MB input; sequential write %.0f MB/s (incl. generation)", mb, mb / elapsed);
+
+    file = fopen(input_path, "rb");
+    start = benchNow();
+    while (fread(buffer, 1, block, file) > 0) {}
+    elapsed = benchNow() - start;
+    fclose(file);
+    benchNote(group, "  sequential read %.0f MB/s", mb / elapsed);
+
+    for (int b = 0; b < 2; b++) {
+        char name[64];
+
+        start = benchNow();
+        if (externalSortInts(input_path, output_path, budgets[b], 0) != 0) {
+            fprintf(stderr, "Error: externalSortInts failed\n");
+            exit(EXIT_FAILURE);
+        }
+        elapsed = benchNow() - start;
+        snprintf(name, sizeof(name), "externalSortInts (%zu MB memory)", budgets[b] >> 20);
+        benchReport(group, name, n, elapsed);
+        benchNote(group, "  %.0f MB/s", mb / elapsed);
+
+        // Stream the output back and check order, length and sum.
+        long long output_sum = 0;
+        long count = 0;
+        int previous = INT_MIN;
+        size_t got;
+        file = fopen(output_path, "rb");
+        while (file != NULL && (got = fread(buffer, sizeof(int), per_block, file)) > 0) {
+            for (size_t i = 0; i < got; i++) {
+                if (buffer[i] < previous) count = -n;
+                previous = buffer[i];
+                output_sum += buffer[i];
+            }
+            count += (long)got;
+        }
+        if (file != NULL) fclose(file);
+        if (count != n || output_sum != input_sum) {
+            fprintf(stderr, "Error: externalSortInts output is not the sorted input\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    // The same volume again as 16-byte records, through the comparator path.
+    SortRecord *records = (SortRecord *)buffer;
+    long record_count = n / 4;
+    long per_record_block = (long)(block / sizeof(SortRecord));
+    long long key_sum = 0;
+
+    file = fopen(input_path, "wb");
+    if (file == NULL) {
+        fprintf(stderr, "Error: cannot open %s\n", input_path);
+        exit(EXIT_FAILURE);
+    }
+    for (long written = 0; written < record_count; written += per_record_block) {
+        long count = record_count - written < per_record_block ? record_count - written : per_record_block;
+        for (long i = 0; i < count; i++) {
+            records[i].key = (int)benchRand();
+            recordPayload(&records[i]);
+            key_sum += records[i].key;
+        }
+        fwrite(records, sizeof(SortRecord), count, file);
+    }
+    fclose(file);
+
+    for (int b = 0; b < 2; b++) {
+        char name[64];
+
+        start = benchNow();
+        if (externalSort(input_path, output_path, sizeof(SortRecord), compareRecords, budgets[b], 0) != 0) {
+            fprintf(stderr, "Error: externalSort failed\n");
+            exit(EXIT_FAILURE);
+        }
+        elapsed = benchNow() - start;
+        snprintf(name, sizeof(name), "externalSort 16-byte records (%zu MB memory)", budgets[b] >> 20);
+        benchReport(group, name, record_count, elapsed);
+        benchNote(group, "  %.0f MB/s", mb / elapsed);
+
+        // Check order, length and key sum, and that every payload still matches its key.
+        long long output_sum = 0;
+        long count = 0;
+        int previous = INT_MIN;
+        size_t got;
+        file = fopen(output_path, "rb");
+        while (file != NULL && (got = fread(records, sizeof(SortRecord), per_record_block, file)) > 0) {
+            for (size_t i = 0; i < got; i++) {
+                SortRecord expected = records[i];
+                recordPayload(&expected);
+                if (records[i].key < previous || memcmp(&expected, &records[i], sizeof(SortRecord)) != 0) {
+                    count = -record_count;
+                }
+                previous = records[i].key;
+                output_sum += records[i].key;
+            }
+            count += (long)got;
+        }
+        if (file != NULL) fclose(file);
+        if (count != record_count || output_sum != key_sum) {
+            fprintf(stderr, "Error: externalSort output is not the sorted input\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    remove(input_path);
+    remove(output_path);
+    free(buffer);
+}
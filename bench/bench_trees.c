@@ -0,0 +1,219 @@
+/**
+ * @file bench_trees.c
+ * @brief Benchmarks of the B+-tree against a sorted DynamicArray.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "arrays/dynamic_array.h"
+#include "searching_sorting/binary_search.h"
+#include "trees/bplus_tree.h"
+
+// Keys covered by the short and long range scans (even keys only, so half are present).
+#define SHORT_RANGE 128
+#define LONG_RANGE 8192
+
+/**
+ * Helper function to find where a key belongs in a sorted array
+ * (binarySearchIterative only reports keys that are present).
+ *
+ * @param arr  the sorted array
+ * @param size number of elements
+ * @param key  the key
+ * @return the index of the first element >= key
+ */
+static int lowerBound(const int *arr, int size, int key) {
+    int low = 0;
+    int high = size;
+
+    while (low < high) {
+        int mid = low + (high - low) / 2;
+        if (arr[mid] < key) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+/**
+ * Helper function to copy the keys of a sorted array in [low, high] to
+ * the end of a dynamic array, the sorted-array counterpart of bptRange.
+ *
+ * @param arr  the sorted array
+ * @param low  smallest key of the range
+ * @param high largest key of the range
+ * @param out  the array the keys are appended to
+ * @return the number of keys appended
+ */
+static int sortedRange(DynamicArray *arr, int low, int high, DynamicArray *out) {
+    int first = lowerBound(arr->data, arr->size, low);
+    int last = lowerBound(arr->data, arr->size, high + 1);
+    int run = last - first;
+
+    if (out->size + run > out->capacity) daResize(out, out->size + run);
+    memcpy(out->data + out->size, arr->data + first, sizeof(int) * (size_t)run);
+    out->size += run;
+    return run;
+}
+
+/**
+ * Times a B+-tree against a sorted DynamicArray holding the same even
+ * keys 0, 2, ..., 2n - 2: bulk load, point lookups (binarySearch against
+ * bptGet), short and long range scans copied out (and walked with a
+ * cursor), random inserts of odd keys (lowerBound + daInsertAt against
+ * bptInsert) and erasing the inserted keys again. The array does fewer
+ * inserts and erases, since every one of them shifts half the array.
+ * The default is n = 1M keys; --scale changes n.
+ */
+void benchBPlusTree(void) {
+    const char *group = "bplus_tree";
+    long n = benchSize(1 << 20);
+    long lookups = n;
+    long updates = benchSize(1 << 16);
+    long array_updates = updates / 16 > 0 ? updates / 16 : 1;
+    long ranges = benchSize(1 << 16);
+    static const int widths[] = {SHORT_RANGE, LONG_RANGE};
+    DynamicArray sorted, out;
+    BPlusTree tree;
+    char op[64];
+    double start;
+    long found = 0;
+
+    int *targets = malloc(sizeof(int) * (size_t)lookups);
+    int *inserts = malloc(sizeof(int) * (size_t)updates);
+    if (targets == NULL || inserts == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    daInit(&sorted, (int)n);
+    daInit(&out, LONG_RANGE);
+    for (long i = 0; i < n; i++) {
+        daPushBack(&sorted, (int)(2 * i));
+    }
+    for (long i = 0; i < lookups; i++) {
+        targets[i] = (int)(2 * (benchRand() % (uint64_t)n));
+    }
+    for (long i = 0; i < updates; i++) {
+        inserts[i] = (int)(2 * (benchRand() % (uint64_t)n) + 1);
+    }
+    benchNote(group, "%ld keys, %d keys per node", n, BPT_NODE_KEYS);
+
+    bptInit(&tree);
+    start = benchNow();
+    bptBulkLoad(&tree, &sorted, NULL);
+    benchReport(group, "B+-tree: bulk load (per key)", n, benchNow() - start);
+    benchNote(group, "height %d after bulk load", tree.height);
+
+    // Point lookups.
+    start = benchNow();
+    for (long i = 0; i < lookups; i++) {
+        found += binarySearchIterative(sorted.data, sorted.size, targets[i]) >= 0;
+    }
+    benchReport(group, "sorted array: binarySearchIterative hit", lookups, benchNow() - start);
+
+    start = benchNow();
+    for (long i = 0; i < lookups; i++) {
+        found += binarySearch(sorted.data, sorted.size, targets[i]) >= 0;
+    }
+    benchReport(group, "sorted array: binarySearch hit", lookups, benchNow() - start);
+
+    start = benchNow();
+    for (long i = 0; i < lookups; i++) {
+        found += bptContains(&tree, targets[i]);
+    }
+    benchReport(group, "B+-tree: get hit", lookups, benchNow() - start);
+
+    start = benchNow();
+    for (long i = 0; i < lookups; i++) {
+        found += bptContains(&tree, targets[i] + 1);
+    }
+    benchReport(group, "B+-tree: get miss", lookups, benchNow() - start);
+
+    // Range scans: copy the keys out, and walk them with a cursor.
+    for (int w = 0; w < 2; w++) {
+        long scanned = 0;
+        long range_count = widths[w] == LONG_RANGE ? (ranges / 16 > 0 ? ranges / 16 : 1) : ranges;
+
+        start = benchNow();
+        for (long i = 0; i < range_count; i++) {
+            out.size = 0;
+            scanned += sortedRange(&sorted, targets[i], targets[i] + widths[w] - 1, &out);
+        }
+        snprintf(op, sizeof(op), "sorted array: range copy (%d wide)", widths[w]);
+        benchReport(group, op, range_count, benchNow() - start);
+
+        start = benchNow();
+        for (long i = 0; i < range_count; i++) {
+            out.size = 0;
+            scanned -= bptRange(&tree, targets[i], targets[i] + widths[w] - 1, &out);
+        }
+        snprintf(op, sizeof(op), "B+-tree: range copy (%d wide)", widths[w]);
+        benchReport(group, op, range_count, benchNow() - start);
+        if (scanned != 0) {
+            benchNote(group, "range scans disagree by %ld keys", scanned);
+        }
+
+        long sum = 0;
+        start = benchNow();
+        for (long i = 0; i < range_count; i++) {
+            int high = targets[i] + widths[w] - 1;
+            for (BPTCursor c = bptSeek(&tree, targets[i]); bptCursorValid(&c) && bptCursorKey(&c) <= high; bptCursorNext(&c)) {
+                sum += bptCursorKey(&c);
+            }
+        }
+        snprintf(op, sizeof(op), "B+-tree: range cursor (%d wide)", widths[w]);
+        benchReport(group, op, range_count, benchNow() - start);
+        found += sum;
+    }
+
+    // Inserts of odd keys (duplicates just replace the value).
+    start = benchNow();
+    for (long i = 0; i < array_updates; i++) {
+        int pos = lowerBound(sorted.data, sorted.size, inserts[i]);
+        if (pos == sorted.size || sorted.data[pos] != inserts[i]) daInsertAt(&sorted, pos, inserts[i]);
+    }
+    benchReport(group, "sorted array: lowerBound + daInsertAt", array_updates, benchNow() - start);
+
+    start = benchNow();
+    for (long i = 0; i < updates; i++) {
+        bptInsert(&tree, inserts[i], (int)i);
+    }
+    benchReport(group, "B+-tree: insert", updates, benchNow() - start);
+
+    // Erase the inserted keys again.
+    start = benchNow();
+    for (long i = 0; i < array_updates; i++) {
+        int pos = lowerBound(sorted.data, sorted.size, inserts[i]);
+        if (pos < sorted.size && sorted.data[pos] == inserts[i]) daRemoveAt(&sorted, pos);
+    }
+    benchReport(group, "sorted array: lowerBound + daRemoveAt", array_updates, benchNow() - start);
+
+    start = benchNow();
+    for (long i = 0; i < updates; i++) {
+        found += bptErase(&tree, inserts[i]);
+    }
+    benchReport(group, "B+-tree: erase", updates, benchNow() - start);
+
+    bptFree(&tree);
+    bptInit(&tree);
+    start = benchNow();
+    for (long i = 0; i < lookups; i++) {
+        bptInsert(&tree, targets[i], (int)i);
+    }
+    benchReport(group, "B+-tree: insert into empty tree", lookups, benchNow() - start);
+
+    benchSink = found + bptSize(&tree);
+    bptFree(&tree);
+    daFree(&sorted);
+    daFree(&out);
+    free(targets);
+    free(inserts);
+}
@@ -0,0 +1,34 @@
+/**
+ * @file binary_search_demo.c
+ * @brief Walkthrough of the iterative and recursive binary search.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#include <stdio.h>
+
+#include "searching_sorting/binary_search.h"
+
+int main() {
+    // Sample sorted array
+    int arr[] = {1, 3 ,5, 7, 9, 11, 13};
+    int size = sizeof(arr) / sizeof(arr[0]);
+
+    // Sample targets to test
+    int targets[] = {7, 2, 11, 14};
+    int num_tests = sizeof(targets) / sizeof(targets[0]);
+
+    printf("Testing binary search:\n");
+
+    for (int i = 0; i < num_tests; i++) {
+        int target = targets[i];
+        int index_iter = binarySearchIterative(arr, size, target);
+        int index_rec = binarySearchRecursive(arr, 0, size -1, target);
+
+        printf("Target %d: Iterative index = %d, Recurisve index = %d\n",
+                target, index_iter, index_rec);
+    }
+    
+    return 0;
+}
@@ -0,0 +1,69 @@
+/**
+ * @file doubly_linked_list_demo.c
+ * @brief Walkthrough of the DoublyLinkedList operations.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#include <stdio.h>
+
+#include "linked_lists/doubly_linked_list.h"
+
+int main() {
+    DoublyLinkedList list;
+    dllInit(&list);
+
+    printf("Initializing and printing an empty DoublyLinkedList:\n");
+    dllPrint(&list);
+    printf("isEmpty: %s\n", dllIsEmpty(&list) ? "True" : "False");
+
+    printf("Adding elements 0-9 to the list:\n");
+    for (int i = 0; i < 10; i++) {
+        dllInsertAtTail(&list, i);
+    }
+    dllPrint(&list);
+    printf("Size of the list: %d\n", dllGetLength(&list));
+
+    printf("Inserting 99 at the head:\n");
+    dllInsertAtHead(&list, 99);
+    dllPrint(&list);
+
+    printf("Inserting 88 at the tail:\n");
+    dllInsertAtTail(&list, 88);
+    dllPrint(&list);
+
+    printf("Inserting 77 at index 5:\n");
+    dllInsertAtPosition(&list, 77, 5);
+    dllPrint(&list);
+
+    printf("Deleting value 77:\n");
+    dllDeleteByValue(&list, 77);
+    dllPrint(&list);
+
+    printf("Deleting head:\n");
+    dllDeleteHead(&list);
+    dllPrint(&list);
+
+    printf("Deleting tail:\n");
+    dllDeleteTail(&list);
+    dllPrint(&list);
+
+    printf("Deleting node at index 4:\n");
+    dllDeleteByPosition(&list, 4);
+    dllPrint(&list);
+
+    printf("Searching for value 6 (iterative): %s\n", dllSearchIterative(&list, 6) ? "True" : "False");
+    printf("Searching for value 6 (recursive): %s\n", dllSearchRecursive(list.head, 6) ? "True" : "False");
+
+    printf("Printing the list in reverse:\n");
+    dllPrintReverse(&list);
+
+    printf("Freeing the list:\n");
+    dllFree(&list);
+    dllPrint(&list);
+    printf("isEmpty: %s\n", dllIsEmpty(&list) ? "True" : "False");
+
+    return 0;
+}
+
@@ -0,0 +1,52 @@
+/**
+ * @file dynamic_array_demo.c
+ * @brief Walkthrough of the DynamicArray operations.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#include <stdio.h>
+
+#include "arrays/dynamic_array.h"
+
+int main () {
+    DynamicArray arr;
+    daInit(&arr, 10);
+
+    printf("Initializing and printing an empty DynamicArray of size 10: \n");
+    daPrint(&arr);
+    printf("isEmpty: %s\n", daIsEmpty(&arr) ? "true" : "false");
+
+    printf("Adding elements to the array:\n");
+    for (int i = 0 ; i < 10; i++) {
+        daPushBack(&arr, i);
+    }
+    daPrint(&arr);
+
+    printf("Size of the DynamicArray: %d\n", daSize(&arr));
+
+    printf("Popping an element from the back:\n");
+    int back = daPopBack(&arr);
+    daPrint(&arr);
+
+    printf("Adding the element back in the middle:\n");
+    daInsertAt(&arr, 4, back);
+    daPrint(&arr);
+
+    printf("Removing the element again:\n");
+    daRemoveAt(&arr, 4);
+    daPrint(&arr);
+
+    printf("Getting element at index 0\n");
+    int x = daGet(&arr, 0);
+
+    printf("Adding two values to the back to test resize:\n");
+    daPushBack(&arr, 9);
+    daPushBack(&arr, x);
+    daPrint(&arr);
+
+    daFree(&arr);
+
+    return 0;
+}
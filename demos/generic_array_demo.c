@@ -0,0 +1,64 @@
+/**
+ * @file generic_array_demo.c
+ * @brief Walkthrough of the GenericArray operations using an array of chars.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#include <stdio.h>
+
+#include "arrays/generic_array.h"
+
+/**
+ * Print function for elements of type char.
+ * 
+ * @param elem pointer to the element to print
+ */
+void printChar(void *elem) {
+    printf("%c", *(char *)elem);
+}
+
+int main() {
+    GenericArray arr;
+    gaInit(&arr, sizeof(char), 10);
+
+    printf("Initializing and printing an empty GenericArray of chars:\n");
+    gaPrint(&arr, printChar);
+    printf("isEmpty: %s\n", gaIsEmpty(&arr) ? "true" : "false");
+
+    printf("Adding elements to the array:\n");
+    for (char c = 'a'; c < 'a' + 10; c++) {
+        gaPushBack(&arr, &c);
+    }
+    gaPrint(&arr, printChar);
+
+    printf("Size of the GenericArray: %d\n", gaSize(&arr));
+
+    printf("Popping an element from the back:\n");
+    char back;
+    gaPopBack(&arr, &back);
+    gaPrint(&arr, printChar);
+
+    printf("Adding the popped element '%c' back in the middle:\n", back);
+    gaInsertAt(&arr, 4, &back);
+    gaPrint(&arr, printChar);
+
+    printf("Removing the element again:\n");
+    gaRemoveAt(&arr, 4);
+    gaPrint(&arr, printChar);
+
+    printf("Getting element at index 0:\n");
+    char x;
+    gaGet(&arr, 0, &x);
+    printf("Element at index 0: '%c'\n", x);
+
+    printf("Adding two values to the back to test resize:\n");
+    gaPushBack(&arr, &back);
+    gaPushBack(&arr, &x);
+    gaPrint(&arr, printChar);
+
+    gaFree(&arr);
+
+    return 0;
+}
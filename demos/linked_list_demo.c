@@ -0,0 +1,46 @@
+/**
+ * @file linked_list_demo.c
+ * @brief Walkthrough of the LinkedList operations.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#include <stdio.h>
+
+#include "linked_lists/linked_list.h"
+
+int main() {
+    LinkedList list;
+    llInit(&list);
+
+    printf("Initializing and printing en empty LinkedList:\n");
+    llPrint(&list);
+    printf("isEmpty: %s\n", llIsEmpty(&list) ? "True" : "False");
+
+    printf("Adding elements to the list:\n");
+    for (int i = 0; i < 10; i++) {
+        llInsertAtTail(&list, i);
+    }
+    llPrint(&list);
+
+    printf("Size of the list: %d\n", llGetLength(&list));
+
+    printf("Removing value 9 & node at index 4:\n");
+    llDeleteByValue(&list, 9);
+    llDeleteByPosition(&list, 4);
+    llPrint(&list);
+
+    printf("Inserting value at head and also at index 4:\n");
+    llInsertAtHead(&list, 9);
+    llInsertAtPosition(&list, 4, 4);
+    llPrint(&list);
+
+    printf("Searching for value 6 iteratively:\n Found? (T/F): %s\n", llSearchIterative(&list, 6) ? "True" : "False");
+    printf("Searching for value 6 recursively:\n Found? (T/F): %s\n", llSearchRecursive(list.head, 6) ? "True" : "False");
+
+    printf("Printing the list in reverse:\n");
+    llPrintReverse(list.head);
+    
+    return 0;
+}
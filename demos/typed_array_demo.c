@@ -0,0 +1,65 @@
+/**
+ * @file typed_array_demo.c
+ * @brief Walkthrough of a DEFINE_ARRAY array specialized for a point struct.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#include <stdio.h>
+
+#include "arrays/typed_array.h"
+
+// Structure to represent a 2D point.
+typedef struct {
+    int x; // horizontal coordinate
+    int y; // vertical coordinate
+} Point;
+
+DEFINE_ARRAY(PointArray, pa, Point)
+
+/**
+ * Print function for elements of type Point.
+ * 
+ * @param p the point to print
+ */
+void printPoint(Point p) {
+    printf("(%d,%d)", p.x, p.y);
+}
+
+int main() {
+    PointArray arr;
+    paInit(&arr, 4);
+
+    printf("Initializing and printing an empty PointArray:\n");
+    paPrint(&arr, printPoint);
+    printf("isEmpty: %s\n", paIsEmpty(&arr) ? "true" : "false");
+
+    printf("Adding points to the array:\n");
+    for (int i = 0; i < 6; i++) {
+        paPushBack(&arr, (Point){i, i * i});
+    }
+    paPrint(&arr, printPoint);
+
+    printf("Size of the PointArray: %d\n", paSize(&arr));
+
+    printf("Popping a point from the back:\n");
+    Point back = paPopBack(&arr);
+    paPrint(&arr, printPoint);
+
+    printf("Adding the popped point back at index 2:\n");
+    paInsertAt(&arr, 2, back);
+    paPrint(&arr, printPoint);
+
+    printf("Removing the point again:\n");
+    paRemoveAt(&arr, 2);
+    paPrint(&arr, printPoint);
+
+    printf("Getting point at index 1: ");
+    printPoint(paGet(&arr, 1));
+    printf("\n");
+
+    paFree(&arr);
+
+    return 0;
+}
@@ -0,0 +1,69 @@
+/**
+ * @file unrolled_linked_list_demo.c
+ * @brief Walkthrough of the UnrolledLinkedList operations.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#include <stdio.h>
+
+#include "linked_lists/unrolled_linked_list.h"
+
+int main() {
+    UnrolledLinkedList list;
+    ullInit(&list);
+
+    printf("Initializing and printing an empty UnrolledLinkedList:\n");
+    ullPrint(&list);
+    printf("isEmpty: %s\n", ullIsEmpty(&list) ? "True" : "False");
+
+    printf("Adding elements 0-24 to the list:\n");
+    for (int i = 0; i < 25; i++) {
+        ullInsertAtTail(&list, i);
+    }
+    ullPrint(&list);
+    printf("Size of the list: %d (in %d nodes of up to %d values)\n",
+           ullGetLength(&list), list.nodes, ULL_NODE_CAPACITY);
+
+    printf("Inserting 99 at the head:\n");
+    ullInsertAtHead(&list, 99);
+    ullPrint(&list);
+
+    printf("Inserting 88 at the tail:\n");
+    ullInsertAtTail(&list, 88);
+    ullPrint(&list);
+
+    printf("Inserting 77 at index 5:\n");
+    ullInsertAtPosition(&list, 77, 5);
+    ullPrint(&list);
+
+    printf("Deleting value 77:\n");
+    ullDeleteByValue(&list, 77);
+    ullPrint(&list);
+
+    printf("Deleting head:\n");
+    ullDeleteHead(&list);
+    ullPrint(&list);
+
+    printf("Deleting tail:\n");
+    ullDeleteTail(&list);
+    ullPrint(&list);
+
+    printf("Deleting node at index 4:\n");
+    ullDeleteByPosition(&list, 4);
+    ullPrint(&list);
+
+    printf("Searching for value 6 (iterative): %s\n", ullSearchIterative(&list, 6) ? "True" : "False");
+
+    printf("Printing the list in reverse:\n");
+    ullPrintReverse(&list);
+
+    printf("Freeing the list:\n");
+    ullFree(&list);
+    ullPrint(&list);
+    printf("isEmpty: %s\n", ullIsEmpty(&list) ? "True" : "False");
+
+    return 0;
+}
+
@@ -0,0 +1,371 @@
+/**
+ * @file concurrent_hash_map.c
+ * @brief Implementation of the concurrent hash map for int keys and values.
+ *
+ * The top bits of a key's hash pick its shard and the low bits its bucket.
+ * Writers hold the shard lock, so a chain only ever has one writer, and
+ * every link is updated with a single atomic store that readers may
+ * observe at any time:
+ *
+ * - insert links a fully built node in front of the chain;
+ * - erase first sets the low bit of the erased node's next pointer and
+ *   then unlinks it, so a reader that reaches the node and then validates
+ *   its next pointer notices the mark and restarts;
+ * - grow copies the shard's nodes into a bucket array twice as large,
+ *   publishes it, and retires the old array together with its nodes.
+ *
+ * A reader protects the shard's bucket array in hazard slot 0 and walks
+ * the chain hand over hand in slots 1 and 2. After protecting a node it
+ * re-reads the link it came from: if the link still points at the node,
+ * unmarked, the node was reachable after it became protected and cannot
+ * be freed until the reader is done.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "concurrent_hash_map.h"
+#include "stacks_queues/hazard_pointer.h"
+
+// Helpers
+
+/**
+ * Helper function to hash a key (the 64-bit finalizer of MurmurHash3).
+ *
+ * @param key the key to hash
+ * @return a well-mixed 64-bit hash
+ */
+static inline uint64_t hashKey(int key) {
+    uint64_t x = (uint32_t)key;
+
+    x *= 0xFF51AFD7ED558CCDULL;
+    x ^= x >> 33;
+    x *= 0xC4CEB9FE1A85EC53ULL;
+    x ^= x >> 33;
+    return x;
+}
+
+/**
+ * Helper function to pick the shard of a hash.
+ *
+ * @param map  pointer to the ConcurrentHashMap
+ * @param hash hashKey(key)
+ * @return the shard holding the key
+ */
+static inline CHMShard *shardOf(ConcurrentHashMap *map, uint64_t hash) {
+    return &map->shards[(hash >> 32) & (CHM_SHARDS - 1)];
+}
+
+/**
+ * Helper function to check whether a next pointer carries the erased mark.
+ *
+ * @param next the next pointer of a node
+ * @return true if the node owning it has been erased
+ */
+static inline bool isMarked(CHMNode *next) {
+    return ((uintptr_t)next & 1) != 0;
+}
+
+/**
+ * Helper function to create and allocate memory for a node.
+ *
+ * @param key   the key to create the node with
+ * @param value the value to create the node with
+ * @return a pointer to the newly created node
+ */
+static CHMNode *createNode(int key, int value) {
+    CHMNode *node = malloc(sizeof(CHMNode));
+    if (node == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+
+    node->key = key;
+    atomic_init(&node->value, value);
+    atomic_init(&node->next, NULL);
+    return node;
+}
+
+/**
+ * Helper function to create an empty bucket array.
+ *
+ * @param bucket_count number of buckets (a power of two)
+ * @return a pointer to the new table
+ */
+static CHMTable *createTable(int bucket_count) {
+    CHMTable *table = malloc(sizeof(CHMTable) + sizeof(_Atomic(CHMNode *)) * (size_t)bucket_count);
+    if (table == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+
+    table->bucket_count = bucket_count;
+    for (int b = 0; b < bucket_count; b++) {
+        atomic_init(&table->buckets[b], NULL);
+    }
+    return table;
+}
+
+/**
+ * Helper function to free a bucket array and every node still linked in it.
+ * Used directly by chmFree and as the reclaim function of retired tables.
+ *
+ * @param value the CHMTable to free
+ */
+static void freeTable(void *value) {
+    CHMTable *table = value;
+
+    for (int b = 0; b < table->bucket_count; b++) {
+        CHMNode *curr = atomic_load_explicit(&table->buckets[b], memory_order_relaxed);
+        while (curr != NULL) {
+            CHMNode *next = atomic_load_explicit(&curr->next, memory_order_relaxed);
+            free(curr);
+            curr = next;
+        }
+    }
+    free(table);
+}
+
+/**
+ * Helper function to find the link that points at a key's node, or the
+ * NULL link at the end of its chain. The caller holds the shard lock.
+ *
+ * @param table the shard's current table
+ * @param key   the key to find
+ * @param hash  hashKey(key)
+ * @return the link; *link is the key's node, or NULL if the key is missing
+ */
+static _Atomic(CHMNode *) *findLink(CHMTable *table, int key, uint64_t hash) {
+    _Atomic(CHMNode *) *link = &table->buckets[hash & (uint64_t)(table->bucket_count - 1)];
+    CHMNode *curr;
+
+    while ((curr = atomic_load_explicit(link, memory_order_relaxed)) != NULL && curr->key != key) {
+        link = &curr->next;
+    }
+    return link;
+}
+
+/**
+ * Helper function to double the bucket array of a shard. The caller holds
+ * the shard lock. The nodes are copied rather than moved so that readers
+ * still walking the old chains see them unchanged.
+ *
+ * @param shard the shard to grow
+ * @param table the shard's current table
+ */
+static void growShard(CHMShard *shard, CHMTable *table) {
+    CHMTable *grown = createTable(table->bucket_count * 2);
+    uint64_t mask = (uint64_t)(grown->bucket_count - 1);
+
+    for (int b = 0; b < table->bucket_count; b++) {
+        CHMNode *curr = atomic_load_explicit(&table->buckets[b], memory_order_relaxed);
+        for (; curr != NULL; curr = atomic_load_explicit(&curr->next, memory_order_relaxed)) {
+            CHMNode *copy = createNode(curr->key, atomic_load_explicit(&curr->value, memory_order_relaxed));
+            _Atomic(CHMNode *) *bucket = &grown->buckets[hashKey(curr->key) & mask];
+            atomic_init(&copy->next, atomic_load_explicit(bucket, memory_order_relaxed));
+            atomic_init(bucket, copy);
+        }
+    }
+
+    atomic_store(&shard->table, grown);
+    hpRetire(hpThreadRecord(), table, freeTable);
+}
+
+/**
+ * Helper function to find a key's node without locking. On return the
+ * node (if any) is protected by the caller's hazard record, which the
+ * caller must clear.
+ *
+ * @param record the calling thread's hazard record
+ * @param shard  the key's shard
+ * @param key    the key to find
+ * @param hash   hashKey(key)
+ * @return the key's node, or NULL if the key is not in the map
+ */
+static CHMNode *findNode(HazardRecord *record, CHMShard *shard, int key, uint64_t hash) {
+retry:;
+    CHMTable *table = atomic_load(&shard->table);
+    hpSet(record, 0, table);
+    if (atomic_load(&shard->table) != table) goto retry;
+
+    _Atomic(CHMNode *) *link = &table->buckets[hash & (uint64_t)(table->bucket_count - 1)];
+    CHMNode *curr = atomic_load(link);
+    int slot = 1;
+
+    while (curr != NULL) {
+        hpSet(record, slot, curr);
+        if (atomic_load(link) != curr) goto retry;
+        if (curr->key == key) return curr;
+
+        CHMNode *next = atomic_load(&curr->next);
+        if (isMarked(next)) goto retry;
+        link = &curr->next;
+        curr = next;
+        slot = 3 - slot;
+    }
+    return NULL;
+}
+
+// Core Functions
+
+/**
+ * Initializes an empty concurrent hash map.
+ *
+ * @param map              pointer to the ConcurrentHashMap to initialize
+ * @param initial_capacity number of keys expected (shards grow on demand)
+ */
+void chmInit(ConcurrentHashMap *map, int initial_capacity) {
+    int bucket_count = 8;
+    while ((long)bucket_count * CHM_MAX_LOAD * CHM_SHARDS < initial_capacity) {
+        bucket_count *= 2;
+    }
+
+    for (int s = 0; s < CHM_SHARDS; s++) {
+        CHMShard *shard = &map->shards[s];
+        pthread_mutex_init(&shard->lock, NULL);
+        atomic_init(&shard->table, createTable(bucket_count));
+        atomic_init(&shard->size, 0);
+    }
+}
+
+/**
+ * Frees every node and table of a concurrent hash map. No other thread may
+ * be using the map. Tables and nodes retired earlier are freed by the
+ * hazard pointer scans (see hpCollect).
+ *
+ * @param map pointer to the ConcurrentHashMap to free
+ */
+void chmFree(ConcurrentHashMap *map) {
+    for (int s = 0; s < CHM_SHARDS; s++) {
+        CHMShard *shard = &map->shards[s];
+        freeTable(atomic_load(&shard->table));
+        atomic_store(&shard->table, NULL);
+        atomic_store(&shard->size, 0);
+        pthread_mutex_destroy(&shard->lock);
+    }
+}
+
+// Insertion/Deletion
+
+/**
+ * Inserts a key with its value, or overwrites the value if the key is
+ * already in the map.
+ *
+ * @param map   pointer to the ConcurrentHashMap
+ * @param key   the key
+ * @param value the value
+ * @return true if the key was added; false if it was already present
+ */
+bool chmInsert(ConcurrentHashMap *map, int key, int value) {
+    uint64_t hash = hashKey(key);
+    CHMShard *shard = shardOf(map, hash);
+    bool added = false;
+
+    pthread_mutex_lock(&shard->lock);
+    CHMTable *table = atomic_load_explicit(&shard->table, memory_order_relaxed);
+    _Atomic(CHMNode *) *link = findLink(table, key, hash);
+    CHMNode *curr = atomic_load_explicit(link, memory_order_relaxed);
+
+    if (curr != NULL) {
+        atomic_store(&curr->value, value);
+    } else {
+        _Atomic(CHMNode *) *bucket = &table->buckets[hash & (uint64_t)(table->bucket_count - 1)];
+        CHMNode *node = createNode(key, value);
+        atomic_init(&node->next, atomic_load_explicit(bucket, memory_order_relaxed));
+        atomic_store(bucket, node);
+        added = true;
+
+        int size = atomic_fetch_add(&shard->size, 1) + 1;
+        if (size > table->bucket_count * CHM_MAX_LOAD) growShard(shard, table);
+    }
+    pthread_mutex_unlock(&shard->lock);
+    return added;
+}
+
+/**
+ * Removes a key and its value from a concurrent hash map.
+ *
+ * @param map pointer to the ConcurrentHashMap
+ * @param key the key to remove
+ * @return true if the key was removed; false if it was not in the map
+ */
+bool chmErase(ConcurrentHashMap *map, int key) {
+    uint64_t hash = hashKey(key);
+    CHMShard *shard = shardOf(map, hash);
+
+    pthread_mutex_lock(&shard->lock);
+    CHMTable *table = atomic_load_explicit(&shard->table, memory_order_relaxed);
+    _Atomic(CHMNode *) *link = findLink(table, key, hash);
+    CHMNode *curr = atomic_load_explicit(link, memory_order_relaxed);
+
+    if (curr == NULL) {
+        pthread_mutex_unlock(&shard->lock);
+        return false;
+    }
+
+    // Mark before unlinking, so readers standing on the node restart.
+    CHMNode *next = atomic_load_explicit(&curr->next, memory_order_relaxed);
+    atomic_store(&curr->next, (CHMNode *)((uintptr_t)next | 1));
+    atomic_store(link, next);
+    atomic_fetch_sub(&shard->size, 1);
+    pthread_mutex_unlock(&shard->lock);
+
+    hpRetire(hpThreadRecord(), curr, free);
+    return true;
+}
+
+// Lookup/Utility
+
+/**
+ * Copies the value of a key. Takes no lock.
+ *
+ * @param map       pointer to the ConcurrentHashMap
+ * @param key       the key to look for
+ * @param out_value output: the value (left untouched if the key is missing)
+ * @return true if found; false otherwise
+ */
+bool chmGet(ConcurrentHashMap *map, int key, int *out_value) {
+    HazardRecord *record = hpThreadRecord();
+    uint64_t hash = hashKey(key);
+    CHMNode *node = findNode(record, shardOf(map, hash), key, hash);
+
+    if (node != NULL) *out_value = atomic_load(&node->value);
+    hpClear(record);
+    return node != NULL;
+}
+
+/**
+ * Checks whether a key is in a concurrent hash map. Takes no lock.
+ *
+ * @param map pointer to the ConcurrentHashMap
+ * @param key the key to look for
+ * @return true if found; false otherwise
+ */
+bool chmContains(ConcurrentHashMap *map, int key) {
+    HazardRecord *record = hpThreadRecord();
+    uint64_t hash = hashKey(key);
+    bool found = findNode(record, shardOf(map, hash), key, hash) != NULL;
+
+    hpClear(record);
+    return found;
+}
+
+/**
+ * Returns the number of keys in a concurrent hash map. While writers are
+ * running the count is only a snapshot of each shard at a slightly
+ * different time.
+ *
+ * @param map pointer to the ConcurrentHashMap
+ * @return the number of keys
+ */
+int chmSize(ConcurrentHashMap *map) {
+    int size = 0;
+    for (int s = 0; s < CHM_SHARDS; s++) {
+        size += atomic_load(&map->shards[s].size);
+    }
+    return size;
+}
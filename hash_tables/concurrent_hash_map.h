@@ -0,0 +1,78 @@
+/**
+ * @file concurrent_hash_map.h
+ * @brief Public interface of the concurrent hash map for int keys and values.
+ *
+ * ConcurrentHashMap (prefix `chm`) splits its keys over CHM_SHARDS shards
+ * by hash. Every shard is a chained hash table whose chains use the
+ * LinkedList node shape (key, value, next) with atomic links:
+ *
+ * - Writers (insert, erase) take the lock of their shard only, so writers
+ *   of different shards never wait for each other.
+ * - Readers (get, contains) take no lock at all: they walk the chain with
+ *   atomic loads, protecting each node with a hazard pointer (see
+ *   stacks_queues/hazard_pointer.h), so a reader never blocks, and
+ *   never waits for a stalled writer.
+ * - A shard that exceeds CHM_MAX_LOAD keys per bucket doubles its own
+ *   bucket array while holding its own lock. Readers keep using the old
+ *   array until the new one is published, and the rest of the map is
+ *   never paused.
+ *
+ * Init and Free must not run concurrently with other operations.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#ifndef CONCURRENT_HASH_MAP_H
+#define CONCURRENT_HASH_MAP_H
+
+#include <stdbool.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+// Number of independently locked shards (a power of two).
+#define CHM_SHARDS 64
+
+// Average chain length at which a shard doubles its bucket array.
+#define CHM_MAX_LOAD 2
+
+// Structure to represent a node.
+typedef struct CHMNode {
+    int key;                        // the key stored in this node
+    atomic_int value;               // the value of the key
+    _Atomic(struct CHMNode *) next; // next node of the chain (low bit set once the node is erased)
+} CHMNode;
+
+// Structure to represent the bucket array of one shard.
+typedef struct {
+    int bucket_count;                 // number of buckets (a power of two)
+    _Atomic(CHMNode *) buckets[];     // head of every chain
+} CHMTable;
+
+// Structure to represent one shard.
+typedef struct {
+    alignas(64) pthread_mutex_t lock; // serializes the writers of the shard
+    _Atomic(CHMTable *) table;        // current bucket array
+    atomic_int size;                  // number of keys in the shard
+} CHMShard;
+
+// Structure to represent a concurrent hash map from int keys to int values.
+typedef struct {
+    CHMShard shards[CHM_SHARDS];      // shard i holds the keys whose hash starts with i
+} ConcurrentHashMap;
+
+// Core Functions
+void chmInit(ConcurrentHashMap *map, int initial_capacity);
+void chmFree(ConcurrentHashMap *map);
+
+// Insertion/Deletion
+bool chmInsert(ConcurrentHashMap *map, int key, int value);
+bool chmErase(ConcurrentHashMap *map, int key);
+
+// Lookup/Utility
+bool chmGet(ConcurrentHashMap *map, int key, int *out_value);
+bool chmContains(ConcurrentHashMap *map, int key);
+int chmSize(ConcurrentHashMap *map);
+
+#endif // CONCURRENT_HASH_MAP_H
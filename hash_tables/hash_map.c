@@ -0,0 +1,455 @@
+/**
+ * @file hash_map.c
+ * @brief Implementation of the open-addressing hash map and set for int keys.
+ *
+ * A key's 64-bit hash is split in two: the low 7 bits are its tag, stored
+ * in the control byte of its slot, and the rest picks its home group.
+ * Groups are probed in triangular order (home, +1, +3, +6, ...), which
+ * visits every group once because the group count is a power of two.
+ *
+ * A slot is found by matching the tag against a group's 16 control bytes
+ * (SSE2 compare and movemask, or a byte loop without SSE2) and checking
+ * the key of each match. An insert takes the first empty slot on the
+ * probe path and bumps the overflow count of every full group it passes;
+ * an erase walks the same path and undoes those bumps. An overflow count
+ * that reaches 255 sticks until the next rehash, which only makes lookups
+ * probe further than they must.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hash_map.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// Helpers
+
+/**
+ * Helper function to allocate memory or exit if allocation fails.
+ *
+ * @param alignment alignment of the block (0 for malloc's default)
+ * @param bytes     number of bytes to allocate
+ * @return a pointer to the block
+ */
+static void *allocOrDie(size_t alignment, size_t bytes) {
+    void *block = alignment > 0 ? aligned_alloc(alignment, (bytes + alignment - 1) / alignment * alignment)
+                                : malloc(bytes > 0 ? bytes : 1);
+    if (block == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    return block;
+}
+
+/**
+ * Helper function to hash a key (the 64-bit finalizer of MurmurHash3).
+ *
+ * @param key the key to hash
+ * @return a well-mixed 64-bit hash
+ */
+static inline uint64_t hashKey(int key) {
+    uint64_t x = (uint32_t)key;
+
+    x *= 0xFF51AFD7ED558CCDULL;
+    x ^= x >> 33;
+    x *= 0xC4CEB9FE1A85EC53ULL;
+    x ^= x >> 33;
+    return x;
+}
+
+/**
+ * Helper function to find the slots of a group whose control byte equals a tag.
+ *
+ * @param control the HM_GROUP_SIZE control bytes of the group (16-byte aligned)
+ * @param tag     the byte to look for
+ * @return a bit mask with bit i set if control[i] == tag
+ */
+static inline unsigned matchByte(const uint8_t *control, uint8_t tag) {
+#if defined(__SSE2__)
+    __m128i group = _mm_load_si128((const __m128i *)control);
+    return (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8((char)tag)));
+#else
+    unsigned mask = 0;
+    for (int i = 0; i < HM_GROUP_SIZE; i++) {
+        mask |= (unsigned)(control[i] == tag) << i;
+    }
+    return mask;
+#endif
+}
+
+/**
+ * Helper function to find the empty slots of a group.
+ *
+ * @param control the HM_GROUP_SIZE control bytes of the group (16-byte aligned)
+ * @return a bit mask with bit i set if slot i is empty
+ */
+static inline unsigned matchEmpty(const uint8_t *control) {
+#if defined(__SSE2__)
+    // Only HM_EMPTY has its high bit set, and movemask collects exactly those bits.
+    return (unsigned)_mm_movemask_epi8(_mm_load_si128((const __m128i *)control));
+#else
+    return matchByte(control, HM_EMPTY);
+#endif
+}
+
+/**
+ * Helper function to compute the number of slots needed to hold a number
+ * of keys without exceeding the maximum load factor.
+ *
+ * @param count number of keys
+ * @return a power of two of at least HM_GROUP_SIZE slots
+ */
+static int slotsFor(int count) {
+    int slots = HM_GROUP_SIZE;
+    while ((long)slots * HM_MAX_LOAD_NUM / HM_MAX_LOAD_DEN < count) {
+        slots *= 2;
+    }
+    return slots;
+}
+
+/**
+ * Helper function to allocate empty tables with a given number of slots.
+ *
+ * @param map      pointer to the HashMap (value_size already set)
+ * @param capacity number of slots
+ */
+static void allocTables(HashMap *map, int capacity) {
+    int groups = capacity / HM_GROUP_SIZE;
+
+    map->control = allocOrDie(64, (size_t)capacity);
+    map->overflow = allocOrDie(0, (size_t)groups);
+    map->keys = allocOrDie(0, sizeof(int) * (size_t)capacity);
+    map->values = map->value_size > 0 ? allocOrDie(0, map->value_size * (size_t)capacity) : NULL;
+    memset(map->control, HM_EMPTY, (size_t)capacity);
+    memset(map->overflow, 0, (size_t)groups);
+    map->capacity = capacity;
+    map->size = 0;
+}
+
+/**
+ * Helper function to find the slot holding a key.
+ *
+ * @param map  pointer to the HashMap
+ * @param key  the key to find
+ * @param hash hashKey(key)
+ * @return the slot index, or -1 if the key is not in the map
+ */
+static inline long findSlot(const HashMap *map, int key, uint64_t hash) {
+    size_t mask = (size_t)map->capacity / HM_GROUP_SIZE - 1;
+    size_t group = (size_t)(hash >> 7) & mask;
+    uint8_t tag = (uint8_t)(hash & 0x7F);
+
+    for (size_t step = 1; step <= mask + 1; step++) {
+        const uint8_t *control = map->control + group * HM_GROUP_SIZE;
+        unsigned matches = matchByte(control, tag);
+
+        while (matches != 0) {
+            size_t slot = group * HM_GROUP_SIZE + (size_t)__builtin_ctz(matches);
+            if (map->keys[slot] == key) return (long)slot;
+            matches &= matches - 1;
+        }
+        if (map->overflow[group] == 0) return -1;
+        group = (group + step) & mask;
+    }
+    return -1;
+}
+
+/**
+ * Helper function to place a key that is not in the map in the first
+ * empty slot of its probe path. The map must have a free slot.
+ *
+ * @param map  pointer to the HashMap
+ * @param key  the key to place
+ * @param hash hashKey(key)
+ * @return the slot the key was placed in
+ */
+static size_t placeKey(HashMap *map, int key, uint64_t hash) {
+    size_t mask = (size_t)map->capacity / HM_GROUP_SIZE - 1;
+    size_t group = (size_t)(hash >> 7) & mask;
+
+    for (size_t step = 1;; step++) {
+        unsigned empty = matchEmpty(map->control + group * HM_GROUP_SIZE);
+        if (empty != 0) {
+            size_t slot = group * HM_GROUP_SIZE + (size_t)__builtin_ctz(empty);
+            map->control[slot] = (uint8_t)(hash & 0x7F);
+            map->keys[slot] = key;
+            return slot;
+        }
+        if (map->overflow[group] < UINT8_MAX) map->overflow[group]++;
+        group = (group + step) & mask;
+    }
+}
+
+/**
+ * Helper function to move every key and value into new tables with a
+ * given number of slots.
+ *
+ * @param map      pointer to the HashMap
+ * @param capacity the new number of slots (must fit every key)
+ */
+static void rehash(HashMap *map, int capacity) {
+    HashMap old = *map;
+
+    allocTables(map, capacity);
+    for (long slot = 0; slot < old.capacity; slot++) {
+        if (old.control[slot] & HM_EMPTY) continue;
+
+        size_t placed = placeKey(map, old.keys[slot], hashKey(old.keys[slot]));
+        if (map->value_size > 0) {
+            memcpy((char *)map->values + placed * map->value_size,
+                   (char *)old.values + (size_t)slot * map->value_size, map->value_size);
+        }
+    }
+    map->size = old.size;
+
+    free(old.control);
+    free(old.overflow);
+    free(old.keys);
+    free(old.values);
+}
+
+// Core Functions
+
+/**
+ * Initializes a hash map with room for a number of keys before it grows.
+ *
+ * @param map              pointer to the HashMap to initialize
+ * @param value_size       size (in bytes) of each value (0 for a set)
+ * @param initial_capacity number of keys the map holds without rehashing
+ */
+void hmInit(HashMap *map, size_t value_size, int initial_capacity) {
+    map->value_size = value_size;
+    allocTables(map, slotsFor(initial_capacity));
+}
+
+/**
+ * Frees the memory of a hash map.
+ *
+ * @param map pointer to the HashMap to free
+ */
+void hmFree(HashMap *map) {
+    free(map->control);
+    free(map->overflow);
+    free(map->keys);
+    free(map->values);
+    map->control = NULL;
+    map->overflow = NULL;
+    map->keys = NULL;
+    map->values = NULL;
+    map->size = 0;
+    map->capacity = 0;
+}
+
+/**
+ * Removes every key from a hash map, keeping its capacity.
+ *
+ * @param map pointer to the HashMap
+ */
+void hmClear(HashMap *map) {
+    memset(map->control, HM_EMPTY, (size_t)map->capacity);
+    memset(map->overflow, 0, (size_t)map->capacity / HM_GROUP_SIZE);
+    map->size = 0;
+}
+
+/**
+ * Grows a hash map so it holds a number of keys without rehashing.
+ *
+ * @param map   pointer to the HashMap
+ * @param count number of keys to make room for
+ */
+void hmReserve(HashMap *map, int count) {
+    int capacity = slotsFor(count);
+    if (capacity > map->capacity) rehash(map, capacity);
+}
+
+// Insertion/Deletion
+
+/**
+ * Inserts a key with its value, or overwrites the value if the key is
+ * already in the map. The map doubles when it would exceed its maximum
+ * load factor.
+ *
+ * @param map   pointer to the HashMap
+ * @param key   the key
+ * @param value pointer to value_size bytes to copy (ignored for sets; NULL leaves the value unset)
+ * @return true if the key was added; false if it was already present
+ */
+bool hmInsert(HashMap *map, int key, const void *value) {
+    uint64_t hash = hashKey(key);
+    long slot = findSlot(map, key, hash);
+    bool added = slot < 0;
+
+    if (added) {
+        if ((long)map->size >= (long)map->capacity * HM_MAX_LOAD_NUM / HM_MAX_LOAD_DEN) {
+            rehash(map, map->capacity * 2);
+        }
+        slot = (long)placeKey(map, key, hash);
+        map->size++;
+    }
+    if (map->value_size > 0 && value != NULL) {
+        memcpy((char *)map->values + (size_t)slot * map->value_size, value, map->value_size);
+    }
+    return added;
+}
+
+/**
+ * Removes a key and its value from a hash map.
+ *
+ * @param map pointer to the HashMap
+ * @param key the key to remove
+ * @return true if the key was removed; false if it was not in the map
+ */
+bool hmErase(HashMap *map, int key) {
+    uint64_t hash = hashKey(key);
+    long slot = findSlot(map, key, hash);
+    if (slot < 0) return false;
+
+    // Undo the overflow counts the key added on its way to its group.
+    size_t mask = (size_t)map->capacity / HM_GROUP_SIZE - 1;
+    size_t target = (size_t)slot / HM_GROUP_SIZE;
+    size_t group = (size_t)(hash >> 7) & mask;
+    for (size_t step = 1; group != target; step++) {
+        if (map->overflow[group] < UINT8_MAX) map->overflow[group]--;
+        group = (group + step) & mask;
+    }
+
+    map->control[slot] = HM_EMPTY;
+    map->size--;
+    return true;
+}
+
+// Lookup/Utility
+
+/**
+ * Checks whether a key is in a hash map.
+ *
+ * @param map pointer to the HashMap
+ * @param key the key to look for
+ * @return true if found; false otherwise
+ */
+bool hmContains(HashMap *map, int key) {
+    return findSlot(map, key, hashKey(key)) >= 0;
+}
+
+/**
+ * Copies the value of a key.
+ *
+ * @param map       pointer to the HashMap
+ * @param key       the key to look for
+ * @param out_value pointer to value_size bytes that receive the value
+ * @return true if found; false otherwise (out_value is left untouched)
+ */
+bool hmGet(HashMap *map, int key, void *out_value) {
+    long slot = findSlot(map, key, hashKey(key));
+    if (slot < 0) return false;
+
+    if (map->value_size > 0) {
+        memcpy(out_value, (char *)map->values + (size_t)slot * map->value_size, map->value_size);
+    }
+    return true;
+}
+
+/**
+ * Returns a pointer to the value of a key, valid until the next insert,
+ * erase or rehash.
+ *
+ * @param map pointer to the HashMap (value_size must be > 0)
+ * @param key the key to look for
+ * @return a pointer to the value; NULL if the key is not in the map
+ */
+void *hmFind(HashMap *map, int key) {
+    long slot = findSlot(map, key, hashKey(key));
+    if (slot < 0) return NULL;
+    return (char *)map->values + (size_t)slot * map->value_size;
+}
+
+/**
+ * Returns the number of keys in a hash map.
+ *
+ * @param map pointer to the HashMap
+ * @return the number of keys
+ */
+int hmSize(HashMap *map) {
+    return map->size;
+}
+
+/**
+ * Checks whether a hash map is empty.
+ *
+ * @param map pointer to the HashMap
+ * @return true if empty; false otherwise
+ */
+bool hmIsEmpty(HashMap *map) {
+    return map->size == 0;
+}
+
+// Set
+
+/**
+ * Initializes a hash set with room for a number of keys before it grows.
+ *
+ * @param set              pointer to the HashSet to initialize
+ * @param initial_capacity number of keys the set holds without rehashing
+ */
+void hsInit(HashSet *set, int initial_capacity) {
+    hmInit(&set->map, 0, initial_capacity);
+}
+
+/**
+ * Frees the memory of a hash set.
+ *
+ * @param set pointer to the HashSet to free
+ */
+void hsFree(HashSet *set) {
+    hmFree(&set->map);
+}
+
+/**
+ * Adds a key to a hash set.
+ *
+ * @param set pointer to the HashSet
+ * @param key the key to add
+ * @return true if the key was added; false if it was already present
+ */
+bool hsInsert(HashSet *set, int key) {
+    return hmInsert(&set->map, key, NULL);
+}
+
+/**
+ * Removes a key from a hash set.
+ *
+ * @param set pointer to the HashSet
+ * @param key the key to remove
+ * @return true if the key was removed; false if it was not in the set
+ */
+bool hsErase(HashSet *set, int key) {
+    return hmErase(&set->map, key);
+}
+
+/**
+ * Checks whether a key is in a hash set.
+ *
+ * @param set pointer to the HashSet
+ * @param key the key to look for
+ * @return true if found; false otherwise
+ */
+bool hsContains(HashSet *set, int key) {
+    return hmContains(&set->map, key);
+}
+
+/**
+ * Returns the number of keys in a hash set.
+ *
+ * @param set pointer to the HashSet
+ * @return the number of keys
+ */
+int hsSize(HashSet *set) {
+    return hmSize(&set->map);
+}
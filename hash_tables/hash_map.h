@@ -0,0 +1,83 @@
+/**
+ * @file hash_map.h
+ * @brief Public interface of the open-addressing hash map and set for int keys.
+ *
+ * HashMap (prefix `hm`) is a Swiss-table style hash map: slots come in
+ * groups of HM_GROUP_SIZE, and every slot has a one-byte control tag
+ * holding 7 bits of the key's hash (or HM_EMPTY). A lookup compares the
+ * tags of a whole group against the key's tag with one SIMD instruction
+ * and only reads the keys whose tag matches, so a probe usually costs a
+ * single cache miss on the control bytes and one on the key.
+ *
+ * Values of any size are stored in one flat buffer next to the keys, the
+ * way GenericArray stores its elements (value_size bytes per slot). A
+ * HashSet (prefix `hs`) is a HashMap with no values.
+ *
+ * Deletion leaves no tombstones: every group counts the keys that probed
+ * past it because it was full, a lookup stops at the first group whose
+ * count is zero, and an erase simply empties the slot and decrements the
+ * counts along the key's probe path.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#ifndef HASH_MAP_H
+#define HASH_MAP_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Number of slots probed together (one SSE2 register of control bytes).
+#define HM_GROUP_SIZE 16
+
+// Control byte of a slot that holds no key (a full slot holds a 7-bit hash tag).
+#define HM_EMPTY 0x80
+
+// Maximum load factor before the table doubles, as HM_MAX_LOAD_NUM / HM_MAX_LOAD_DEN.
+#define HM_MAX_LOAD_NUM 7
+#define HM_MAX_LOAD_DEN 8
+
+// Structure to represent an open-addressing hash map from int keys to fixed-size values.
+typedef struct {
+    uint8_t *control;           // one control byte per slot (HM_EMPTY or the key's hash tag)
+    uint8_t *overflow;          // per group: keys that probed past it while it was full (saturates at 255)
+    int *keys;                  // key of every slot
+    void *values;               // raw value buffer (value_size * capacity bytes, NULL for sets)
+    size_t value_size;          // size (in bytes) of each value
+    int size;                   // number of keys currently stored
+    int capacity;               // number of slots (a power of two, at least HM_GROUP_SIZE)
+} HashMap;
+
+// Structure to represent a hash set of ints (a HashMap without values).
+typedef struct {
+    HashMap map;                // the underlying map with value_size 0
+} HashSet;
+
+// Core Functions
+void hmInit(HashMap *map, size_t value_size, int initial_capacity);
+void hmFree(HashMap *map);
+void hmClear(HashMap *map);
+void hmReserve(HashMap *map, int count);
+
+// Insertion/Deletion
+bool hmInsert(HashMap *map, int key, const void *value);
+bool hmErase(HashMap *map, int key);
+
+// Lookup/Utility
+bool hmContains(HashMap *map, int key);
+bool hmGet(HashMap *map, int key, void *out_value);
+void *hmFind(HashMap *map, int key);
+int hmSize(HashMap *map);
+bool hmIsEmpty(HashMap *map);
+
+// Set
+void hsInit(HashSet *set, int initial_capacity);
+void hsFree(HashSet *set);
+bool hsInsert(HashSet *set, int key);
+bool hsErase(HashSet *set, int key);
+bool hsContains(HashSet *set, int key);
+int hsSize(HashSet *set);
+
+#endif // HASH_MAP_H
@@ -0,0 +1,174 @@
+/**
+ * @file min_queue.c
+ * @brief Implementation of the common min-queue interface.
+ *
+ * Every function forwards to the implementation selected by the kind.
+ * The pairing heap always hands out node pointers, so track_handles only
+ * matters for the d-ary and radix heaps.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "min_queue.h"
+
+// Core Functions
+
+/**
+ * Initializes an empty min-queue of the given kind.
+ *
+ * @param q             pointer to the MinQueue to initialize
+ * @param kind          the implementation to use
+ * @param track_handles whether pushes return handles for decreaseKey
+ */
+void mqInit(MinQueue *q, MinQueueKind kind, bool track_handles) {
+    q->kind = kind;
+    switch (kind) {
+        case MQ_HEAP_2:  pqInit(&q->dary, 2, track_handles); break;
+        case MQ_HEAP_4:  pqInit(&q->dary, 4, track_handles); break;
+        case MQ_HEAP_8:  pqInit(&q->dary, 8, track_handles); break;
+        case MQ_PAIRING: phInit(&q->pairing); break;
+        case MQ_RADIX:   rhInit(&q->radix, track_handles); break;
+        default:
+            fprintf(stderr, "Error: Unknown min-queue kind\n");
+            exit(EXIT_FAILURE);
+    }
+}
+
+/**
+ * Frees the memory used by a min-queue.
+ *
+ * @param q pointer to the MinQueue to free
+ */
+void mqFree(MinQueue *q) {
+    switch (q->kind) {
+        case MQ_PAIRING: phFree(&q->pairing); break;
+        case MQ_RADIX:   rhFree(&q->radix); break;
+        default:         pqFree(&q->dary); break;
+    }
+}
+
+// Insertion/Deletion
+
+/**
+ * Inserts a key into a min-queue.
+ *
+ * @param q   pointer to the MinQueue
+ * @param key the key to insert
+ * @return the key's handle (-1 for untracked d-ary and radix heaps)
+ */
+MQHandle mqPush(MinQueue *q, int key) {
+    switch (q->kind) {
+        case MQ_PAIRING: return (MQHandle)phPush(&q->pairing, key);
+        case MQ_RADIX:   return rhPush(&q->radix, key);
+        default:         return pqPush(&q->dary, key);
+    }
+}
+
+/**
+ * Removes the smallest key of a min-queue.
+ *
+ * @param q pointer to the MinQueue
+ * @return the smallest key; exits if the queue is empty
+ */
+int mqPop(MinQueue *q) {
+    switch (q->kind) {
+        case MQ_PAIRING: return phPop(&q->pairing);
+        case MQ_RADIX:   return rhPop(&q->radix);
+        default:         return pqPop(&q->dary);
+    }
+}
+
+/**
+ * Lowers the key of a queued element.
+ *
+ * @param q      pointer to the MinQueue
+ * @param handle the element's handle, as returned by mqPush
+ * @param key    the new key; must not be larger than the current one
+ */
+void mqDecreaseKey(MinQueue *q, MQHandle handle, int key) {
+    switch (q->kind) {
+        case MQ_PAIRING: phDecreaseKey(&q->pairing, (PHNode *)handle, key); break;
+        case MQ_RADIX:   rhDecreaseKey(&q->radix, (int)handle, key); break;
+        default:         pqDecreaseKey(&q->dary, (int)handle, key); break;
+    }
+}
+
+// Access/Utility
+
+/**
+ * Returns the smallest key of a min-queue without removing it.
+ *
+ * @param q pointer to the MinQueue
+ * @return the smallest key; exits if the queue is empty
+ */
+int mqPeek(MinQueue *q) {
+    switch (q->kind) {
+        case MQ_PAIRING: return phPeek(&q->pairing);
+        case MQ_RADIX:   return rhPeek(&q->radix);
+        default:         return pqPeek(&q->dary);
+    }
+}
+
+/**
+ * Returns the handle of the smallest key of a min-queue.
+ *
+ * @param q pointer to the MinQueue
+ * @return the handle; exits if the queue is empty or does not track handles
+ */
+MQHandle mqPeekHandle(MinQueue *q) {
+    switch (q->kind) {
+        case MQ_PAIRING:
+            if (q->pairing.root == NULL) {
+                fprintf(stderr, "Error: peekHandle on empty pairing heap\n");
+                exit(EXIT_FAILURE);
+            }
+            return (MQHandle)q->pairing.root;
+        case MQ_RADIX:   return rhPeekHandle(&q->radix);
+        default:         return pqPeekHandle(&q->dary);
+    }
+}
+
+/**
+ * Returns the number of keys in a min-queue.
+ *
+ * @param q pointer to the MinQueue
+ * @return the number of keys
+ */
+int mqSize(MinQueue *q) {
+    switch (q->kind) {
+        case MQ_PAIRING: return phSize(&q->pairing);
+        case MQ_RADIX:   return rhSize(&q->radix);
+        default:         return pqSize(&q->dary);
+    }
+}
+
+/**
+ * Checks whether a min-queue is empty.
+ *
+ * @param q pointer to the MinQueue
+ * @return true if empty; false otherwise
+ */
+bool mqIsEmpty(MinQueue *q) {
+    return mqSize(q) == 0;
+}
+
+/**
+ * Returns a short name for a min-queue kind, for reports.
+ *
+ * @param kind the kind
+ * @return a static string
+ */
+const char *mqKindName(MinQueueKind kind) {
+    switch (kind) {
+        case MQ_HEAP_2:  return "binary_heap";
+        case MQ_HEAP_4:  return "4ary_heap";
+        case MQ_HEAP_8:  return "8ary_heap";
+        case MQ_PAIRING: return "pairing_heap";
+        case MQ_RADIX:   return "radix_heap";
+        default:         return "unknown";
+    }
+}
@@ -0,0 +1,67 @@
+/**
+ * @file min_queue.h
+ * @brief Common interface over the integer min-priority-queue implementations.
+ *
+ * MinQueue (prefix `mq`) wraps a d-ary PriorityQueue, a PairingHeap or a
+ * RadixHeap behind one set of functions, so that callers (and the
+ * benchmarks) can swap implementations by changing a MinQueueKind. The
+ * implementation is stored inline in a tagged union and every call is a
+ * switch on the kind, which the compiler resolves to a jump table.
+ *
+ * Handles are MQHandle values: the node pointer for the pairing heap, the
+ * int handle otherwise. MQ_RADIX inherits the radix heap's restriction:
+ * keys must never go below the last popped key.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#ifndef MIN_QUEUE_H
+#define MIN_QUEUE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "heaps/priority_queue.h"
+#include "heaps/pairing_heap.h"
+#include "heaps/radix_heap.h"
+
+// Available implementations.
+typedef enum {
+    MQ_HEAP_2,                  // binary heap
+    MQ_HEAP_4,                  // 4-ary heap
+    MQ_HEAP_8,                  // 8-ary heap
+    MQ_PAIRING,                 // pairing heap on a node pool
+    MQ_RADIX                    // radix heap (monotone keys only)
+} MinQueueKind;
+
+// Handle of a queued key, valid until the key is popped.
+typedef intptr_t MQHandle;
+
+// Structure to represent a min-queue of any kind.
+typedef struct {
+    MinQueueKind kind;          // which member of the union is in use
+    union {
+        PriorityQueue dary;     // MQ_HEAP_2, MQ_HEAP_4, MQ_HEAP_8
+        PairingHeap pairing;    // MQ_PAIRING
+        RadixHeap radix;        // MQ_RADIX
+    };
+} MinQueue;
+
+// Core Functions
+void mqInit(MinQueue *q, MinQueueKind kind, bool track_handles);
+void mqFree(MinQueue *q);
+
+// Insertion/Deletion
+MQHandle mqPush(MinQueue *q, int key);
+int mqPop(MinQueue *q);
+void mqDecreaseKey(MinQueue *q, MQHandle handle, int key);
+
+// Access/Utility
+int mqPeek(MinQueue *q);
+MQHandle mqPeekHandle(MinQueue *q);
+int mqSize(MinQueue *q);
+bool mqIsEmpty(MinQueue *q);
+const char *mqKindName(MinQueueKind kind);
+
+#endif // MIN_QUEUE_H
@@ -0,0 +1,219 @@
+/**
+ * @file pairing_heap.c
+ * @brief Implementation of the pairing heap for integers.
+ *
+ * Linking two trees makes the root with the larger key the leftmost child
+ * of the other. Pop removes the root and merges its children in two
+ * passes: first pairs from left to right, then the resulting trees from
+ * right to left into one. Both passes are loops, so a degenerate heap
+ * (e.g. after n pushes of decreasing keys) cannot overflow the stack.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "pairing_heap.h"
+
+// Helpers
+
+/**
+ * Helper function to link two trees into one.
+ *
+ * @param a the root of the first tree (not NULL)
+ * @param b the root of the second tree (not NULL)
+ * @return the root of the linked tree; its prev and next are left to the caller
+ */
+static PHNode *link(PHNode *a, PHNode *b) {
+    if (b->key < a->key) {
+        PHNode *swap = a;
+        a = b;
+        b = swap;
+    }
+
+    b->prev = a;
+    b->next = a->child;
+    if (a->child != NULL) a->child->prev = b;
+    a->child = b;
+    return a;
+}
+
+/**
+ * Helper function to merge a list of sibling trees in two passes.
+ *
+ * @param first the leftmost tree of the list (may be NULL)
+ * @return the root of the merged tree, with prev and next set to NULL
+ */
+static PHNode *mergePairs(PHNode *first) {
+    if (first == NULL) return NULL;
+
+    // Pass 1: link pairs left to right, chaining the results through prev.
+    PHNode *last = NULL;
+    while (first != NULL) {
+        PHNode *a = first;
+        PHNode *b = a->next;
+        if (b == NULL) {
+            a->prev = last;
+            last = a;
+            break;
+        }
+        first = b->next;
+
+        PHNode *pair = link(a, b);
+        pair->prev = last;
+        last = pair;
+    }
+
+    // Pass 2: link the pairs right to left into one tree.
+    PHNode *root = last;
+    last = last->prev;
+    while (last != NULL) {
+        PHNode *prev = last->prev;
+        root = link(root, last);
+        last = prev;
+    }
+
+    root->prev = NULL;
+    root->next = NULL;
+    return root;
+}
+
+// Core Functions
+
+/**
+ * Initializes an empty pairing heap.
+ *
+ * @param heap pointer to the PairingHeap to initialize
+ */
+void phInit(PairingHeap *heap) {
+    heap->root = NULL;
+    heap->size = 0;
+    npInit(&heap->pool, sizeof(PHNode), PH_NODES_PER_SLAB);
+}
+
+/**
+ * Frees every node of a pairing heap at once (by releasing their slabs).
+ *
+ * @param heap pointer to the PairingHeap to free
+ */
+void phFree(PairingHeap *heap) {
+    npFree(&heap->pool);
+    heap->root = NULL;
+    heap->size = 0;
+}
+
+// Insertion/Deletion
+
+/**
+ * Inserts a key into a pairing heap.
+ *
+ * @param heap pointer to the PairingHeap
+ * @param key  the key to insert
+ * @return the key's node, valid as a handle until the key is popped
+ */
+PHNode *phPush(PairingHeap *heap, int key) {
+    PHNode *node = npAlloc(&heap->pool);
+    if (node == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+
+    node->key = key;
+    node->child = NULL;
+    node->next = NULL;
+    node->prev = NULL;
+    heap->root = heap->root != NULL ? link(heap->root, node) : node;
+    heap->root->prev = NULL;
+    heap->size++;
+    return node;
+}
+
+/**
+ * Removes the smallest key of a pairing heap.
+ *
+ * @param heap pointer to the PairingHeap
+ * @return the smallest key; exits if the heap is empty
+ */
+int phPop(PairingHeap *heap) {
+    if (heap->root == NULL) {
+        fprintf(stderr, "Error: pop on empty pairing heap\n");
+        exit(EXIT_FAILURE);
+    }
+
+    PHNode *root = heap->root;
+    int key = root->key;
+
+    heap->root = mergePairs(root->child);
+    heap->size--;
+    npRelease(&heap->pool, root);
+    return key;
+}
+
+/**
+ * Lowers the key of a node: cuts the node's subtree out of its parent
+ * and links it with the root.
+ *
+ * @param heap pointer to the PairingHeap
+ * @param node the node, as returned by phPush
+ * @param key  the new key; must not be larger than the current one
+ */
+void phDecreaseKey(PairingHeap *heap, PHNode *node, int key) {
+    if (key > node->key) {
+        fprintf(stderr, "Error: decreaseKey would increase the key\n");
+        exit(EXIT_FAILURE);
+    }
+
+    node->key = key;
+    if (node == heap->root) return;
+
+    // Unlink the subtree: prev is the left sibling, or the parent if leftmost.
+    if (node->prev->child == node) {
+        node->prev->child = node->next;
+    } else {
+        node->prev->next = node->next;
+    }
+    if (node->next != NULL) node->next->prev = node->prev;
+    node->next = NULL;
+    node->prev = NULL;
+
+    heap->root = link(heap->root, node);
+    heap->root->prev = NULL;
+}
+
+// Access/Utility
+
+/**
+ * Returns the smallest key of a pairing heap without removing it.
+ *
+ * @param heap pointer to the PairingHeap
+ * @return the smallest key; exits if the heap is empty
+ */
+int phPeek(PairingHeap *heap) {
+    if (heap->root == NULL) {
+        fprintf(stderr, "Error: peek on empty pairing heap\n");
+        exit(EXIT_FAILURE);
+    }
+    return heap->root->key;
+}
+
+/**
+ * Returns the number of keys in a pairing heap.
+ *
+ * @param heap pointer to the PairingHeap
+ * @return the number of keys
+ */
+int phSize(PairingHeap *heap) {
+    return heap->size;
+}
+
+/**
+ * Checks whether a pairing heap is empty.
+ *
+ * @param heap pointer to the PairingHeap
+ * @return true if empty; false otherwise
+ */
+bool phIsEmpty(PairingHeap *heap) {
+    return heap->root == NULL;
+}
@@ -0,0 +1,55 @@
+/**
+ * @file pairing_heap.h
+ * @brief Public interface of the pairing heap for integers.
+ *
+ * PairingHeap (prefix `ph`) is a min-heap kept as a multiway tree: a push
+ * or decreaseKey only links two trees (O(1)), and the work is deferred
+ * to pop, which merges the root's children in two passes (O(log n)
+ * amortized). This makes it the fastest choice when decreaseKey is
+ * frequent. Nodes come from a NodePool slab allocator, so pushes and
+ * pops never call malloc/free; a node is its own handle for decreaseKey.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#ifndef PAIRING_HEAP_H
+#define PAIRING_HEAP_H
+
+#include <stdbool.h>
+
+#include "linked_lists/node_pool.h"
+
+// Number of nodes carved out of each slab.
+#define PH_NODES_PER_SLAB 4096
+
+// Structure to represent a node.
+typedef struct PHNode {
+    int key;                    // the key stored in this node
+    struct PHNode *child;       // leftmost child (NULL if none)
+    struct PHNode *next;        // right sibling (NULL if last)
+    struct PHNode *prev;        // left sibling, or parent for the leftmost child (NULL for the root)
+} PHNode;
+
+// Structure to represent a pairing heap.
+typedef struct {
+    PHNode *root;               // node with the smallest key (NULL if empty)
+    int size;                   // number of keys in the heap
+    NodePool pool;              // slab allocator the nodes come from
+} PairingHeap;
+
+// Core Functions
+void phInit(PairingHeap *heap);
+void phFree(PairingHeap *heap);
+
+// Insertion/Deletion
+PHNode *phPush(PairingHeap *heap, int key);
+int phPop(PairingHeap *heap);
+void phDecreaseKey(PairingHeap *heap, PHNode *node, int key);
+
+// Access/Utility
+int phPeek(PairingHeap *heap);
+int phSize(PairingHeap *heap);
+bool phIsEmpty(PairingHeap *heap);
+
+#endif // PAIRING_HEAP_H
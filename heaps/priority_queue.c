@@ -0,0 +1,393 @@
+/**
+ * @file priority_queue.c
+ * @brief Implementation of the d-ary heap priority queue for integers.
+ *
+ * Heap index i is stored in slot pad + i of the keys array, and its
+ * children are indexes d*i+1 .. d*i+d. The pad (0 to d-1 unused slots) is
+ * chosen from the address of the array so that slot pad + d*i + 1 always
+ * starts a d-int aligned block: since d ints are 8, 16 or 32 bytes, a
+ * block never crosses a cache line. The pad is recomputed whenever the
+ * array is reallocated, moving the heap if needed.
+ *
+ * Sifting moves a hole instead of swapping: the moving key is held aside
+ * and every key it passes is copied once. The smallest child is selected
+ * with conditional moves rather than branches. With handle tracking, every
+ * copy also updates the handle at that index and its position.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "priority_queue.h"
+
+// Helpers
+
+/**
+ * Helper function to compute the pad that aligns the children blocks of
+ * a heap stored at a given address.
+ *
+ * @param base  address of slot 0 of the keys array
+ * @param arity the heap's arity
+ * @return the number of slots to leave before the root (0 to arity - 1)
+ */
+static int padFor(const int *base, int arity) {
+    uintptr_t slot = (uintptr_t)base / sizeof(int);
+    return (int)((uintptr_t)arity - (slot + 1) % (uintptr_t)arity) % arity;
+}
+
+/**
+ * Helper function to re-align the heap after the keys array moved.
+ *
+ * @param pq pointer to the PriorityQueue
+ */
+static void alignRoot(PriorityQueue *pq) {
+    int count = pq->keys.size - pq->pad;
+
+    for (;;) {
+        int pad = padFor(pq->keys.data, pq->arity);
+        if (pad + count <= pq->keys.capacity) {
+            if (pad != pq->pad) {
+                memmove(pq->keys.data + pad, pq->keys.data + pq->pad, sizeof(int) * (size_t)count);
+            }
+            pq->pad = pad;
+            pq->keys.size = pad + count;
+            break;
+        }
+        daResize(&pq->keys, pad + count + pq->arity);
+    }
+    pq->base = pq->keys.data;
+}
+
+/**
+ * Helper function to check a handle and return its heap index.
+ *
+ * @param pq     pointer to the PriorityQueue
+ * @param handle the handle to check
+ * @return the heap index of the handle's key; exits if the handle is not live
+ */
+static int positionOf(PriorityQueue *pq, int handle) {
+    if (!pq->track_handles || handle < 0 || handle >= pq->positions.size || pq->positions.data[handle] < 0) {
+        fprintf(stderr, "Error: Invalid priority queue handle\n");
+        exit(EXIT_FAILURE);
+    }
+    return pq->positions.data[handle];
+}
+
+/**
+ * Helper function to move a key up from heap index i until its parent is
+ * not larger.
+ *
+ * @param pq pointer to the PriorityQueue
+ * @param i  heap index of the key to move
+ */
+static void siftUp(PriorityQueue *pq, int i) {
+    int *heap = pq->keys.data + pq->pad;
+    int *handles = pq->handles.data;
+    int *positions = pq->positions.data;
+    int shift = __builtin_ctz((unsigned)pq->arity);
+    int key = heap[i];
+    int handle = pq->track_handles ? handles[i] : -1;
+
+    while (i > 0) {
+        int parent = (i - 1) >> shift;
+        if (heap[parent] <= key) break;
+
+        heap[i] = heap[parent];
+        if (pq->track_handles) {
+            handles[i] = handles[parent];
+            positions[handles[i]] = i;
+        }
+        i = parent;
+    }
+
+    heap[i] = key;
+    if (pq->track_handles) {
+        handles[i] = handle;
+        positions[handle] = i;
+    }
+}
+
+/**
+ * Helper function to move a key down from heap index i until no child is
+ * smaller. Written for a constant arity so that each case of siftDown
+ * compiles to an unrolled child scan.
+ *
+ * @param pq    pointer to the PriorityQueue
+ * @param i     heap index of the key to move
+ * @param arity the heap's arity (2, 4 or 8)
+ */
+static inline void siftDownArity(PriorityQueue *pq, int i, const int arity) {
+    int *heap = pq->keys.data + pq->pad;
+    int *handles = pq->handles.data;
+    int *positions = pq->positions.data;
+    int count = pq->keys.size - pq->pad;
+    int key = heap[i];
+    int handle = pq->track_handles ? handles[i] : -1;
+
+    for (;;) {
+        int first = arity * i + 1;
+        if (first >= count) break;
+
+        // Select the smallest child with conditional moves: which child wins
+        // is random, so a branch per comparison would mispredict often.
+        int best = first;
+        int smallest = heap[first];
+        int last = first + arity <= count ? first + arity : count;
+        for (int c = first + 1; c < last; c++) {
+            int value = heap[c];
+            bool smaller = value < smallest;
+            best = smaller ? c : best;
+            smallest = smaller ? value : smallest;
+        }
+        if (smallest >= key) break;
+
+        heap[i] = heap[best];
+        if (pq->track_handles) {
+            handles[i] = handles[best];
+            positions[handles[i]] = i;
+        }
+        i = best;
+    }
+
+    heap[i] = key;
+    if (pq->track_handles) {
+        handles[i] = handle;
+        positions[handle] = i;
+    }
+}
+
+/**
+ * Helper function to move a key down from heap index i.
+ *
+ * @param pq pointer to the PriorityQueue
+ * @param i  heap index of the key to move
+ */
+static void siftDown(PriorityQueue *pq, int i) {
+    switch (pq->arity) {
+        case 2:  siftDownArity(pq, i, 2); break;
+        case 4:  siftDownArity(pq, i, 4); break;
+        default: siftDownArity(pq, i, 8); break;
+    }
+}
+
+// Core Functions
+
+/**
+ * Initializes an empty priority queue.
+ *
+ * @param pq            pointer to the PriorityQueue to initialize
+ * @param arity         children per node: 2, 4 or 8
+ * @param track_handles whether pushes return handles for decreaseKey
+ */
+void pqInit(PriorityQueue *pq, int arity, bool track_handles) {
+    if (arity != 2 && arity != 4 && arity != PQ_MAX_ARITY) {
+        fprintf(stderr, "Error: Priority queue arity must be 2, 4 or 8\n");
+        exit(EXIT_FAILURE);
+    }
+
+    daInit(&pq->keys, 16);
+    daInit(&pq->handles, track_handles ? 16 : 1);
+    daInit(&pq->positions, track_handles ? 16 : 1);
+    daInit(&pq->free_handles, 1);
+    pq->arity = arity;
+    pq->track_handles = track_handles;
+    pq->pad = 0;
+    alignRoot(pq);
+}
+
+/**
+ * Frees the memory used by a priority queue.
+ *
+ * @param pq pointer to the PriorityQueue to free
+ */
+void pqFree(PriorityQueue *pq) {
+    daFree(&pq->keys);
+    daFree(&pq->handles);
+    daFree(&pq->positions);
+    daFree(&pq->free_handles);
+    pq->base = NULL;
+    pq->pad = 0;
+}
+
+/**
+ * Replaces the contents of a priority queue with the elements of a
+ * dynamic array in O(n) (bottom-up heap construction). With handle
+ * tracking, element i of the array gets handle i.
+ *
+ * @param pq  pointer to the PriorityQueue
+ * @param arr the keys to build the heap from (left unchanged)
+ */
+void pqHeapify(PriorityQueue *pq, DynamicArray *arr) {
+    int count = arr->size;
+
+    if (pq->keys.capacity < count + pq->arity) {
+        daResize(&pq->keys, count + pq->arity);
+    }
+    pq->keys.size = pq->pad;
+    alignRoot(pq);
+    memcpy(pq->keys.data + pq->pad, arr->data, sizeof(int) * (size_t)count);
+    pq->keys.size = pq->pad + count;
+
+    pq->free_handles.size = 0;
+    if (pq->track_handles) {
+        if (pq->handles.capacity < count) daResize(&pq->handles, count);
+        if (pq->positions.capacity < count) daResize(&pq->positions, count);
+        for (int i = 0; i < count; i++) {
+            pq->handles.data[i] = i;
+            pq->positions.data[i] = i;
+        }
+        pq->handles.size = count;
+        pq->positions.size = count;
+    }
+
+    for (int i = (count - 2) / pq->arity; i >= 0 && count > 1; i--) {
+        siftDown(pq, i);
+    }
+}
+
+// Insertion/Deletion
+
+/**
+ * Inserts a key into a priority queue.
+ *
+ * @param pq  pointer to the PriorityQueue
+ * @param key the key to insert
+ * @return the key's handle, or -1 if the queue does not track handles
+ */
+int pqPush(PriorityQueue *pq, int key) {
+    int handle = -1;
+
+    daPushBack(&pq->keys, key);
+    if (pq->keys.data != pq->base) alignRoot(pq);
+    int i = pq->keys.size - pq->pad - 1;
+
+    if (pq->track_handles) {
+        if (pq->free_handles.size > 0) {
+            handle = daPopBack(&pq->free_handles);
+            pq->positions.data[handle] = i;
+        } else {
+            handle = pq->positions.size;
+            daPushBack(&pq->positions, i);
+        }
+        daPushBack(&pq->handles, handle);
+    }
+
+    siftUp(pq, i);
+    return handle;
+}
+
+/**
+ * Removes the smallest key of a priority queue. Its handle (see
+ * pqPeekHandle) is no longer valid afterwards.
+ *
+ * @param pq pointer to the PriorityQueue
+ * @return the smallest key; exits if the queue is empty
+ */
+int pqPop(PriorityQueue *pq) {
+    int count = pq->keys.size - pq->pad;
+    if (count == 0) {
+        fprintf(stderr, "Error: pop on empty priority queue\n");
+        exit(EXIT_FAILURE);
+    }
+
+    int *heap = pq->keys.data + pq->pad;
+    int top = heap[0];
+
+    if (pq->track_handles) {
+        int handle = pq->handles.data[0];
+        pq->positions.data[handle] = -1;
+        daPushBack(&pq->free_handles, handle);
+        pq->handles.data[0] = pq->handles.data[count - 1];
+        pq->handles.size--;
+    }
+    heap[0] = heap[count - 1];
+    pq->keys.size--;
+
+    if (count > 1) siftDown(pq, 0);
+    return top;
+}
+
+/**
+ * Lowers the key of a queued element.
+ *
+ * @param pq     pointer to the PriorityQueue (with handle tracking)
+ * @param handle the element's handle, as returned by pqPush
+ * @param key    the new key; must not be larger than the current one
+ */
+void pqDecreaseKey(PriorityQueue *pq, int handle, int key) {
+    int i = positionOf(pq, handle);
+    int *heap = pq->keys.data + pq->pad;
+
+    if (key > heap[i]) {
+        fprintf(stderr, "Error: decreaseKey would increase the key\n");
+        exit(EXIT_FAILURE);
+    }
+    heap[i] = key;
+    siftUp(pq, i);
+}
+
+// Access/Utility
+
+/**
+ * Returns the smallest key of a priority queue without removing it.
+ *
+ * @param pq pointer to the PriorityQueue
+ * @return the smallest key; exits if the queue is empty
+ */
+int pqPeek(PriorityQueue *pq) {
+    if (pq->keys.size == pq->pad) {
+        fprintf(stderr, "Error: peek on empty priority queue\n");
+        exit(EXIT_FAILURE);
+    }
+    return pq->keys.data[pq->pad];
+}
+
+/**
+ * Returns the handle of the smallest key of a priority queue.
+ *
+ * @param pq pointer to the PriorityQueue (with handle tracking)
+ * @return the handle; exits if the queue is empty
+ */
+int pqPeekHandle(PriorityQueue *pq) {
+    if (!pq->track_handles || pq->handles.size == 0) {
+        fprintf(stderr, "Error: peekHandle on empty or untracked priority queue\n");
+        exit(EXIT_FAILURE);
+    }
+    return pq->handles.data[0];
+}
+
+/**
+ * Returns the current key of a queued element.
+ *
+ * @param pq     pointer to the PriorityQueue (with handle tracking)
+ * @param handle the element's handle
+ * @return its key
+ */
+int pqGetKey(PriorityQueue *pq, int handle) {
+    return pq->keys.data[pq->pad + positionOf(pq, handle)];
+}
+
+/**
+ * Returns the number of keys in a priority queue.
+ *
+ * @param pq pointer to the PriorityQueue
+ * @return the number of keys
+ */
+int pqSize(PriorityQueue *pq) {
+    return pq->keys.size - pq->pad;
+}
+
+/**
+ * Checks whether a priority queue is empty.
+ *
+ * @param pq pointer to the PriorityQueue
+ * @return true if empty; false otherwise
+ */
+bool pqIsEmpty(PriorityQueue *pq) {
+    return pq->keys.size == pq->pad;
+}
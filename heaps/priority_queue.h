@@ -0,0 +1,59 @@
+/**
+ * @file priority_queue.h
+ * @brief Public interface of the d-ary heap priority queue for integers.
+ *
+ * PriorityQueue (prefix `pq`) is a min-heap of int keys stored in a
+ * DynamicArray. The arity is chosen at init: 2 (binary heap), 4 or 8.
+ * A wider heap is shallower, so a pop does fewer levels of work, and the
+ * queue places its root so that the children of every node (8, 16 or 32
+ * bytes) sit together in one cache line: each level of a pop then costs
+ * one cache miss no matter how many children are compared.
+ *
+ * With handle tracking enabled, every pushed key gets a handle that
+ * stays valid until the key is popped; decreaseKey uses it to find the
+ * key in O(1). Handles of popped keys are reused by later pushes.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#ifndef PRIORITY_QUEUE_H
+#define PRIORITY_QUEUE_H
+
+#include <stdbool.h>
+
+#include "arrays/dynamic_array.h"
+
+// Largest supported arity (8 int children fill half a 64-byte cache line).
+#define PQ_MAX_ARITY 8
+
+// Structure to represent a d-ary min-heap priority queue.
+typedef struct {
+    DynamicArray keys;          // pad unused slots, then the heap in level order
+    DynamicArray handles;       // handle of the key at every heap index (if tracking)
+    DynamicArray positions;     // heap index of every handle, -1 once popped (if tracking)
+    DynamicArray free_handles;  // handles of popped keys, reused by later pushes
+    int *base;                  // keys.data when pad was computed
+    int pad;                    // slots before the root, so sibling groups are cache-line aligned
+    int arity;                  // number of children per node (2, 4 or 8)
+    bool track_handles;         // whether handles are maintained
+} PriorityQueue;
+
+// Core Functions
+void pqInit(PriorityQueue *pq, int arity, bool track_handles);
+void pqFree(PriorityQueue *pq);
+void pqHeapify(PriorityQueue *pq, DynamicArray *arr);
+
+// Insertion/Deletion
+int pqPush(PriorityQueue *pq, int key);
+int pqPop(PriorityQueue *pq);
+void pqDecreaseKey(PriorityQueue *pq, int handle, int key);
+
+// Access/Utility
+int pqPeek(PriorityQueue *pq);
+int pqPeekHandle(PriorityQueue *pq);
+int pqGetKey(PriorityQueue *pq, int handle);
+int pqSize(PriorityQueue *pq);
+bool pqIsEmpty(PriorityQueue *pq);
+
+#endif // PRIORITY_QUEUE_H
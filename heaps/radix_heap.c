@@ -0,0 +1,295 @@
+/**
+ * @file radix_heap.c
+ * @brief Implementation of the radix heap for monotone integer priorities.
+ *
+ * Keys are stored biased (key ^ 0x80000000 as unsigned) so that unsigned
+ * comparisons order them like ints. Bucket 0 holds keys equal to last;
+ * bucket b > 0 holds keys whose highest bit differing from last is bit
+ * b - 1. When bucket 0 runs dry, pop finds the first non-empty bucket b,
+ * makes its smallest key the new last and redistributes the bucket: every
+ * key in it now differs from last in a lower bit, so it lands in a bucket
+ * below b, and bucket 0 receives at least the new minimum.
+ *
+ * With handle tracking, a key is removed from the middle of its bucket by
+ * moving the bucket's last key into its place.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "radix_heap.h"
+
+// Bias that maps int order onto unsigned order.
+#define RH_BIAS 0x80000000u
+
+// Helpers
+
+/**
+ * Helper function to compute the bucket of a biased key.
+ *
+ * @param last  the biased last popped key
+ * @param value the biased key (not below last)
+ * @return the bucket index (0 to RH_BUCKETS - 1)
+ */
+static inline int bucketOf(unsigned last, unsigned value) {
+    return value == last ? 0 : 32 - __builtin_clz(value ^ last);
+}
+
+/**
+ * Helper function to append a key (and its handle) to a bucket.
+ *
+ * @param heap   pointer to the RadixHeap
+ * @param bucket the bucket
+ * @param key    the key (not biased)
+ * @param handle its handle (ignored without tracking)
+ */
+static void appendKey(RadixHeap *heap, int bucket, int key, int handle) {
+    daPushBack(&heap->keys[bucket], key);
+    if (heap->track_handles) {
+        daPushBack(&heap->handles[bucket], handle);
+        heap->bucket_of.data[handle] = bucket;
+        heap->index_of.data[handle] = heap->keys[bucket].size - 1;
+    }
+}
+
+/**
+ * Helper function to make sure bucket 0 holds the smallest keys, by
+ * redistributing the first non-empty bucket. The heap must not be empty.
+ *
+ * @param heap pointer to the RadixHeap
+ */
+static void refill(RadixHeap *heap) {
+    if (heap->keys[0].size > 0) return;
+
+    int b = 1;
+    while (heap->keys[b].size == 0) b++;
+
+    DynamicArray *keys = &heap->keys[b];
+    unsigned smallest = (unsigned)keys->data[0] ^ RH_BIAS;
+    for (int i = 1; i < keys->size; i++) {
+        unsigned value = (unsigned)keys->data[i] ^ RH_BIAS;
+        smallest = value < smallest ? value : smallest;
+    }
+    heap->last = smallest;
+
+    for (int i = 0; i < keys->size; i++) {
+        int key = keys->data[i];
+        int handle = heap->track_handles ? heap->handles[b].data[i] : -1;
+        appendKey(heap, bucketOf(smallest, (unsigned)key ^ RH_BIAS), key, handle);
+    }
+    keys->size = 0;
+    heap->handles[b].size = 0;
+}
+
+/**
+ * Helper function to check a handle.
+ *
+ * @param heap   pointer to the RadixHeap
+ * @param handle the handle to check; exits if it is not live
+ */
+static void checkHandle(RadixHeap *heap, int handle) {
+    if (!heap->track_handles || handle < 0 || handle >= heap->bucket_of.size || heap->bucket_of.data[handle] < 0) {
+        fprintf(stderr, "Error: Invalid radix heap handle\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+// Core Functions
+
+/**
+ * Initializes an empty radix heap.
+ *
+ * @param heap          pointer to the RadixHeap to initialize
+ * @param track_handles whether pushes return handles for decreaseKey
+ */
+void rhInit(RadixHeap *heap, bool track_handles) {
+    for (int b = 0; b < RH_BUCKETS; b++) {
+        daInit(&heap->keys[b], 4);
+        daInit(&heap->handles[b], track_handles ? 4 : 1);
+    }
+    daInit(&heap->bucket_of, track_handles ? 16 : 1);
+    daInit(&heap->index_of, track_handles ? 16 : 1);
+    daInit(&heap->free_handles, 1);
+    heap->last = 0;
+    heap->size = 0;
+    heap->track_handles = track_handles;
+}
+
+/**
+ * Frees the memory used by a radix heap.
+ *
+ * @param heap pointer to the RadixHeap to free
+ */
+void rhFree(RadixHeap *heap) {
+    for (int b = 0; b < RH_BUCKETS; b++) {
+        daFree(&heap->keys[b]);
+        daFree(&heap->handles[b]);
+    }
+    daFree(&heap->bucket_of);
+    daFree(&heap->index_of);
+    daFree(&heap->free_handles);
+    heap->size = 0;
+}
+
+// Insertion/Deletion
+
+/**
+ * Inserts a key into a radix heap.
+ *
+ * @param heap pointer to the RadixHeap
+ * @param key  the key; exits if it is below the last popped key
+ * @return the key's handle, or -1 if the heap does not track handles
+ */
+int rhPush(RadixHeap *heap, int key) {
+    unsigned value = (unsigned)key ^ RH_BIAS;
+    int handle = -1;
+
+    if (value < heap->last) {
+        fprintf(stderr, "Error: radix heap key below the last popped key\n");
+        exit(EXIT_FAILURE);
+    }
+
+    if (heap->track_handles) {
+        if (heap->free_handles.size > 0) {
+            handle = daPopBack(&heap->free_handles);
+        } else {
+            handle = heap->bucket_of.size;
+            daPushBack(&heap->bucket_of, 0);
+            daPushBack(&heap->index_of, 0);
+        }
+    }
+    appendKey(heap, bucketOf(heap->last, value), key, handle);
+    heap->size++;
+    return handle;
+}
+
+/**
+ * Removes the smallest key of a radix heap. Its handle (see
+ * rhPeekHandle) is no longer valid afterwards.
+ *
+ * @param heap pointer to the RadixHeap
+ * @return the smallest key; exits if the heap is empty
+ */
+int rhPop(RadixHeap *heap) {
+    if (heap->size == 0) {
+        fprintf(stderr, "Error: pop on empty radix heap\n");
+        exit(EXIT_FAILURE);
+    }
+
+    refill(heap);
+    if (heap->track_handles) {
+        int handle = daPopBack(&heap->handles[0]);
+        heap->bucket_of.data[handle] = -1;
+        daPushBack(&heap->free_handles, handle);
+    }
+    heap->size--;
+    return daPopBack(&heap->keys[0]);
+}
+
+/**
+ * Lowers the key of a queued element, moving it to its new bucket.
+ *
+ * @param heap   pointer to the RadixHeap (with handle tracking)
+ * @param handle the element's handle, as returned by rhPush
+ * @param key    the new key; must not be larger than the current one nor
+ *               below the last popped key
+ */
+void rhDecreaseKey(RadixHeap *heap, int handle, int key) {
+    checkHandle(heap, handle);
+    int bucket = heap->bucket_of.data[handle];
+    int index = heap->index_of.data[handle];
+    DynamicArray *keys = &heap->keys[bucket];
+    DynamicArray *handles = &heap->handles[bucket];
+    unsigned value = (unsigned)key ^ RH_BIAS;
+
+    if (key > keys->data[index] || value < heap->last) {
+        fprintf(stderr, "Error: decreaseKey out of range for radix heap\n");
+        exit(EXIT_FAILURE);
+    }
+
+    int target = bucketOf(heap->last, value);
+    if (target == bucket) {
+        keys->data[index] = key;
+        return;
+    }
+
+    // Fill the hole with the bucket's last element.
+    int moved = handles->data[handles->size - 1];
+    keys->data[index] = keys->data[keys->size - 1];
+    handles->data[index] = moved;
+    heap->index_of.data[moved] = index;
+    keys->size--;
+    handles->size--;
+
+    appendKey(heap, target, key, handle);
+}
+
+// Access/Utility
+
+/**
+ * Returns the smallest key of a radix heap without removing it.
+ *
+ * @param heap pointer to the RadixHeap
+ * @return the smallest key; exits if the heap is empty
+ */
+int rhPeek(RadixHeap *heap) {
+    if (heap->size == 0) {
+        fprintf(stderr, "Error: peek on empty radix heap\n");
+        exit(EXIT_FAILURE);
+    }
+
+    refill(heap);
+    return (int)(heap->last ^ RH_BIAS);
+}
+
+/**
+ * Returns the handle of the smallest key of a radix heap (the key that
+ * the next rhPop removes).
+ *
+ * @param heap pointer to the RadixHeap (with handle tracking)
+ * @return the handle; exits if the heap is empty
+ */
+int rhPeekHandle(RadixHeap *heap) {
+    if (!heap->track_handles || heap->size == 0) {
+        fprintf(stderr, "Error: peekHandle on empty or untracked radix heap\n");
+        exit(EXIT_FAILURE);
+    }
+
+    refill(heap);
+    return heap->handles[0].data[heap->handles[0].size - 1];
+}
+
+/**
+ * Returns the current key of a queued element.
+ *
+ * @param heap   pointer to the RadixHeap (with handle tracking)
+ * @param handle the element's handle
+ * @return its key
+ */
+int rhGetKey(RadixHeap *heap, int handle) {
+    checkHandle(heap, handle);
+    return heap->keys[heap->bucket_of.data[handle]].data[heap->index_of.data[handle]];
+}
+
+/**
+ * Returns the number of keys in a radix heap.
+ *
+ * @param heap pointer to the RadixHeap
+ * @return the number of keys
+ */
+int rhSize(RadixHeap *heap) {
+    return heap->size;
+}
+
+/**
+ * Checks whether a radix heap is empty.
+ *
+ * @param heap pointer to the RadixHeap
+ * @return true if empty; false otherwise
+ */
+bool rhIsEmpty(RadixHeap *heap) {
+    return heap->size == 0;
+}
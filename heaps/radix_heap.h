@@ -0,0 +1,59 @@
+/**
+ * @file radix_heap.h
+ * @brief Public interface of the radix heap for monotone integer priorities.
+ *
+ * RadixHeap (prefix `rh`) is a min-heap for workloads whose keys never go
+ * below the last key popped (event timers, Dijkstra with non-negative
+ * weights). Keys are bucketed by the highest bit in which they differ
+ * from the last popped key, so a push is O(1) and a pop moves each key at
+ * most 32 times over its lifetime without a single key comparison
+ * between two queued keys. Pushing a key below the last popped one is an
+ * error.
+ *
+ * Buckets are DynamicArrays. With handle tracking, every key gets a
+ * handle for decreaseKey (still bounded below by the last popped key),
+ * and handles of popped keys are reused by later pushes.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#ifndef RADIX_HEAP_H
+#define RADIX_HEAP_H
+
+#include <stdbool.h>
+
+#include "arrays/dynamic_array.h"
+
+// Number of buckets: keys equal to the last popped key, plus one per differing top bit.
+#define RH_BUCKETS 33
+
+// Structure to represent a radix heap.
+typedef struct {
+    DynamicArray keys[RH_BUCKETS];    // keys of every bucket
+    DynamicArray handles[RH_BUCKETS]; // handle of every key, parallel to keys (if tracking)
+    DynamicArray bucket_of;           // bucket of every handle, -1 once popped (if tracking)
+    DynamicArray index_of;            // index inside its bucket of every handle (if tracking)
+    DynamicArray free_handles;        // handles of popped keys, reused by later pushes
+    unsigned last;                    // last popped key, biased so unsigned order matches int order
+    int size;                         // number of keys in the heap
+    bool track_handles;               // whether handles are maintained
+} RadixHeap;
+
+// Core Functions
+void rhInit(RadixHeap *heap, bool track_handles);
+void rhFree(RadixHeap *heap);
+
+// Insertion/Deletion
+int rhPush(RadixHeap *heap, int key);
+int rhPop(RadixHeap *heap);
+void rhDecreaseKey(RadixHeap *heap, int handle, int key);
+
+// Access/Utility
+int rhPeek(RadixHeap *heap);
+int rhPeekHandle(RadixHeap *heap);
+int rhGetKey(RadixHeap *heap, int handle);
+int rhSize(RadixHeap *heap);
+bool rhIsEmpty(RadixHeap *heap);
+
+#endif // RADIX_HEAP_H
@@ -0,0 +1,637 @@
+/**
+ * @file format.c
+ * @brief Implementation of the buffered text output layer.
+ *
+ * Every element is rendered straight into the buffer: one capacity check
+ * reserves room for the longest possible element, the digits are written
+ * in place from a table of two-digit pairs, and the separators are copied
+ * with memcpy. Layouts describe each format as the text before the first
+ * element, between two elements, after every element and at the end.
+ *
+ * A singly linked list is printed in reverse without recursion and without
+ * copying it: one pass counts the nodes, a second one keeps a checkpoint
+ * every ~sqrt(n) nodes, and the blocks between checkpoints are then
+ * buffered and printed from the last one to the first, using O(sqrt(n))
+ * extra memory.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "format.h"
+
+// Structure to represent the fixed text around the elements of one format.
+typedef struct {
+    const char *open;      // text before the first element
+    const char *between;   // text between two elements
+    const char *after;     // text after every element
+    const char *close;     // text after the last element
+    size_t between_length; // strlen(between)
+    size_t after_length;   // strlen(after)
+} Layout;
+
+// "00" "01" ... "99": two digits per entry.
+static const char DIGIT_PAIRS[] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+// Helpers
+
+/**
+ * Helper function to make room for count more bytes: flushes the buffer
+ * to its sink if it has one, and grows it if that is not enough. A
+ * caller-provided buffer is copied into owned memory the first time it
+ * has to grow.
+ *
+ * @param out   pointer to the OutputBuffer
+ * @param count number of bytes that must fit after the text
+ */
+static void makeRoom(OutputBuffer *out, size_t count) {
+    if (out->sink != NULL) obFlush(out);
+    if (out->capacity - out->length >= count) return;
+
+    size_t capacity = out->capacity > 0 ? out->capacity : 64;
+    while (capacity - out->length < count) {
+        capacity *= 2;
+    }
+
+    char *data = out->owned ? realloc(out->data, capacity) : malloc(capacity);
+    if (data == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    if (!out->owned && out->length > 0) {
+        memcpy(data, out->data, out->length);
+    }
+
+    out->data = data;
+    out->capacity = capacity;
+    out->owned = true;
+}
+
+/**
+ * Helper function to get room for count more bytes at the end of the text.
+ *
+ * @param out   pointer to the OutputBuffer
+ * @param count number of bytes about to be written
+ * @return where to write them
+ */
+static inline char *reserve(OutputBuffer *out, size_t count) {
+    if (out->capacity - out->length < count) makeRoom(out, count);
+    return out->data + out->length;
+}
+
+/**
+ * Helper function to count the decimal digits of a 32-bit value.
+ *
+ * @param value the value
+ * @return the number of digits (1 for 0)
+ */
+static inline int digitCount32(uint32_t value) {
+    if (value < 100000) {
+        if (value < 100) return value < 10 ? 1 : 2;
+        if (value < 10000) return value < 1000 ? 3 : 4;
+        return 5;
+    }
+    if (value < 10000000) return value < 1000000 ? 6 : 7;
+    if (value < 1000000000) return value < 100000000 ? 8 : 9;
+    return 10;
+}
+
+/**
+ * Helper function to write the decimal digits of a 32-bit value.
+ *
+ * @param dst    where to write (at least 10 bytes of room)
+ * @param value  the value
+ * @return the number of bytes written
+ */
+static inline size_t renderUnsigned32(char *dst, uint32_t value) {
+    int digits = digitCount32(value);
+    char *p = dst + digits;
+
+    while (value >= 100) {
+        uint32_t pair = value % 100;
+        value /= 100;
+        p -= 2;
+        memcpy(p, DIGIT_PAIRS + 2 * pair, 2);
+    }
+    if (value >= 10) {
+        memcpy(p - 2, DIGIT_PAIRS + 2 * value, 2);
+    } else {
+        p[-1] = (char)('0' + value);
+    }
+    return (size_t)digits;
+}
+
+/**
+ * Helper function to write an int in decimal.
+ *
+ * @param dst   where to write (at least 11 bytes of room)
+ * @param value the value
+ * @return the number of bytes written
+ */
+static inline size_t renderInt(char *dst, int value) {
+    // The sign is handled without a branch: mixed signs would mispredict half the time.
+    size_t negative = (value < 0);
+    uint32_t magnitude = negative ? 0u - (uint32_t)value : (uint32_t)value;
+
+    *dst = '-';
+    return negative + renderUnsigned32(dst + negative, magnitude);
+}
+
+/**
+ * Helper function to build a layout from its four pieces of text.
+ *
+ * @return the layout
+ */
+static Layout makeLayout(const char *open, const char *between, const char *after, const char *close) {
+    Layout layout = {open, between, after, close, strlen(between), strlen(after)};
+    return layout;
+}
+
+/**
+ * Helper function to pick the layout of an array.
+ *
+ * @param format    the output format
+ * @param separator text between two elements in OUTPUT_TEXT
+ * @return the layout
+ */
+static Layout arrayLayout(OutputFormat format, const char *separator) {
+    switch (format) {
+        case OUTPUT_CSV:  return makeLayout("value\n", "", "\n", "");
+        case OUTPUT_JSON: return makeLayout("[", ",", "", "]\n");
+        case OUTPUT_TEXT:
+        default:          return makeLayout("[", separator, "", "]\n");
+    }
+}
+
+/**
+ * Helper function to pick the layout of a list.
+ *
+ * @param format the output format
+ * @param arrow  text after every element in OUTPUT_TEXT (" -> " or " <-> ")
+ * @return the layout
+ */
+static Layout listLayout(OutputFormat format, const char *arrow) {
+    switch (format) {
+        case OUTPUT_CSV:  return makeLayout("value\n", "", "\n", "");
+        case OUTPUT_JSON: return makeLayout("[", ",", "", "]\n");
+        case OUTPUT_TEXT:
+        default:          return makeLayout("", "", arrow, "NULL\n");
+    }
+}
+
+/**
+ * Helper function to write one int element with the text around it.
+ *
+ * @param out    pointer to the OutputBuffer
+ * @param layout the layout
+ * @param value  the element
+ * @param first  true for the first element
+ */
+static inline void putElement(OutputBuffer *out, const Layout *layout, int value, bool first) {
+    char *p = reserve(out, layout->between_length + 11 + layout->after_length);
+    char *start = p;
+
+    if (!first) {
+        memcpy(p, layout->between, layout->between_length);
+        p += layout->between_length;
+    }
+    p += renderInt(p, value);
+    memcpy(p, layout->after, layout->after_length);
+    p += layout->after_length;
+
+    out->length += (size_t)(p - start);
+}
+
+/**
+ * Helper function to write a run of int elements.
+ *
+ * @param out    pointer to the OutputBuffer
+ * @param layout the layout
+ * @param values the elements
+ * @param count  the number of elements
+ * @param first  true if values[0] is the first element of the structure
+ */
+static void putElements(OutputBuffer *out, const Layout *layout, const int *values, int count, bool first) {
+    for (int i = 0; i < count; i++) {
+        putElement(out, layout, values[i], first && i == 0);
+    }
+}
+
+/**
+ * Helper function to write a run of int elements from the last one to the first.
+ *
+ * @param out    pointer to the OutputBuffer
+ * @param layout the layout
+ * @param values the elements
+ * @param count  the number of elements
+ * @param first  true if values[count - 1] is the first element written
+ */
+static void putElementsReverse(OutputBuffer *out, const Layout *layout, const int *values, int count,
+                               bool first) {
+    for (int i = count - 1; i >= 0; i--) {
+        putElement(out, layout, values[i], first && i == count - 1);
+    }
+}
+
+/**
+ * Helper function to allocate memory for the reverse printing of a list.
+ *
+ * @param bytes the number of bytes
+ * @return the memory
+ */
+static void *allocOrDie(size_t bytes) {
+    void *memory = malloc(bytes > 0 ? bytes : 1);
+    if (memory == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    return memory;
+}
+
+// Core lifecycle
+
+/**
+ * Initializes an output buffer that allocates its own memory.
+ * With a sink the buffer is flushed to it whenever it is full; without
+ * one it grows and keeps all of the text.
+ *
+ * @param out      pointer to the OutputBuffer to initialize
+ * @param sink     stream to flush to (NULL to keep the text in memory)
+ * @param capacity initial size (in bytes) of the buffer
+ *                 (0 for OUTPUT_BUFFER_DEFAULT_CAPACITY)
+ */
+void obInit(OutputBuffer *out, FILE *sink, size_t capacity) {
+    if (capacity == 0) capacity = OUTPUT_BUFFER_DEFAULT_CAPACITY;
+
+    out->data = malloc(capacity);
+    out->length = 0;
+    out->capacity = capacity;
+    out->sink = sink;
+    out->owned = true;
+    out->failed = false;
+
+    if (out->data == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+/**
+ * Initializes an output buffer over memory provided by the caller (e.g. an
+ * array on the stack). With a sink the buffer is flushed to it whenever it
+ * is full and never allocates, so it must hold at least
+ * OUTPUT_BUFFER_MIN_CAPACITY bytes; without one the text moves to
+ * allocated memory once it outgrows the caller's buffer, so read it back
+ * through out->data or obString.
+ *
+ * @param out      pointer to the OutputBuffer to initialize
+ * @param buffer   memory to render into
+ * @param capacity size (in bytes) of buffer; exits if a sink is given and
+ *                 it is below OUTPUT_BUFFER_MIN_CAPACITY
+ * @param sink     stream to flush to (NULL to keep the text in memory)
+ */
+void obInitBuffer(OutputBuffer *out, char *buffer, size_t capacity, FILE *sink) {
+    if (sink != NULL && (buffer == NULL || capacity < OUTPUT_BUFFER_MIN_CAPACITY)) {
+        fprintf(stderr, "Error: output buffer with a sink needs at least %d bytes\n", OUTPUT_BUFFER_MIN_CAPACITY);
+        exit(EXIT_FAILURE);
+    }
+
+    out->data = buffer;
+    out->length = 0;
+    out->capacity = buffer != NULL ? capacity : 0;
+    out->sink = sink;
+    out->owned = false;
+    out->failed = false;
+}
+
+/**
+ * Writes the buffered text to the sink in one fwrite and empties the buffer.
+ * Does nothing without a sink. After a failed write the output buffer
+ * drops all further text.
+ *
+ * @param out pointer to the OutputBuffer
+ * @return 0 on success; -1 if this or an earlier write failed
+ */
+int obFlush(OutputBuffer *out) {
+    if (out->sink == NULL) return 0;
+
+    if (!out->failed && out->length > 0 &&
+        fwrite(out->data, 1, out->length, out->sink) != out->length) {
+        fprintf(stderr, "Error: cannot write output\n");
+        out->failed = true;
+    }
+    out->length = 0;
+    return out->failed ? -1 : 0;
+}
+
+/**
+ * Flushes an output buffer to its sink and frees the memory it allocated.
+ * The text of a buffer without a sink is lost, so read it first.
+ *
+ * @param out pointer to the OutputBuffer to free
+ * @return 0 on success; -1 if a write to the sink failed
+ */
+int obFree(OutputBuffer *out) {
+    int status = obFlush(out);
+
+    if (out->owned) free(out->data);
+    out->data = NULL;
+    out->length = 0;
+    out->capacity = 0;
+    return status;
+}
+
+// Output
+
+/**
+ * Appends raw bytes to an output buffer. With a sink, bytes that would
+ * not fit even in an empty buffer are written straight to the sink.
+ *
+ * @param out   pointer to the OutputBuffer
+ * @param bytes the bytes
+ * @param count the number of bytes
+ */
+void obWrite(OutputBuffer *out, const void *bytes, size_t count) {
+    if (count == 0) return;
+    if (out->sink != NULL && count > out->capacity) {
+        if (obFlush(out) == 0 && fwrite(bytes, 1, count, out->sink) != count) {
+            fprintf(stderr, "Error: cannot write output\n");
+            out->failed = true;
+        }
+        return;
+    }
+    memcpy(reserve(out, count), bytes, count);
+    out->length += count;
+}
+
+/**
+ * Appends one character to an output buffer.
+ *
+ * @param out pointer to the OutputBuffer
+ * @param c   the character
+ */
+void obPutChar(OutputBuffer *out, char c) {
+    *reserve(out, 1) = c;
+    out->length++;
+}
+
+/**
+ * Appends a NUL-terminated string to an output buffer.
+ *
+ * @param out  pointer to the OutputBuffer
+ * @param text the string
+ */
+void obPutString(OutputBuffer *out, const char *text) {
+    obWrite(out, text, strlen(text));
+}
+
+/**
+ * Appends an int in decimal to an output buffer.
+ *
+ * @param out   pointer to the OutputBuffer
+ * @param value the value
+ */
+void obPutInt(OutputBuffer *out, int value) {
+    out->length += renderInt(reserve(out, 11), value);
+}
+
+/**
+ * Appends a long long in decimal to an output buffer.
+ *
+ * @param out   pointer to the OutputBuffer
+ * @param value the value
+ */
+void obPutLong(OutputBuffer *out, long long value) {
+    char *p = reserve(out, OUTPUT_MAX_INT_DIGITS);
+    char *start = p;
+    unsigned long long magnitude = (unsigned long long)value;
+
+    if (value < 0) {
+        *p++ = '-';
+        magnitude = 0ULL - magnitude;
+    }
+
+    // Peel off 9-digit chunks so the 32-bit renderer does the digits.
+    uint32_t chunks[3];
+    int count = 0;
+    while (magnitude >= 1000000000ULL) {
+        chunks[count++] = (uint32_t)(magnitude % 1000000000ULL);
+        magnitude /= 1000000000ULL;
+    }
+    p += renderUnsigned32(p, (uint32_t)magnitude);
+    while (count > 0) {
+        uint32_t chunk = chunks[--count];
+        for (int i = 8; i >= 0; i--) {
+            p[i] = (char)('0' + chunk % 10);
+            chunk /= 10;
+        }
+        p += 9;
+    }
+
+    out->length += (size_t)(p - start);
+}
+
+/**
+ * Returns the text of an output buffer as a NUL-terminated string.
+ * Without a sink this is everything written so far; with one it is only
+ * the part not flushed yet. Valid until the next write to the buffer.
+ *
+ * @param out pointer to the OutputBuffer
+ * @return the text
+ */
+const char *obString(OutputBuffer *out) {
+    char *end = reserve(out, 1);
+    *end = '\0';
+    return out->data;
+}
+
+// Structures
+
+/**
+ * Renders a dynamic array. OUTPUT_TEXT gives "[1,2,3]".
+ *
+ * @param arr    pointer to the DynamicArray
+ * @param out    pointer to the OutputBuffer
+ * @param format the output format
+ */
+void daFormat(DynamicArray *arr, OutputBuffer *out, OutputFormat format) {
+    Layout layout = arrayLayout(format, ",");
+
+    obPutString(out, layout.open);
+    putElements(out, &layout, arr->data, arr->size, true);
+    obPutString(out, layout.close);
+}
+
+/**
+ * Renders a generic array with a caller-provided element formatter.
+ * OUTPUT_TEXT gives "[a, b, c]". For OUTPUT_JSON the formatter must write
+ * a JSON value and for OUTPUT_CSV one CSV field (or row).
+ *
+ * @param arr        pointer to the GenericArray
+ * @param out        pointer to the OutputBuffer
+ * @param format     the output format
+ * @param formatFunc function that writes one element to the buffer
+ */
+void gaFormat(GenericArray *arr, OutputBuffer *out, OutputFormat format,
+              void (*formatFunc)(OutputBuffer *, const void *)) {
+    Layout layout = arrayLayout(format, ", ");
+
+    obPutString(out, layout.open);
+    for (int i = 0; i < arr->size; i++) {
+        if (i > 0) obWrite(out, layout.between, layout.between_length);
+        formatFunc(out, (const char *)arr->data + (size_t)i * arr->element_size);
+        obWrite(out, layout.after, layout.after_length);
+    }
+    obPutString(out, layout.close);
+}
+
+/**
+ * Renders a linked list from head to tail. OUTPUT_TEXT gives "1 -> 2 -> NULL".
+ *
+ * @param list   pointer to the LinkedList
+ * @param out    pointer to the OutputBuffer
+ * @param format the output format
+ */
+void llFormat(LinkedList *list, OutputBuffer *out, OutputFormat format) {
+    Layout layout = listLayout(format, " -> ");
+    bool first = true;
+
+    obPutString(out, layout.open);
+    for (LLNode *curr = list->head; curr != NULL; curr = curr->next) {
+        putElement(out, &layout, curr->data, first);
+        first = false;
+    }
+    obPutString(out, layout.close);
+}
+
+/**
+ * Renders a linked list from tail to head, iteratively and with
+ * O(sqrt(n)) extra memory. Only list->head is used, so the list may be a
+ * view starting at any node. OUTPUT_TEXT gives "2 -> 1 -> NULL".
+ *
+ * @param list   pointer to the LinkedList
+ * @param out    pointer to the OutputBuffer
+ * @param format the output format
+ */
+void llFormatReverse(LinkedList *list, OutputBuffer *out, OutputFormat format) {
+    Layout layout = listLayout(format, " -> ");
+    long count = 0;
+
+    for (LLNode *curr = list->head; curr != NULL; curr = curr->next) {
+        count++;
+    }
+
+    long block = 1;
+    while ((block + 1) * (block + 1) <= count) {
+        block++;
+    }
+    long checkpoints = (count + block - 1) / block;
+
+    LLNode **starts = allocOrDie(sizeof(LLNode *) * (size_t)checkpoints);
+    int *values = allocOrDie(sizeof(int) * (size_t)block);
+
+    long index = 0;
+    for (LLNode *curr = list->head; curr != NULL; curr = curr->next, index++) {
+        if (index % block == 0) starts[index / block] = curr;
+    }
+
+    obPutString(out, layout.open);
+    for (long c = checkpoints - 1; c >= 0; c--) {
+        int n = 0;
+        for (LLNode *curr = starts[c]; curr != NULL && n < block; curr = curr->next) {
+            values[n++] = curr->data;
+        }
+        putElementsReverse(out, &layout, values, n, c == checkpoints - 1);
+    }
+    obPutString(out, layout.close);
+
+    free(values);
+    free(starts);
+}
+
+/**
+ * Renders a doubly linked list from head to tail. OUTPUT_TEXT gives "1 <-> 2 <-> NULL".
+ *
+ * @param list   pointer to the DoublyLinkedList
+ * @param out    pointer to the OutputBuffer
+ * @param format the output format
+ */
+void dllFormat(DoublyLinkedList *list, OutputBuffer *out, OutputFormat format) {
+    Layout layout = listLayout(format, " <-> ");
+    bool first = true;
+
+    obPutString(out, layout.open);
+    for (DLLNode *curr = list->head; curr != NULL; curr = curr->next) {
+        putElement(out, &layout, curr->data, first);
+        first = false;
+    }
+    obPutString(out, layout.close);
+}
+
+/**
+ * Renders a doubly linked list from tail to head. OUTPUT_TEXT gives "2 <-> 1 <-> NULL".
+ *
+ * @param list   pointer to the DoublyLinkedList
+ * @param out    pointer to the OutputBuffer
+ * @param format the output format
+ */
+void dllFormatReverse(DoublyLinkedList *list, OutputBuffer *out, OutputFormat format) {
+    Layout layout = listLayout(format, " <-> ");
+    bool first = true;
+
+    obPutString(out, layout.open);
+    for (DLLNode *curr = list->tail; curr != NULL; curr = curr->prev) {
+        putElement(out, &layout, curr->data, first);
+        first = false;
+    }
+    obPutString(out, layout.close);
+}
+
+/**
+ * Renders an unrolled linked list from head to tail, one node's values at
+ * a time. OUTPUT_TEXT gives "1 <-> 2 <-> NULL".
+ *
+ * @param list   pointer to the UnrolledLinkedList
+ * @param out    pointer to the OutputBuffer
+ * @param format the output format
+ */
+void ullFormat(UnrolledLinkedList *list, OutputBuffer *out, OutputFormat format) {
+    Layout layout = listLayout(format, " <-> ");
+    bool first = true;
+
+    obPutString(out, layout.open);
+    for (ULLNode *curr = list->head; curr != NULL; curr = curr->next) {
+        putElements(out, &layout, curr->values, curr->count, first);
+        first = first && curr->count == 0;
+    }
+    obPutString(out, layout.close);
+}
+
+/**
+ * Renders an unrolled linked list from tail to head. OUTPUT_TEXT gives
+ * "2 <-> 1 <-> NULL".
+ *
+ * @param list   pointer to the UnrolledLinkedList
+ * @param out    pointer to the OutputBuffer
+ * @param format the output format
+ */
+void ullFormatReverse(UnrolledLinkedList *list, OutputBuffer *out, OutputFormat format) {
+    Layout layout = listLayout(format, " <-> ");
+    bool first = true;
+
+    obPutString(out, layout.open);
+    for (ULLNode *curr = list->tail; curr != NULL; curr = curr->prev) {
+        putElementsReverse(out, &layout, curr->values, curr->count, first);
+        first = first && curr->count == 0;
+    }
+    obPutString(out, layout.close);
+}
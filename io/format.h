@@ -0,0 +1,86 @@
+/**
+ * @file format.h
+ * @brief Public interface of the buffered text output layer.
+ *
+ * An OutputBuffer collects rendered text in memory and hands it to its
+ * FILE in large writes, so dumping a structure costs one fwrite per
+ * buffer instead of one printf per element. Without a FILE the buffer
+ * grows instead and keeps all of the text, e.g. to build a string.
+ * Integers are converted to text two digits at a time.
+ *
+ * The xxFormat functions render a whole structure in one of three formats:
+ *   OUTPUT_TEXT  the same text as the xxPrint functions
+ *   OUTPUT_CSV   a "value" header row, then one element per row
+ *   OUTPUT_JSON  one array, e.g. [1,2,3]
+ * Each rendering ends with a newline. The xxPrint functions are built on
+ * this layer and write to stdout.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#ifndef FORMAT_H
+#define FORMAT_H
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "arrays/dynamic_array.h"
+#include "arrays/generic_array.h"
+#include "linked_lists/linked_list.h"
+#include "linked_lists/doubly_linked_list.h"
+#include "linked_lists/unrolled_linked_list.h"
+
+// Capacity (in bytes) obInit uses when given 0.
+#define OUTPUT_BUFFER_DEFAULT_CAPACITY (64 * 1024)
+
+// Smallest buffer obInitBuffer accepts with a sink: room for any single element and the text around it.
+#define OUTPUT_BUFFER_MIN_CAPACITY 64
+
+// Longest text obPutInt and obPutLong produce ("-9223372036854775808").
+#define OUTPUT_MAX_INT_DIGITS 20
+
+// Layout used by the xxFormat functions.
+typedef enum {
+    OUTPUT_TEXT,
+    OUTPUT_CSV,
+    OUTPUT_JSON
+} OutputFormat;
+
+// Structure to represent a buffer of rendered text.
+typedef struct {
+    char *data;      // the rendered text not yet flushed (not NUL-terminated)
+    size_t length;   // number of bytes of text in data
+    size_t capacity; // number of bytes data can hold
+    FILE *sink;      // stream full buffers are flushed to (NULL to grow instead)
+    bool owned;      // data was allocated by the buffer and is freed by obFree
+    bool failed;     // a flush to sink failed; later output is dropped
+} OutputBuffer;
+
+// Core lifecycle
+void obInit(OutputBuffer *out, FILE *sink, size_t capacity);
+void obInitBuffer(OutputBuffer *out, char *buffer, size_t capacity, FILE *sink);
+int obFlush(OutputBuffer *out);
+int obFree(OutputBuffer *out);
+
+// Output
+void obWrite(OutputBuffer *out, const void *bytes, size_t count);
+void obPutChar(OutputBuffer *out, char c);
+void obPutString(OutputBuffer *out, const char *text);
+void obPutInt(OutputBuffer *out, int value);
+void obPutLong(OutputBuffer *out, long long value);
+const char *obString(OutputBuffer *out);
+
+// Structures
+void daFormat(DynamicArray *arr, OutputBuffer *out, OutputFormat format);
+void gaFormat(GenericArray *arr, OutputBuffer *out, OutputFormat format,
+              void (*formatFunc)(OutputBuffer *, const void *));
+void llFormat(LinkedList *list, OutputBuffer *out, OutputFormat format);
+void llFormatReverse(LinkedList *list, OutputBuffer *out, OutputFormat format);
+void dllFormat(DoublyLinkedList *list, OutputBuffer *out, OutputFormat format);
+void dllFormatReverse(DoublyLinkedList *list, OutputBuffer *out, OutputFormat format);
+void ullFormat(UnrolledLinkedList *list, OutputBuffer *out, OutputFormat format);
+void ullFormatReverse(UnrolledLinkedList *list, OutputBuffer *out, OutputFormat format);
+
+#endif // FORMAT_H
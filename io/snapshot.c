@@ -0,0 +1,630 @@
+/**
+ * @file snapshot.c
+ * @brief Implementation of the binary snapshot format for arrays and lists.
+ *
+ * Arrays are written and read straight from and into their buffers in
+ * SNAPSHOT_BLOCK_SIZE pieces, so a save or load costs one pass of CRC-32C
+ * on top of the copy the stdio read or write does anyway. Lists go through
+ * one block-sized staging buffer: saving fills it from the nodes, loading
+ * takes runs of fresh nodes from the list's node pool (npAllocRun) and
+ * links a whole block of values at a time.
+ *
+ * CRC-32C uses the SSE4.2 crc32 instruction when the CPU has it (picked at
+ * runtime like the DynamicArray scans) and slice-by-8 tables otherwise.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <limits.h>
+#include <pthread.h>
+
+#include "snapshot.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define HAVE_CRC32_KERNEL 1
+#include <immintrin.h>
+#endif
+
+// CRC-32C (Castagnoli) polynomial, bit-reflected.
+#define CRC32C_POLY 0x82F63B78u
+
+// Value the byte_order field reads as when the file was written on a machine like this one.
+#define SNAPSHOT_BYTE_ORDER 0x01020304u
+
+// Structure to represent the header at the start of every snapshot.
+typedef struct {
+    char magic[8];            // "DSALGOSN"
+    uint32_t version;         // SNAPSHOT_VERSION
+    uint32_t kind;            // SnapshotKind of the saved structure
+    uint64_t element_size;    // size (in bytes) of each element
+    uint64_t count;           // number of elements that follow the header
+    uint32_t byte_order;      // SNAPSHOT_BYTE_ORDER in the writer's byte order
+    uint32_t header_checksum; // CRC-32C of the fields above
+} SnapshotHeader;
+
+_Static_assert(sizeof(SnapshotHeader) == SNAPSHOT_HEADER_SIZE, "SnapshotHeader must match SNAPSHOT_HEADER_SIZE");
+
+static const char SNAPSHOT_MAGIC[8] = {'D', 'S', 'A', 'L', 'G', 'O', 'S', 'N'};
+
+static uint32_t crc_table[8][256];
+static bool crc_hardware;                          // whether the SSE4.2 crc32 instruction is used
+static pthread_once_t crc_once = PTHREAD_ONCE_INIT; // runs initCrc once, before any checksum
+
+// Helpers
+
+/**
+ * Helper function to fill the slice-by-8 CRC-32C tables.
+ */
+static void buildCrcTable(void) {
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (CRC32C_POLY & (0u - (crc & 1)));
+        }
+        crc_table[0][i] = crc;
+    }
+    for (int t = 1; t < 8; t++) {
+        for (int i = 0; i < 256; i++) {
+            uint32_t prev = crc_table[t - 1][i];
+            crc_table[t][i] = (prev >> 8) ^ crc_table[0][prev & 0xFF];
+        }
+    }
+}
+
+/**
+ * Helper function to pick the CRC-32C kernel for this CPU, building the
+ * tables when the hardware instruction is not available. Runs once under
+ * crc_once, so every caller sees the finished tables.
+ */
+static void initCrc(void) {
+    crc_hardware = false;
+#ifdef HAVE_CRC32_KERNEL
+    __builtin_cpu_init();
+    crc_hardware = __builtin_cpu_supports("sse4.2");
+#endif
+    if (!crc_hardware) buildCrcTable();
+}
+
+/**
+ * Helper function to advance a CRC-32C over a buffer with slice-by-8 tables.
+ * Bytes are combined explicitly, so the result does not depend on the
+ * machine's byte order.
+ *
+ * @param crc   running CRC (inverted)
+ * @param bytes the data
+ * @param n     the number of bytes
+ * @return the running CRC after the data
+ */
+static uint32_t crcTable(uint32_t crc, const unsigned char *bytes, size_t n) {
+    for (; n >= 8; n -= 8, bytes += 8) {
+        uint32_t low = crc ^ ((uint32_t)bytes[0] | (uint32_t)bytes[1] << 8 |
+                              (uint32_t)bytes[2] << 16 | (uint32_t)bytes[3] << 24);
+        crc = crc_table[7][low & 0xFF] ^ crc_table[6][(low >> 8) & 0xFF] ^
+              crc_table[5][(low >> 16) & 0xFF] ^ crc_table[4][low >> 24] ^
+              crc_table[3][bytes[4]] ^ crc_table[2][bytes[5]] ^
+              crc_table[1][bytes[6]] ^ crc_table[0][bytes[7]];
+    }
+    for (; n > 0; n--, bytes++) {
+        crc = (crc >> 8) ^ crc_table[0][(crc ^ *bytes) & 0xFF];
+    }
+    return crc;
+}
+
+#ifdef HAVE_CRC32_KERNEL
+
+/**
+ * Helper function to advance a CRC-32C over a buffer with the SSE4.2 crc32 instruction.
+ * Follows the contract of crcTable.
+ */
+__attribute__((target("sse4.2")))
+static uint32_t crcHardware(uint32_t crc, const unsigned char *bytes, size_t n) {
+    uint64_t crc64 = crc;
+    for (; n >= 8; n -= 8, bytes += 8) {
+        uint64_t word;
+        memcpy(&word, bytes, sizeof(word));
+        crc64 = _mm_crc32_u64(crc64, word);
+    }
+    crc = (uint32_t)crc64;
+    for (; n > 0; n--, bytes++) {
+        crc = _mm_crc32_u8(crc, *bytes);
+    }
+    return crc;
+}
+
+#endif
+
+/**
+ * Helper function to write bytes, folding them into a running CRC first.
+ *
+ * @param file  the stream to write to
+ * @param data  the bytes to write
+ * @param bytes the number of bytes
+ * @param crc   in/out: running CRC-32C of everything written so far (NULL to skip)
+ * @return 0 on success; -1 on a write error
+ */
+static int writeBytes(FILE *file, const void *data, size_t bytes, uint32_t *crc) {
+    if (crc != NULL) *crc = snapshotCrc32c(*crc, data, bytes);
+    if (bytes > 0 && fwrite(data, 1, bytes, file) != bytes) {
+        fprintf(stderr, "Error: cannot write snapshot\n");
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * Helper function to read bytes, folding them into a running CRC.
+ *
+ * @param file  the stream to read from
+ * @param data  output: the bytes read
+ * @param bytes the number of bytes
+ * @param crc   in/out: running CRC-32C of everything read so far (NULL to skip)
+ * @return 0 on success; -1 on a read error or a truncated snapshot
+ */
+static int readBytes(FILE *file, void *data, size_t bytes, uint32_t *crc) {
+    if (bytes > 0 && fread(data, 1, bytes, file) != bytes) {
+        fprintf(stderr, "Error: snapshot is truncated\n");
+        return -1;
+    }
+    if (crc != NULL) *crc = snapshotCrc32c(*crc, data, bytes);
+    return 0;
+}
+
+/**
+ * Helper function to write a snapshot header.
+ *
+ * @param file         the stream to write to
+ * @param kind         structure being saved
+ * @param element_size size (in bytes) of each element
+ * @param count        number of elements that will follow
+ * @return 0 on success; -1 on a write error
+ */
+static int writeHeader(FILE *file, SnapshotKind kind, size_t element_size, long long count) {
+    SnapshotHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+    header.version = SNAPSHOT_VERSION;
+    header.kind = (uint32_t)kind;
+    header.element_size = element_size;
+    header.count = (uint64_t)count;
+    header.byte_order = SNAPSHOT_BYTE_ORDER;
+    header.header_checksum = snapshotCrc32c(0, &header, offsetof(SnapshotHeader, header_checksum));
+    return writeBytes(file, &header, sizeof(header), NULL);
+}
+
+/**
+ * Helper function to read and check a snapshot header.
+ * Rejects anything this version cannot load, unknown kinds, and counts
+ * beyond INT_MAX, which no structure here can hold.
+ *
+ * @param file   the stream to read from
+ * @param header output: the header
+ * @return 0 on success; -1 on an error or an invalid header
+ */
+static int readHeader(FILE *file, SnapshotHeader *header) {
+    if (readBytes(file, header, sizeof(*header), NULL) != 0) return -1;
+
+    if (memcmp(header->magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0) {
+        fprintf(stderr, "Error: not a snapshot\n");
+        return -1;
+    }
+    if (header->header_checksum != snapshotCrc32c(0, header, offsetof(SnapshotHeader, header_checksum))) {
+        fprintf(stderr, "Error: snapshot header is corrupt\n");
+        return -1;
+    }
+    if (header->version != SNAPSHOT_VERSION) {
+        fprintf(stderr, "Error: unsupported snapshot version %u\n", header->version);
+        return -1;
+    }
+    if (header->byte_order != SNAPSHOT_BYTE_ORDER) {
+        fprintf(stderr, "Error: snapshot was saved with a different byte order\n");
+        return -1;
+    }
+    if (header->kind < SNAPSHOT_DYNAMIC_ARRAY || header->kind > SNAPSHOT_DOUBLY_LINKED_LIST) {
+        fprintf(stderr, "Error: unknown snapshot kind %u\n", header->kind);
+        return -1;
+    }
+    if (header->element_size == 0 || header->count > INT_MAX ||
+        header->element_size > SIZE_MAX / (header->count > 0 ? header->count : 1)) {
+        fprintf(stderr, "Error: snapshot header is corrupt\n");
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * Helper function to read an int snapshot header, for the int containers.
+ *
+ * @param file   the stream to read from
+ * @param header output: the header
+ * @return 0 on success; -1 on an error or if the snapshot does not hold ints
+ */
+static int readIntHeader(FILE *file, SnapshotHeader *header) {
+    if (readHeader(file, header) != 0) return -1;
+
+    if (header->kind == SNAPSHOT_GENERIC_ARRAY || header->element_size != sizeof(int)) {
+        fprintf(stderr, "Error: snapshot does not hold ints\n");
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * Helper function to write the elements of an array and the trailing checksum.
+ *
+ * @param file  the stream to write to
+ * @param data  the elements
+ * @param bytes size (in bytes) of the elements
+ * @return 0 on success; -1 on a write error
+ */
+static int writePayload(FILE *file, const void *data, size_t bytes) {
+    const char *bytes_left = data;
+    uint32_t crc = 0;
+
+    while (bytes > 0) {
+        size_t block = bytes < SNAPSHOT_BLOCK_SIZE ? bytes : SNAPSHOT_BLOCK_SIZE;
+        if (writeBytes(file, bytes_left, block, &crc) != 0) return -1;
+        bytes_left += block;
+        bytes -= block;
+    }
+    return writeBytes(file, &crc, sizeof(crc), NULL);
+}
+
+/**
+ * Helper function to read the trailing checksum and compare it with the
+ * CRC of the elements read.
+ *
+ * @param file the stream to read from
+ * @param crc  CRC-32C of the elements read
+ * @return 0 if they match; -1 otherwise
+ */
+static int readTrailer(FILE *file, uint32_t crc) {
+    uint32_t stored;
+    if (readBytes(file, &stored, sizeof(stored), NULL) != 0) return -1;
+
+    if (stored != crc) {
+        fprintf(stderr, "Error: snapshot checksum mismatch\n");
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * Helper function to read the elements of an array and check the trailing checksum.
+ *
+ * @param file  the stream to read from
+ * @param data  output: the elements
+ * @param bytes size (in bytes) of the elements
+ * @return 0 on success; -1 on an error or a checksum mismatch
+ */
+static int readPayload(FILE *file, void *data, size_t bytes) {
+    char *bytes_left = data;
+    uint32_t crc = 0;
+
+    while (bytes > 0) {
+        size_t block = bytes < SNAPSHOT_BLOCK_SIZE ? bytes : SNAPSHOT_BLOCK_SIZE;
+        if (readBytes(file, bytes_left, block, &crc) != 0) return -1;
+        bytes_left += block;
+        bytes -= block;
+    }
+    return readTrailer(file, crc);
+}
+
+/**
+ * Helper function to allocate the staging buffer used by list saves and loads.
+ *
+ * @return a buffer of SNAPSHOT_BLOCK_SIZE bytes
+ */
+static int *allocBlock(void) {
+    int *block = malloc(SNAPSHOT_BLOCK_SIZE);
+    if (block == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    return block;
+}
+
+/**
+ * Helper function to pick the slab size of the node pool of a loaded list.
+ *
+ * @param count number of values in the snapshot
+ * @return nodes per slab
+ */
+static int listSlabNodes(long long count) {
+    if (count < 64) return 64;
+    return count < SNAPSHOT_LIST_SLAB_NODES ? (int)count : SNAPSHOT_LIST_SLAB_NODES;
+}
+
+/**
+ * Helper function to take a run of fresh nodes from a node pool.
+ * Exits if the pool cannot allocate a slab, like a failed node allocation.
+ *
+ * @param pool      the node pool
+ * @param max_nodes largest number of nodes wanted
+ * @param count     output: number of nodes in the run
+ * @return the first node of the run
+ */
+static char *takeNodes(NodePool *pool, int max_nodes, int *count) {
+    char *nodes = npAllocRun(pool, max_nodes, count);
+    if (nodes == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    return nodes;
+}
+
+// Arrays
+
+/**
+ * Saves a dynamic array as a snapshot.
+ *
+ * @param arr  pointer to the DynamicArray to save
+ * @param file the stream to write to
+ * @return 0 on success; -1 on a write error
+ */
+int daSave(DynamicArray *arr, FILE *file) {
+    if (writeHeader(file, SNAPSHOT_DYNAMIC_ARRAY, sizeof(int), arr->size) != 0) return -1;
+    return writePayload(file, arr->data, sizeof(int) * (size_t)arr->size);
+}
+
+/**
+ * Loads a snapshot of ints (of any int container) into a new dynamic array
+ * whose capacity is exactly the number of elements (at least 1).
+ *
+ * @param arr  pointer to the DynamicArray to initialize
+ * @param file the stream to read from
+ * @return 0 on success; -1 on an error (arr is left untouched)
+ */
+int daLoad(DynamicArray *arr, FILE *file) {
+    SnapshotHeader header;
+    if (readIntHeader(file, &header) != 0) return -1;
+
+    DynamicArray loaded;
+    daInit(&loaded, header.count > 0 ? (int)header.count : 1);
+    if (readPayload(file, loaded.data, sizeof(int) * (size_t)header.count) != 0) {
+        daFree(&loaded);
+        return -1;
+    }
+
+    loaded.size = (int)header.count;
+    *arr = loaded;
+    return 0;
+}
+
+/**
+ * Saves a generic array as a snapshot of its raw elements.
+ *
+ * @param arr  pointer to the GenericArray to save
+ * @param file the stream to write to
+ * @return 0 on success; -1 on a write error
+ */
+int gaSave(GenericArray *arr, FILE *file) {
+    if (writeHeader(file, SNAPSHOT_GENERIC_ARRAY, arr->element_size, arr->size) != 0) return -1;
+    return writePayload(file, arr->data, arr->element_size * (size_t)arr->size);
+}
+
+/**
+ * Loads any snapshot into a new generic array whose element size is the
+ * one stored in the snapshot and whose capacity is exactly the number of
+ * elements (at least 1).
+ *
+ * @param arr  pointer to the GenericArray to initialize
+ * @param file the stream to read from
+ * @return 0 on success; -1 on an error (arr is left untouched)
+ */
+int gaLoad(GenericArray *arr, FILE *file) {
+    SnapshotHeader header;
+    if (readHeader(file, &header) != 0) return -1;
+
+    GenericArray loaded;
+    gaInit(&loaded, (size_t)header.element_size, header.count > 0 ? (int)header.count : 1);
+    if (readPayload(file, loaded.data, (size_t)header.element_size * (size_t)header.count) != 0) {
+        gaFree(&loaded);
+        return -1;
+    }
+
+    loaded.size = (int)header.count;
+    *arr = loaded;
+    return 0;
+}
+
+// Lists
+
+/**
+ * Saves a linked list as a snapshot of its values from head to tail.
+ *
+ * @param list pointer to the LinkedList to save
+ * @param file the stream to write to
+ * @return 0 on success; -1 on a write error
+ */
+int llSave(LinkedList *list, FILE *file) {
+    if (writeHeader(file, SNAPSHOT_LINKED_LIST, sizeof(int), list->size) != 0) return -1;
+
+    int *block = allocBlock();
+    int per_block = SNAPSHOT_BLOCK_SIZE / sizeof(int);
+    uint32_t crc = 0;
+    int status = 0;
+
+    for (LLNode *curr = list->head; curr != NULL && status == 0;) {
+        int n = 0;
+        for (; n < per_block && curr != NULL; n++, curr = curr->next) {
+            block[n] = curr->data;
+        }
+        status = writeBytes(file, block, sizeof(int) * (size_t)n, &crc);
+    }
+    if (status == 0) status = writeBytes(file, &crc, sizeof(crc), NULL);
+
+    free(block);
+    return status;
+}
+
+/**
+ * Loads a snapshot of ints (of any int container) into a new pooled
+ * linked list (see llInitPooled), building its nodes a run at a time.
+ *
+ * @param list pointer to the LinkedList to initialize
+ * @param file the stream to read from
+ * @return 0 on success; -1 on an error (list is left untouched)
+ */
+int llLoad(LinkedList *list, FILE *file) {
+    SnapshotHeader header;
+    if (readIntHeader(file, &header) != 0) return -1;
+
+    LinkedList loaded;
+    llInitPooled(&loaded, listSlabNodes((long long)header.count));
+
+    int *block = allocBlock();
+    int per_block = SNAPSHOT_BLOCK_SIZE / sizeof(int);
+    size_t stride = loaded.pool->node_size;
+    int remaining = (int)header.count;
+    uint32_t crc = 0;
+    LLNode *tail = NULL;
+
+    while (remaining > 0) {
+        int n = remaining < per_block ? remaining : per_block;
+        if (readBytes(file, block, sizeof(int) * (size_t)n, &crc) != 0) break;
+
+        for (int done = 0; done < n;) {
+            int run;
+            char *nodes = takeNodes(loaded.pool, n - done, &run);
+
+            for (int i = 0; i < run; i++) {
+                LLNode *node = (LLNode *)(nodes + stride * (size_t)i);
+                node->data = block[done + i];
+                node->next = NULL;
+                if (tail != NULL) {
+                    tail->next = node;
+                } else {
+                    loaded.head = node;
+                }
+                tail = node;
+            }
+            done += run;
+        }
+        remaining -= n;
+    }
+    free(block);
+
+    loaded.tail = tail;
+    loaded.size = (int)header.count - remaining;
+    if (remaining > 0 || readTrailer(file, crc) != 0) {
+        llFree(&loaded);
+        return -1;
+    }
+
+    *list = loaded;
+    return 0;
+}
+
+/**
+ * Saves a doubly linked list as a snapshot of its values from head to tail.
+ *
+ * @param list pointer to the DoublyLinkedList to save
+ * @param file the stream to write to
+ * @return 0 on success; -1 on a write error
+ */
+int dllSave(DoublyLinkedList *list, FILE *file) {
+    if (writeHeader(file, SNAPSHOT_DOUBLY_LINKED_LIST, sizeof(int), list->size) != 0) return -1;
+
+    int *block = allocBlock();
+    int per_block = SNAPSHOT_BLOCK_SIZE / sizeof(int);
+    uint32_t crc = 0;
+    int status = 0;
+
+    for (DLLNode *curr = list->head; curr != NULL && status == 0;) {
+        int n = 0;
+        for (; n < per_block && curr != NULL; n++, curr = curr->next) {
+            block[n] = curr->data;
+        }
+        status = writeBytes(file, block, sizeof(int) * (size_t)n, &crc);
+    }
+    if (status == 0) status = writeBytes(file, &crc, sizeof(crc), NULL);
+
+    free(block);
+    return status;
+}
+
+/**
+ * Loads a snapshot of ints (of any int container) into a new pooled
+ * doubly linked list (see dllInitPooled), building its nodes a run at a time.
+ *
+ * @param list pointer to the DoublyLinkedList to initialize
+ * @param file the stream to read from
+ * @return 0 on success; -1 on an error (list is left untouched)
+ */
+int dllLoad(DoublyLinkedList *list, FILE *file) {
+    SnapshotHeader header;
+    if (readIntHeader(file, &header) != 0) return -1;
+
+    DoublyLinkedList loaded;
+    dllInitPooled(&loaded, listSlabNodes((long long)header.count));
+
+    int *block = allocBlock();
+    int per_block = SNAPSHOT_BLOCK_SIZE / sizeof(int);
+    size_t stride = loaded.pool->node_size;
+    int remaining = (int)header.count;
+    uint32_t crc = 0;
+    DLLNode *tail = NULL;
+
+    while (remaining > 0) {
+        int n = remaining < per_block ? remaining : per_block;
+        if (readBytes(file, block, sizeof(int) * (size_t)n, &crc) != 0) break;
+
+        for (int done = 0; done < n;) {
+            int run;
+            char *nodes = takeNodes(loaded.pool, n - done, &run);
+
+            for (int i = 0; i < run; i++) {
+                DLLNode *node = (DLLNode *)(nodes + stride * (size_t)i);
+                node->data = block[done + i];
+                node->next = NULL;
+                node->prev = tail;
+                if (tail != NULL) {
+                    tail->next = node;
+                } else {
+                    loaded.head = node;
+                }
+                tail = node;
+            }
+            done += run;
+        }
+        remaining -= n;
+    }
+    free(block);
+
+    loaded.tail = tail;
+    loaded.size = (int)header.count - remaining;
+    if (remaining > 0 || readTrailer(file, crc) != 0) {
+        dllFree(&loaded);
+        return -1;
+    }
+
+    *list = loaded;
+    return 0;
+}
+
+// Checksum
+
+/**
+ * Computes the CRC-32C (Castagnoli) of a buffer, or continues one:
+ * snapshotCrc32c(snapshotCrc32c(0, a, n), b, m) equals the CRC of a
+ * followed by b. This is the checksum stored in snapshots.
+ *
+ * @param crc   CRC of the preceding data (0 to start)
+ * @param data  the bytes
+ * @param bytes the number of bytes
+ * @return the CRC-32C of the preceding data followed by this buffer
+ */
+uint32_t snapshotCrc32c(uint32_t crc, const void *data, size_t bytes) {
+    pthread_once(&crc_once, initCrc);
+
+#ifdef HAVE_CRC32_KERNEL
+    if (crc_hardware) return ~crcHardware(~crc, data, bytes);
+#endif
+    return ~crcTable(~crc, data, bytes);
+}
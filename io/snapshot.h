@@ -0,0 +1,73 @@
+/**
+ * @file snapshot.h
+ * @brief Public interface of the binary snapshot format for arrays and lists.
+ *
+ * A snapshot is a SNAPSHOT_HEADER_SIZE-byte header (magic, format version,
+ * kind of structure, element size, element count, byte order and a
+ * checksum of the header), the elements in order, and a 4-byte CRC-32C of
+ * the elements. Elements are stored in native byte order exactly as they
+ * sit in memory; list nodes are stored as their values from head to tail.
+ *
+ * Save and load stream the elements in SNAPSHOT_BLOCK_SIZE blocks through
+ * the FILE they are given and leave it just past the snapshot, so several
+ * snapshots can share one file. A load fully initializes the structure
+ * (like daInit / llInit) and leaves it untouched on error. Int snapshots
+ * are interchangeable: a list can be loaded into a DynamicArray and the
+ * other way round. Loaded lists use a node pool and build their nodes a
+ * slab at a time.
+ *
+ * All functions return 0 on success and -1 on an I/O error or an invalid
+ * or corrupt snapshot.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "arrays/dynamic_array.h"
+#include "arrays/generic_array.h"
+#include "linked_lists/linked_list.h"
+#include "linked_lists/doubly_linked_list.h"
+
+// Current version of the snapshot format.
+#define SNAPSHOT_VERSION 1
+
+// Size (in bytes) of the snapshot header.
+#define SNAPSHOT_HEADER_SIZE 40
+
+// Bytes moved per read or write call while streaming elements.
+#define SNAPSHOT_BLOCK_SIZE (1 << 20)
+
+// Largest slab (in nodes) of the node pool a loaded list gets.
+#define SNAPSHOT_LIST_SLAB_NODES (1 << 16)
+
+// Structure a snapshot was saved from.
+typedef enum {
+    SNAPSHOT_DYNAMIC_ARRAY = 1,
+    SNAPSHOT_GENERIC_ARRAY = 2,
+    SNAPSHOT_LINKED_LIST = 3,
+    SNAPSHOT_DOUBLY_LINKED_LIST = 4
+} SnapshotKind;
+
+// Arrays
+int daSave(DynamicArray *arr, FILE *file);
+int daLoad(DynamicArray *arr, FILE *file);
+int gaSave(GenericArray *arr, FILE *file);
+int gaLoad(GenericArray *arr, FILE *file);
+
+// Lists
+int llSave(LinkedList *list, FILE *file);
+int llLoad(LinkedList *list, FILE *file);
+int dllSave(DoublyLinkedList *list, FILE *file);
+int dllLoad(DoublyLinkedList *list, FILE *file);
+
+// Checksum
+uint32_t snapshotCrc32c(uint32_t crc, const void *data, size_t bytes);
+
+#endif // SNAPSHOT_H
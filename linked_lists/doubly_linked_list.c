@@ -13,19 +13,11 @@
 #include <stdlib.h>
 #include <stdbool.h>
 
-// Structure to represent a node.
-typedef struct Node {
-    int data;          // the value stored in this node
-    struct Node *next; // pointer to the next node in the list (NULL if last node)
-    struct Node *prev; // pointer to the previous node in the list (NULL if head node or list is of size 1)
-} Node;
-
-// Structure to represent a doubly linked list
-typedef struct DoublyLinkedList {
-    Node *head; // pointer to the head node of the doubly linked list
-    Node *tail; // pointer to the tail node of the doubly linked list
-    int size;   // number of elements currently 
-} DoublyLinkedList;
+#include "doubly_linked_list.h"
+#include "io/format.h"
+
+// Number of nodes compared per loop exit check when searching.
+#define SEARCH_RUN 8
 
 // Core lifecycle
 
@@ -35,26 +27,54 @@ typedef struct DoublyLinkedList {
  * 
  * @param list pointer to the DoublyLinkedList to initialize
  */
-void initList(DoublyLinkedList *list) {
+void dllInit(DoublyLinkedList *list) {
     list->head = NULL;
     list->tail = NULL;
     list->size = 0;
+    list->pool = NULL;
+}
+
+/**
+ * Initializes a doubly linked list whose nodes come from its own node pool.
+ * Nodes are allocated in slabs of nodes_per_slab and deleted nodes are
+ * recycled, so insert/delete churn avoids malloc and free.
+ * 
+ * @param list           pointer to the DoublyLinkedList to initialize
+ * @param nodes_per_slab number of nodes the pool allocates at a time
+ */
+void dllInitPooled(DoublyLinkedList *list, int nodes_per_slab) {
+    dllInit(list);
+
+    list->pool = malloc(sizeof(NodePool));
+    if (list->pool == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    npInit(list->pool, sizeof(DLLNode), nodes_per_slab);
 }
 
 /**
  * Frees the memory used by a doubly linked list.
- * Traverses the linked list and frees every node.
+ * Traverses the linked list and frees every node, or releases all
+ * slabs of its node pool at once if it has one (the list then goes back
+ * to allocating nodes with malloc).
  * Sets the head & tail to NULL and resets size to 0.
  * 
  * @param list pointer to the DoublyLinkedList to free
  */
-void freeList(DoublyLinkedList *list) {
-    Node *curr = list->head;
+void dllFree(DoublyLinkedList *list) {
+    if (list->pool != NULL) {
+        npFree(list->pool);
+        free(list->pool);
+        list->pool = NULL;
+    } else {
+        DLLNode *curr = list->head;
 
-    while (curr != NULL) {
-        Node *temp = curr;
-        curr = curr->next;
-        free(temp);
+        while (curr != NULL) {
+            DLLNode *temp = curr;
+            curr = curr->next;
+            free(temp);
+        }
     }
 
     list->head = NULL;
@@ -65,13 +85,15 @@ void freeList(DoublyLinkedList *list) {
 // Helpers
 
 /**
- * Helper function  to create and allocate memory for a node.
+ * Helper function to create and allocate memory for a node.
+ * The node comes from the list's node pool if it has one.
  * 
+ * @param list  pointer to the DoublyLinkedList the node is created for
  * @param value the value to create the node with
  * @return a pointer to  the newly created node, or NULL if memory allocation fails
  */
-Node* createNode(int value) {
-    Node *new_node = malloc(sizeof(Node));
+static DLLNode *createNode(DoublyLinkedList *list, int value) {
+    DLLNode *new_node = list->pool != NULL ? npAlloc(list->pool) : malloc(sizeof(DLLNode));
     if (new_node == NULL) {
         fprintf(stderr, "Memory allocation failed\n");
         return NULL;
@@ -83,6 +105,41 @@ Node* createNode(int value) {
     return new_node;
 }
 
+/**
+ * Helper function to free a node, returning it to the list's node pool if it has one.
+ * 
+ * @param list pointer to the DoublyLinkedList the node belongs to
+ * @param node pointer to the node to free
+ */
+static void destroyNode(DoublyLinkedList *list, DLLNode *node) {
+    if (list->pool != NULL) {
+        npRelease(list->pool, node);
+    } else {
+        free(node);
+    }
+}
+
+/**
+ * Helper function to search the nodes from a given node to the end of the list.
+ * Nodes are compared in runs of SEARCH_RUN with a branch-free OR, so the loop
+ * takes one data-dependent branch per run instead of one per node.
+ * 
+ * @param node  pointer to the first node to check
+ * @param value the value to search for
+ * @return true if the value was found; false otherwise
+ */
+static bool searchFrom(DLLNode *node, int value) {
+    while (node != NULL) {
+        bool found = false;
+        for (int i = 0; i < SEARCH_RUN && node != NULL; i++) {
+            found |= (node->data == value);
+            node = node->next;
+        }
+        if (found) return true;
+    }
+    return false;
+}
+
 // Insertion
 
 /**
@@ -91,8 +148,8 @@ Node* createNode(int value) {
  * @param list  pointer to the DoublyLinkedList
  * @param value the value to insert at the head
  */
-void insertAtHead(DoublyLinkedList *list, int value) {
-    Node *new_node = createNode(value);
+void dllInsertAtHead(DoublyLinkedList *list, int value) {
+    DLLNode *new_node = createNode(list, value);
     if (new_node == NULL) return;
 
     if (list->head == NULL) {
@@ -113,8 +170,8 @@ void insertAtHead(DoublyLinkedList *list, int value) {
  * @param list  pointer to the DoublyLinkedList
  * @param value the value to insert at the tail
  */
-void insertAtTail(DoublyLinkedList *list, int value) {
-    Node *new_node = createNode(value);
+void dllInsertAtTail(DoublyLinkedList *list, int value) {
+    DLLNode *new_node = createNode(list, value);
     if (new_node == NULL) return;
 
     if (list->head == NULL) {
@@ -137,27 +194,27 @@ void insertAtTail(DoublyLinkedList *list, int value) {
  * @param value the value to insert
  * @param index the index to insert the value at 
  */
-void insertAtPosition(DoublyLinkedList *list, int value, int index) {
+void dllInsertAtPosition(DoublyLinkedList *list, int value, int index) {
     if (index < 0 || index > list->size) {
         fprintf(stderr, "Error: invalid index\n");
         return;
     }
 
     if (index == 0) {
-        insertAtHead(list, value);
+        dllInsertAtHead(list, value);
         return;
     }
 
     if (index == list->size) {
-        insertAtTail(list, value);
+        dllInsertAtTail(list, value);
         return;
     }
 
-    Node *new_node = createNode(value);
+    DLLNode *new_node = createNode(list, value);
     if (new_node == NULL) return;
 
     if (index < list->size / 2) {
-        Node *curr = list->head;
+        DLLNode *curr = list->head;
         int count = 0;
 
         while (count < index - 1) {
@@ -170,7 +227,7 @@ void insertAtPosition(DoublyLinkedList *list, int value, int index) {
         curr->next = new_node;
         list->size++;
     } else {
-        Node *curr = list->tail;
+        DLLNode *curr = list->tail;
         int count = list->size - 1;
 
         while (count > index - 1) {
@@ -192,10 +249,10 @@ void insertAtPosition(DoublyLinkedList *list, int value, int index) {
  * 
  * @param list pointer to the DoublyLinkedList
  */
-void deleteHead(DoublyLinkedList *list) {
+void dllDeleteHead(DoublyLinkedList *list) {
     if (list->head == NULL) return;
 
-    Node *temp = list->head;
+    DLLNode *temp = list->head;
     list->head = temp->next;
 
     if (list->head == NULL) {
@@ -204,7 +261,7 @@ void deleteHead(DoublyLinkedList *list) {
         list->head->prev = NULL;
     }
 
-    free(temp);
+    destroyNode(list, temp);
     list->size--;
 }
 
@@ -213,10 +270,10 @@ void deleteHead(DoublyLinkedList *list) {
  * 
  * @param list pointer to the DoublyLinkedList 
  */
-void deleteTail(DoublyLinkedList *list) {
+void dllDeleteTail(DoublyLinkedList *list) {
     if (list->tail == NULL) return;
 
-    Node *temp = list->tail;
+    DLLNode *temp = list->tail;
     list->tail = temp->prev;
 
     if (list->tail == NULL) {
@@ -225,7 +282,7 @@ void deleteTail(DoublyLinkedList *list) {
         list->tail->next = NULL;
     }
 
-    free(temp);
+    destroyNode(list, temp);
     list->size--;
 }
 
@@ -236,21 +293,21 @@ void deleteTail(DoublyLinkedList *list) {
  * @param list  pointer to the DoublyLinkedList
  * @param value the value to delete
  */
-void deleteByValue(DoublyLinkedList *list, int value) {
-    Node *curr = list->head;
+void dllDeleteByValue(DoublyLinkedList *list, int value) {
+    DLLNode *curr = list->head;
 
     while (curr != NULL) {
         if (curr->data == value) {
             if (curr->prev == NULL) {
-                deleteHead(list);
+                dllDeleteHead(list);
                 return;
             } else if (curr->next == NULL) {
-                deleteTail(list);
+                dllDeleteTail(list);
                 return;
             } else {
                 curr->next->prev = curr->prev;
                 curr->prev->next = curr->next;
-                free(curr);
+                destroyNode(list, curr);
                 list->size--;
                 return;
             }
@@ -266,24 +323,24 @@ void deleteByValue(DoublyLinkedList *list, int value) {
  * @param list  pointer to the DoublyLinkedList
  * @param index the index to delete a node at
  */
-void deleteByPosition(DoublyLinkedList *list, int index) {
+void dllDeleteByPosition(DoublyLinkedList *list, int index) {
     if (index < 0 || index >= list->size) {
         fprintf(stderr, "Error: invalid index\n");
         return;
     }
 
     if (index == 0) {
-        deleteHead(list);
+        dllDeleteHead(list);
         return;
     }
 
     if (index == list->size - 1) {
-        deleteTail(list);
+        dllDeleteTail(list);
         return;
     }
 
     if (index < list->size / 2) {
-        Node *curr = list->head;
+        DLLNode *curr = list->head;
         int count = 0;
 
         while (count < index) {
@@ -292,11 +349,11 @@ void deleteByPosition(DoublyLinkedList *list, int index) {
         }
         curr->prev->next = curr->next;
         curr->next->prev = curr->prev;
-        free(curr);
+        destroyNode(list, curr);
         list->size--;
         return;
     } else {
-        Node *curr = list->tail;
+        DLLNode *curr = list->tail;
         int count = list->size - 1;
 
         while (count > index) {
@@ -306,7 +363,7 @@ void deleteByPosition(DoublyLinkedList *list, int index) {
 
         curr->prev->next = curr->next;
         curr->next->prev = curr->prev;
-        free(curr);
+        destroyNode(list, curr);
         list->size--;
         return;
     }
@@ -316,35 +373,46 @@ void deleteByPosition(DoublyLinkedList *list, int index) {
 
 /**
  * Iteratively searches for a value in a doubly linked list.
+ * Walks in from the head and the tail at the same time: the two pointer
+ * chains are independent, so their cache misses overlap and a search
+ * needs about half as many dependent loads. Each run of SEARCH_RUN steps
+ * ends with a single branch.
  * 
  * @param list  pointer to the DoublyLinkedList
  * @param value the value to search for
  * @return true if the value was found; false otherwise
  */
-bool searchIterative(DoublyLinkedList *list, int value) {
-    Node *curr = list->head;
-
-    while (curr != NULL) {
-        if (curr->data == value) {
-            return true;
+bool dllSearchIterative(DoublyLinkedList *list, int value) {
+    DLLNode *front = list->head;
+    DLLNode *back = list->tail;
+    int remaining = list->size;
+
+    while (remaining >= 2) {
+        bool found = false;
+        for (int i = 0; i < SEARCH_RUN && remaining >= 2; i++) {
+            found |= (front->data == value) | (back->data == value);
+            front = front->next;
+            back = back->prev;
+            remaining -= 2;
         }
-        curr = curr->next;
+        if (found) return true;
     }
 
-    return false;
+    // An odd-sized list leaves the middle node for last.
+    return remaining == 1 && front->data == value;
 }
 
 /**
- * Recursively searches for a value in a doubly linked list.
+ * Searches for a value in a doubly linked list, starting from any node.
+ * This used to recurse once per node and could overflow the stack on long
+ * lists; it now walks the nodes in a loop and keeps its name for callers.
  * 
- * @param node  pointer to the head node
+ * @param node  pointer to the head node (or any node to start from)
  * @param value the value to search for
  * @return true if the value was found; false otherwise
  */
-bool searchRecursive(Node *node, int value) {
-    if (node == NULL) return false;
-    if(node->data == value) return true;
-    return searchRecursive(node->next, value);
+bool dllSearchRecursive(DLLNode *node, int value) {
+    return searchFrom(node, value);
 }
 
 /**
@@ -352,15 +420,11 @@ bool searchRecursive(Node *node, int value) {
  * 
  * @param list pointer to the DoublyLinkedList
  */
-void printList(DoublyLinkedList *list) {
-    Node *curr = list->head;
-
-    while (curr != NULL) {
-        printf("%d <-> ", curr->data);
-        curr = curr->next;
-    }
-
-    printf("NULL\n");
+void dllPrint(DoublyLinkedList *list) {
+    OutputBuffer out;
+    obInit(&out, stdout, 0);
+    dllFormat(list, &out, OUTPUT_TEXT);
+    obFree(&out);
 }
 
 /**
@@ -368,15 +432,11 @@ void printList(DoublyLinkedList *list) {
  * 
  * @param list pointer to the DoublyLinkedList
  */
-void printReverse(DoublyLinkedList *list) {
-    Node *curr = list ->tail;
-
-    while (curr != NULL) {
-        printf("%d <-> ", curr->data);
-        curr = curr->prev;
-    }
-
-    printf("NULL\n");
+void dllPrintReverse(DoublyLinkedList *list) {
+    OutputBuffer out;
+    obInit(&out, stdout, 0);
+    dllFormatReverse(list, &out, OUTPUT_TEXT);
+    obFree(&out);
 }
 
 /**
@@ -385,7 +445,7 @@ void printReverse(DoublyLinkedList *list) {
  * @param list pointer to the DoublyLinkedList
  * @return the size of a linked list
  */
-int getLength(DoublyLinkedList *list) {
+int dllGetLength(DoublyLinkedList *list) {
     return list->size;
 }
 
@@ -395,64 +455,6 @@ int getLength(DoublyLinkedList *list) {
  * @param list pointer to the DoublyLinkedList
  * @return true if the linked list is empty; false otherwise 
  */
-bool isEmpty(DoublyLinkedList *list) {
+bool dllIsEmpty(DoublyLinkedList *list) {
     return (list->size == 0);
 }
-
-int main() {
-    DoublyLinkedList list;
-    initList(&list);
-
-    printf("Initializing and printing an empty DoublyLinkedList:\n");
-    printList(&list);
-    printf("isEmpty: %s\n", isEmpty(&list) ? "True" : "False");
-
-    printf("Adding elements 0-9 to the list:\n");
-    for (int i = 0; i < 10; i++) {
-        insertAtTail(&list, i);
-    }
-    printList(&list);
-    printf("Size of the list: %d\n", getLength(&list));
-
-    printf("Inserting 99 at the head:\n");
-    insertAtHead(&list, 99);
-    printList(&list);
-
-    printf("Inserting 88 at the tail:\n");
-    insertAtTail(&list, 88);
-    printList(&list);
-
-    printf("Inserting 77 at index 5:\n");
-    insertAtPosition(&list, 77, 5);
-    printList(&list);
-
-    printf("Deleting value 77:\n");
-    deleteByValue(&list, 77);
-    printList(&list);
-
-    printf("Deleting head:\n");
-    deleteHead(&list);
-    printList(&list);
-
-    printf("Deleting tail:\n");
-    deleteTail(&list);
-    printList(&list);
-
-    printf("Deleting node at index 4:\n");
-    deleteByPosition(&list, 4);
-    printList(&list);
-
-    printf("Searching for value 6 (iterative): %s\n", searchIterative(&list, 6) ? "True" : "False");
-    printf("Searching for value 6 (recursive): %s\n", searchRecursive(list.head, 6) ? "True" : "False");
-
-    printf("Printing the list in reverse:\n");
-    printReverse(&list);
-
-    printf("Freeing the list:\n");
-    freeList(&list);
-    printList(&list);
-    printf("isEmpty: %s\n", isEmpty(&list) ? "True" : "False");
-
-    return 0;
-}
-
@@ -0,0 +1,58 @@
+/**
+ * @file doubly_linked_list.h
+ * @brief Public interface of the doubly linked list for integers.
+ *
+ * All functions are prefixed with `dll` so the list can be linked
+ * into the same binary as the other containers in this library.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#ifndef DOUBLY_LINKED_LIST_H
+#define DOUBLY_LINKED_LIST_H
+
+#include <stdbool.h>
+
+#include "node_pool.h"
+
+// Structure to represent a node.
+typedef struct DLLNode {
+    int data;             // the value stored in this node
+    struct DLLNode *next; // pointer to the next node in the list (NULL if last node)
+    struct DLLNode *prev; // pointer to the previous node in the list (NULL if head node or list is of size 1)
+} DLLNode;
+
+// Structure to represent a doubly linked list
+typedef struct DoublyLinkedList {
+    DLLNode *head;  // pointer to the head node of the doubly linked list
+    DLLNode *tail;  // pointer to the tail node of the doubly linked list
+    int size;       // number of elements currently stored
+    NodePool *pool; // pool the nodes are allocated from (NULL to use malloc)
+} DoublyLinkedList;
+
+// Core lifecycle
+void dllInit(DoublyLinkedList *list);
+void dllInitPooled(DoublyLinkedList *list, int nodes_per_slab);
+void dllFree(DoublyLinkedList *list);
+
+// Insertion
+void dllInsertAtHead(DoublyLinkedList *list, int value);
+void dllInsertAtTail(DoublyLinkedList *list, int value);
+void dllInsertAtPosition(DoublyLinkedList *list, int value, int index);
+
+// Deletion
+void dllDeleteHead(DoublyLinkedList *list);
+void dllDeleteTail(DoublyLinkedList *list);
+void dllDeleteByValue(DoublyLinkedList *list, int value);
+void dllDeleteByPosition(DoublyLinkedList *list, int index);
+
+// Utility
+bool dllSearchIterative(DoublyLinkedList *list, int value);
+bool dllSearchRecursive(DLLNode *node, int value);
+void dllPrint(DoublyLinkedList *list);
+void dllPrintReverse(DoublyLinkedList *list);
+int dllGetLength(DoublyLinkedList *list);
+bool dllIsEmpty(DoublyLinkedList *list);
+
+#endif // DOUBLY_LINKED_LIST_H
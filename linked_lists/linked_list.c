@@ -13,48 +13,72 @@
 #include <stdlib.h>
 #include <stdbool.h>
 
-// Structure to represent a node.
-typedef struct Node {
-    int data;          // the value stored in this node
-    struct Node *next; // pointer to the next node in the list (NULL if last node)
-} Node;
-
-// Structure to represent a linked list 
-typedef struct LinkedList {
-    Node *head; // pointer to the head node of the linked list 
-    int size;   // number of elements currently stored
-} LinkedList;
+#include "linked_list.h"
+#include "io/format.h"
+
+// Number of nodes compared per loop exit check when searching.
+#define SEARCH_RUN 8
 
 // Core lifecycle
 
 /**
  * Initializes a linked list.
- * Sets the head node to NULL and the size to 0.
+ * Sets the head & tail node to NULL and the size to 0.
  * 
  * @param list pointer to the LinkedList to initialize
  */
-void initList(LinkedList *list) {
+void llInit(LinkedList *list) {
     list->head = NULL;
+    list->tail = NULL;
     list->size = 0;
+    list->pool = NULL;
+}
+
+/**
+ * Initializes a linked list whose nodes come from its own node pool.
+ * Nodes are allocated in slabs of nodes_per_slab and deleted nodes are
+ * recycled, so insert/delete churn avoids malloc and free.
+ * 
+ * @param list           pointer to the LinkedList to initialize
+ * @param nodes_per_slab number of nodes the pool allocates at a time
+ */
+void llInitPooled(LinkedList *list, int nodes_per_slab) {
+    llInit(list);
+
+    list->pool = malloc(sizeof(NodePool));
+    if (list->pool == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    npInit(list->pool, sizeof(LLNode), nodes_per_slab);
 }
 
 /**
  * Frees the memory used by a linked list.
- * Traverses the linked list and frees every node.
- * Sets the head to NULL and resets size to 0.
+ * Traverses the linked list and frees every node, or releases all
+ * slabs of its node pool at once if it has one (the list then goes back
+ * to allocating nodes with malloc).
+ * Sets the head & tail to NULL and resets size to 0.
  * 
  * @param list pointer to the LinkedList to free
  */
-void freeList(LinkedList *list) {
-    Node *curr = list->head;
-
-    while (curr != NULL) {
-        Node *temp = curr;
-        curr = curr->next;
-        free (temp);
+void llFree(LinkedList *list) {
+    if (list->pool != NULL) {
+        npFree(list->pool);
+        free(list->pool);
+        list->pool = NULL;
+    } else {
+        LLNode *curr = list->head;
+
+        while (curr != NULL) {
+            LLNode *temp = curr;
+            curr = curr->next;
+            free(temp);
+        }
     }
 
     list->head = NULL;
+    list->tail = NULL;
     list->size = 0;
 }
 
@@ -62,12 +86,14 @@ void freeList(LinkedList *list) {
 
 /**
  * Helper function to create and allocate memory for a node.
+ * The node comes from the list's node pool if it has one.
  * 
+ * @param list  pointer to the LinkedList the node is created for
  * @param value the value to create the node with
  * @return a pointer to the newly created node, or NULL if memory allocation fails
  */
-Node *createNode(int value) {
-    Node *new_node = malloc(sizeof(Node));
+static LLNode *createNode(LinkedList *list, int value) {
+    LLNode *new_node = list->pool != NULL ? npAlloc(list->pool) : malloc(sizeof(LLNode));
     if (new_node == NULL) {
         fprintf(stderr, "Memory allocation failed\n");
         return NULL;
@@ -78,6 +104,41 @@ Node *createNode(int value) {
     return new_node;
 }
 
+/**
+ * Helper function to free a node, returning it to the list's node pool if it has one.
+ * 
+ * @param list pointer to the LinkedList the node belongs to
+ * @param node pointer to the node to free
+ */
+static void destroyNode(LinkedList *list, LLNode *node) {
+    if (list->pool != NULL) {
+        npRelease(list->pool, node);
+    } else {
+        free(node);
+    }
+}
+
+/**
+ * Helper function to search the nodes from a given node to the end of the list.
+ * Nodes are compared in runs of SEARCH_RUN with a branch-free OR, so the loop
+ * takes one data-dependent branch per run instead of one per node.
+ * 
+ * @param node  pointer to the first node to check
+ * @param value the value to search for
+ * @return true if the value was found; false otherwise
+ */
+static bool searchFrom(LLNode *node, int value) {
+    while (node != NULL) {
+        bool found = false;
+        for (int i = 0; i < SEARCH_RUN && node != NULL; i++) {
+            found |= (node->data == value);
+            node = node->next;
+        }
+        if (found) return true;
+    }
+    return false;
+}
+
 // Insertion
 
 /**
@@ -86,38 +147,38 @@ Node *createNode(int value) {
  * @param list  pointer to the LinkedList
  * @param value the value to insert at the head
  */
-void insertAtHead(LinkedList *list, int value) {
-    Node *new_node = createNode(value);
+void llInsertAtHead(LinkedList *list, int value) {
+    LLNode *new_node = createNode(list, value);
     if (new_node == NULL) return;
 
     new_node->next = list->head;
     list->head = new_node;
+    if (list->tail == NULL) {
+        list->tail = new_node;
+    }
     list->size++;
 }
 
 /**
- * Inserts a value at the tail of a linked list. 
+ * Inserts a value at the tail of a linked list in constant time
+ * using the tail pointer.
  * 
  * @param list  pointer to the LinkedList
  * @param value the value to insert at the tail 
  */
-void insertAtTail(LinkedList *list, int value) {
-    Node *curr = list->head;
-
-    Node *new_node = createNode(value);
+void llInsertAtTail(LinkedList *list, int value) {
+    LLNode *new_node = createNode(list, value);
     if (new_node == NULL) return;
 
     if (list->head == NULL) {
-    list->head = new_node;
-    list->size++;
-    return;
-}
-
-    while (curr->next != NULL) {
-        curr = curr->next;
+        list->head = new_node;
+        list->tail = new_node;
+        list->size++;
+        return;
     }
 
-    curr->next = new_node;
+    list->tail->next = new_node;
+    list->tail = new_node;
     list->size++;
 }
 
@@ -128,24 +189,25 @@ void insertAtTail(LinkedList *list, int value) {
  * @param value the value to insert
  * @param index the index to insert the value at 
  */
-void insertAtPosition(LinkedList *list, int value, int index) {
+void llInsertAtPosition(LinkedList *list, int value, int index) {
     if (index < 0 || index > list->size) {
         fprintf(stderr, "Error: Invalid index");
         exit(EXIT_FAILURE);
     }
 
     if (index == 0) {
-        insertAtHead(list, value);
+        llInsertAtHead(list, value);
         return;
     }
 
     if (index == list->size) {
-        insertAtTail(list, value);
+        llInsertAtTail(list, value);
         return;
     }
 
-    Node *curr = list->head;
-    Node *new_node = createNode(value);
+    LLNode *curr = list->head;
+    LLNode *new_node = createNode(list, value);
+    if (new_node == NULL) return;
     int count = 0;
 
     while (count < index -1) {
@@ -158,7 +220,6 @@ void insertAtPosition(LinkedList *list, int value, int index) {
     list->size++;
 }
 
-
 //Deletion
 
 /**
@@ -168,21 +229,25 @@ void insertAtPosition(LinkedList *list, int value, int index) {
  * @param list  pointer to the LinkedList
  * @param value the value to delete
  */
-void deleteByValue(LinkedList *list, int value) {
-    Node *curr = list->head;
-    Node *prev = NULL;
+void llDeleteByValue(LinkedList *list, int value) {
+    LLNode *curr = list->head;
+    LLNode *prev = NULL;
 
     while (curr != NULL) {
         if (curr->data == value) {
+            if (curr == list->tail) {
+                list->tail = prev;
+            }
+
             if (prev == NULL) {
                 list->head = curr->next;
                 list->size--;
-                free(curr);
+                destroyNode(list, curr);
                 return;
             } else {
                 prev->next = curr->next;
                 list->size--;
-                free(curr);
+                destroyNode(list, curr);
                 return;
             }
         }
@@ -197,22 +262,25 @@ void deleteByValue(LinkedList *list, int value) {
  * @param list  pointer to the LinkedList
  * @param index the index to delete a node at 
  */
-void deleteByPosition(LinkedList *list, int index) {
+void llDeleteByPosition(LinkedList *list, int index) {
     if (index < 0 || index >= list->size) {
         fprintf(stderr, "Error: invalid index");
         exit(EXIT_FAILURE);
     }
 
-    Node *curr = list->head;
+    LLNode *curr = list->head;
 
     if (index == 0) {
         list->head = curr->next;
+        if (list->head == NULL) {
+            list->tail = NULL;
+        }
         list->size--;
-        free(curr);
+        destroyNode(list, curr);
         return;
     }
 
-    Node *temp = NULL;
+    LLNode *temp = NULL;
     int count = 0;
 
     while (count < index -1) {
@@ -222,8 +290,11 @@ void deleteByPosition(LinkedList *list, int index) {
 
     temp = curr->next;
     curr->next = temp->next;
+    if (temp == list->tail) {
+        list->tail = curr;
+    }
     list->size--;
-    free(temp);
+    destroyNode(list, temp);
 }
 
 // Utility
@@ -235,32 +306,21 @@ void deleteByPosition(LinkedList *list, int index) {
  * @param value the value to search for
  * @return true if the value was found; false otherwise
  */
-bool searchIterative(LinkedList *list, int value) {
-    Node *curr = list->head;
-
-    while (curr != NULL) {
-        if (curr->data == value) {
-            return true;
-        }
-        curr = curr->next;
-    }
-    
-    return false;
+bool llSearchIterative(LinkedList *list, int value) {
+    return searchFrom(list->head, value);
 }
 
 /**
- * Recursively searches for a value in a linked list. 
+ * Searches for a value in a linked list, starting from any node.
+ * This used to recurse once per node and could overflow the stack on long
+ * lists; it now walks the nodes in a loop and keeps its name for callers.
  * 
- * @param node  pointer to the head node
+ * @param node  pointer to the head node (or any node to start from)
  * @param value the value to search for 
  * @return true if the value was found; false otherwise
  */
-bool searchRecursive(Node *node, int value) {
-    if (node == NULL) {
-        return false;
-    } else if (node->data == value) {
-        return true;
-    } else return searchRecursive(node->next, value);
+bool llSearchRecursive(LLNode *node, int value) {
+    return searchFrom(node, value);
 }
 
 /**
@@ -268,26 +328,28 @@ bool searchRecursive(Node *node, int value) {
  * 
  * @param list pointer to the LinkedList
  */
-void printList(LinkedList *list) {
-    Node *curr = list->head;
-
-    while (curr != NULL) {
-        printf("%d -> ", curr->data);
-        curr = curr->next;
-    }
-
-    printf("NULL\n");
+void llPrint(LinkedList *list) {
+    OutputBuffer out;
+    obInit(&out, stdout, 0);
+    llFormat(list, &out, OUTPUT_TEXT);
+    obFree(&out);
 }
 
 /**
  * Prints out a string representation of a linked list in reverse order.
+ * Iterative, so long lists cannot overflow the stack; see llFormatReverse.
  * 
  * @param node pointer to the head node
  */
-void printReverse(Node *node) {
-    if (node == NULL) return;
-    printReverse(node->next);
-    printf("%d -> ", node->data);
+void llPrintReverse(LLNode *node) {
+    LinkedList view;
+    llInit(&view);
+    view.head = node;
+
+    OutputBuffer out;
+    obInit(&out, stdout, 0);
+    llFormatReverse(&view, &out, OUTPUT_TEXT);
+    obFree(&out);
 }
 
 /**
@@ -296,7 +358,7 @@ void printReverse(Node *node) {
  * @param list pointer to the LinkedList
  * @return the size of a linked list
  */
-int getLength(LinkedList *list) {
+int llGetLength(LinkedList *list) {
     return list->size;
 }
 
@@ -306,41 +368,6 @@ int getLength(LinkedList *list) {
  * @param list pointer to the LinkedList
  * @return true if the linked list is empty; false otherwise
  */
-bool isEmpty(LinkedList *list) {
+bool llIsEmpty(LinkedList *list) {
     return (list->size == 0);
 }
-
-int main() {
-    LinkedList list;
-    initList(&list);
-
-    printf("Initializing and printing en empty LinkedList:\n");
-    printList(&list);
-    printf("isEmpty: %s\n", isEmpty(&list) ? "True" : "False");
-
-    printf("Adding elements to the list:\n");
-    for (int i = 0; i < 10; i++) {
-        insertAtTail(&list, i);
-    }
-    printList(&list);
-
-    printf("Size of the list: %d\n", getLength(&list));
-
-    printf("Removing value 9 & node at index 4:\n");
-    deleteByValue(&list, 9);
-    deleteByPosition(&list, 4);
-    printList(&list);
-
-    printf("Inserting value at head and also at index 4:\n");
-    insertAtHead(&list, 9);
-    insertAtPosition(&list, 4, 4);
-    printList(&list);
-
-    printf("Searching for value 6 iteratively:\n Found? (T/F): %s\n", searchIterative(&list, 6) ? "True" : "False");
-    printf("Searching for value 6 recursively:\n Found? (T/F): %s\n", searchRecursive(list.head, 6) ? "True" : "False");
-
-    printf("Printing the list in reverse:\n");
-    printReverse(list.head);
-    
-    return 0;
-}
@@ -0,0 +1,55 @@
+/**
+ * @file linked_list.h
+ * @brief Public interface of the singly linked list for integers.
+ *
+ * All functions are prefixed with `ll` so the list can be linked
+ * into the same binary as the other containers in this library.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#ifndef LINKED_LIST_H
+#define LINKED_LIST_H
+
+#include <stdbool.h>
+
+#include "node_pool.h"
+
+// Structure to represent a node.
+typedef struct LLNode {
+    int data;            // the value stored in this node
+    struct LLNode *next; // pointer to the next node in the list (NULL if last node)
+} LLNode;
+
+// Structure to represent a linked list
+typedef struct LinkedList {
+    LLNode *head;   // pointer to the head node of the linked list
+    LLNode *tail;   // pointer to the tail node of the linked list
+    int size;       // number of elements currently stored
+    NodePool *pool; // pool the nodes are allocated from (NULL to use malloc)
+} LinkedList;
+
+// Core lifecycle
+void llInit(LinkedList *list);
+void llInitPooled(LinkedList *list, int nodes_per_slab);
+void llFree(LinkedList *list);
+
+// Insertion
+void llInsertAtHead(LinkedList *list, int value);
+void llInsertAtTail(LinkedList *list, int value);
+void llInsertAtPosition(LinkedList *list, int value, int index);
+
+// Deletion
+void llDeleteByValue(LinkedList *list, int value);
+void llDeleteByPosition(LinkedList *list, int index);
+
+// Utility
+bool llSearchIterative(LinkedList *list, int value);
+bool llSearchRecursive(LLNode *node, int value);
+void llPrint(LinkedList *list);
+void llPrintReverse(LLNode *node);
+int llGetLength(LinkedList *list);
+bool llIsEmpty(LinkedList *list);
+
+#endif // LINKED_LIST_H
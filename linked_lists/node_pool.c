@@ -0,0 +1,153 @@
+/**
+ * @file node_pool.c
+ * @brief Implementation of a slab allocator for fixed-size list nodes.
+ *
+ * Slabs are allocated with one malloc each and chained through a small
+ * header at their start. Nodes are handed out first from the free list
+ * of released nodes and then, in address order, from the newest slab.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdalign.h>
+#include <stddef.h>
+
+#include "node_pool.h"
+
+// Structure to represent the header at the start of every slab.
+typedef struct Slab {
+    struct Slab *next; // the slab allocated before this one (NULL if first)
+} Slab;
+
+// Size of the slab header, padded so the first node is suitably aligned.
+#define SLAB_HEADER_SIZE \
+    ((sizeof(Slab) + alignof(max_align_t) - 1) / alignof(max_align_t) * alignof(max_align_t))
+
+// Core lifecycle
+
+/**
+ * Initializes an empty node pool. No memory is allocated until the first node is requested.
+ * 
+ * @param pool           pointer to the NodePool to initialize
+ * @param node_size      size (in bytes) of each node
+ * @param nodes_per_slab number of nodes to allocate per slab
+ */
+void npInit(NodePool *pool, size_t node_size, int nodes_per_slab) {
+    if (nodes_per_slab <= 0 || node_size == 0) {
+        fprintf(stderr, "Error: Invalid node pool size\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // Every node must be able to hold the free-list link and stay pointer aligned.
+    if (node_size < sizeof(void *)) node_size = sizeof(void *);
+    node_size = (node_size + alignof(void *) - 1) / alignof(void *) * alignof(void *);
+
+    pool->node_size = node_size;
+    pool->nodes_per_slab = nodes_per_slab;
+    pool->slabs = NULL;
+    pool->free_list = NULL;
+    pool->next_unused = NULL;
+    pool->slab_end = NULL;
+}
+
+/**
+ * Frees every slab of a node pool at once.
+ * All nodes handed out by the pool become invalid.
+ * 
+ * @param pool pointer to the NodePool to free
+ */
+void npFree(NodePool *pool) {
+    Slab *curr = pool->slabs;
+
+    while (curr != NULL) {
+        Slab *temp = curr;
+        curr = curr->next;
+        free(temp);
+    }
+
+    pool->slabs = NULL;
+    pool->free_list = NULL;
+    pool->next_unused = NULL;
+    pool->slab_end = NULL;
+}
+
+// Helpers
+
+/**
+ * Helper function to allocate a new slab and make it the one nodes are carved from.
+ * 
+ * @param pool pointer to the NodePool
+ * @return true on success; false if memory allocation fails
+ */
+static bool addSlab(NodePool *pool) {
+    Slab *slab = malloc(SLAB_HEADER_SIZE + pool->node_size * (size_t)pool->nodes_per_slab);
+    if (slab == NULL) return false;
+
+    slab->next = pool->slabs;
+    pool->slabs = slab;
+    pool->next_unused = (char *)slab + SLAB_HEADER_SIZE;
+    pool->slab_end = pool->next_unused + pool->node_size * (size_t)pool->nodes_per_slab;
+    return true;
+}
+
+// Allocation
+
+/**
+ * Hands out one node from a node pool, allocating a new slab when the
+ * free list and the current slab are both exhausted.
+ * 
+ * @param pool pointer to the NodePool
+ * @return a pointer to uninitialized node memory, or NULL if memory allocation fails
+ */
+void *npAlloc(NodePool *pool) {
+    if (pool->free_list != NULL) {
+        void *node = pool->free_list;
+        pool->free_list = *(void **)node;
+        return node;
+    }
+
+    if (pool->next_unused == pool->slab_end && !addSlab(pool)) return NULL;
+
+    void *node = pool->next_unused;
+    pool->next_unused += pool->node_size;
+    return node;
+}
+
+/**
+ * Hands out a run of consecutive never-used nodes from a node pool, for
+ * building many nodes at once (e.g. when loading a list). The run ends at
+ * the end of the current slab; a new slab is allocated only when the
+ * current one is exhausted. Released nodes are not part of any run.
+ * 
+ * @param pool      pointer to the NodePool
+ * @param max_nodes largest number of nodes wanted (at least 1)
+ * @param count     output: number of nodes in the run (between 1 and max_nodes)
+ * @return a pointer to the first node of the run (the others follow every
+ *         node_size bytes), or NULL if memory allocation fails
+ */
+void *npAllocRun(NodePool *pool, int max_nodes, int *count) {
+    if (pool->next_unused == pool->slab_end && !addSlab(pool)) return NULL;
+
+    size_t available = (size_t)(pool->slab_end - pool->next_unused) / pool->node_size;
+    int run = available < (size_t)max_nodes ? (int)available : max_nodes;
+
+    void *first = pool->next_unused;
+    pool->next_unused += pool->node_size * (size_t)run;
+    *count = run;
+    return first;
+}
+
+/**
+ * Returns a node to a node pool so a later npAlloc can reuse it.
+ * 
+ * @param pool pointer to the NodePool the node was allocated from
+ * @param node pointer to the node to release
+ */
+void npRelease(NodePool *pool, void *node) {
+    *(void **)node = pool->free_list;
+    pool->free_list = node;
+}
@@ -0,0 +1,38 @@
+/**
+ * @file node_pool.h
+ * @brief Public interface of the slab allocator for fixed-size list nodes.
+ *
+ * A NodePool carves nodes out of large slabs and recycles released nodes
+ * through a free list, so inserting and deleting nodes does not go through
+ * malloc/free and consecutive nodes stay close together in memory.
+ * All slabs are released at once by npFree.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include <stddef.h>
+
+// Structure to represent a pool of fixed-size nodes.
+typedef struct NodePool {
+    size_t node_size;   // size (in bytes) of each node, rounded up for alignment
+    int nodes_per_slab; // number of nodes carved out of each slab
+    void *slabs;        // singly linked chain of every slab allocated so far
+    void *free_list;    // singly linked chain of released nodes ready for reuse
+    char *next_unused;  // first never-used node in the newest slab
+    char *slab_end;     // end of the newest slab
+} NodePool;
+
+// Core lifecycle
+void npInit(NodePool *pool, size_t node_size, int nodes_per_slab);
+void npFree(NodePool *pool);
+
+// Allocation
+void *npAlloc(NodePool *pool);
+void *npAllocRun(NodePool *pool, int max_nodes, int *count);
+void npRelease(NodePool *pool, void *node);
+
+#endif // NODE_POOL_H
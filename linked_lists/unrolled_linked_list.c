@@ -0,0 +1,446 @@
+/**
+ * @file unrolled_linked_list.c
+ * @brief Implementation of an unrolled doubly linked list for integers.
+ * 
+ * Offers the same operations as the doubly linked list, but packs up to
+ * ULL_NODE_CAPACITY values into every node. Inserting into a full node
+ * splits it in two; deleting from a node that falls below half full merges
+ * it with its successor or borrows values from it.
+ * 
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "unrolled_linked_list.h"
+#include "io/format.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// Core lifecycle
+
+/**
+ * Initializes an unrolled linked list.
+ * Sets the head & tail node to NULL and the size and node count to 0.
+ * 
+ * @param list pointer to the UnrolledLinkedList to initialize
+ */
+void ullInit(UnrolledLinkedList *list) {
+    list->head = NULL;
+    list->tail = NULL;
+    list->size = 0;
+    list->nodes = 0;
+}
+
+/**
+ * Frees the memory used by an unrolled linked list.
+ * Traverses the list and frees every node.
+ * Sets the head & tail to NULL and resets size and node count to 0.
+ * 
+ * @param list pointer to the UnrolledLinkedList to free
+ */
+void ullFree(UnrolledLinkedList *list) {
+    ULLNode *curr = list->head;
+
+    while (curr != NULL) {
+        ULLNode *temp = curr;
+        curr = curr->next;
+        free(temp);
+    }
+
+    ullInit(list);
+}
+
+// Helpers
+
+/**
+ * Helper function to create an empty node and link it into an unrolled
+ * linked list right after a given node.
+ * 
+ * @param list pointer to the UnrolledLinkedList
+ * @param prev the node to link the new node after (NULL to make it the head)
+ * @return a pointer to the newly created node, or NULL if memory allocation fails
+ */
+static ULLNode *createNodeAfter(UnrolledLinkedList *list, ULLNode *prev) {
+    ULLNode *new_node = malloc(sizeof(ULLNode));
+    if (new_node == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        return NULL;
+    }
+
+    new_node->count = 0;
+    new_node->prev = prev;
+    new_node->next = (prev == NULL) ? list->head : prev->next;
+
+    if (new_node->next != NULL) {
+        new_node->next->prev = new_node;
+    } else {
+        list->tail = new_node;
+    }
+
+    if (prev != NULL) {
+        prev->next = new_node;
+    } else {
+        list->head = new_node;
+    }
+
+    list->nodes++;
+    return new_node;
+}
+
+/**
+ * Helper function to unlink a node from an unrolled linked list and free it.
+ * 
+ * @param list pointer to the UnrolledLinkedList
+ * @param node the node to remove
+ */
+static void destroyNode(UnrolledLinkedList *list, ULLNode *node) {
+    if (node->prev != NULL) {
+        node->prev->next = node->next;
+    } else {
+        list->head = node->next;
+    }
+
+    if (node->next != NULL) {
+        node->next->prev = node->prev;
+    } else {
+        list->tail = node->prev;
+    }
+
+    free(node);
+    list->nodes--;
+}
+
+/**
+ * Helper function to find the node holding the value at a given position.
+ * Traverses from the head or the tail depending on the index.
+ * 
+ * @param list   pointer to the UnrolledLinkedList
+ * @param index  the position to look up (0 <= index < size)
+ * @param offset output: the position of the value inside the returned node
+ * @return the node holding the value at index
+ */
+static ULLNode *findNode(UnrolledLinkedList *list, int index, int *offset) {
+    if (index < list->size / 2) {
+        ULLNode *curr = list->head;
+
+        while (index >= curr->count) {
+            index -= curr->count;
+            curr = curr->next;
+        }
+        *offset = index;
+        return curr;
+    } else {
+        ULLNode *curr = list->tail;
+        int remaining = list->size - index;
+
+        while (remaining > curr->count) {
+            remaining -= curr->count;
+            curr = curr->prev;
+        }
+        *offset = curr->count - remaining;
+        return curr;
+    }
+}
+
+/**
+ * Helper function to insert a value into a node at a given offset.
+ * A full node is first split in two, moving its upper half into a new node.
+ * 
+ * @param list   pointer to the UnrolledLinkedList
+ * @param node   the node to insert into
+ * @param offset the position inside the node to insert the value at
+ * @param value  the value to insert
+ */
+static void insertIntoNode(UnrolledLinkedList *list, ULLNode *node, int offset, int value) {
+    if (node->count == ULL_NODE_CAPACITY) {
+        ULLNode *new_node = createNodeAfter(list, node);
+        if (new_node == NULL) return;
+
+        int keep = node->count / 2;
+        new_node->count = node->count - keep;
+        memcpy(new_node->values, node->values + keep, sizeof(int) * new_node->count);
+        node->count = keep;
+
+        if (offset > keep) {
+            offset -= keep;
+            node = new_node;
+        }
+    }
+
+    memmove(node->values + offset + 1, node->values + offset, sizeof(int) * (node->count - offset));
+    node->values[offset] = value;
+    node->count++;
+    list->size++;
+}
+
+/**
+ * Helper function to remove the value at a given offset of a node.
+ * An emptied node is freed; a node left less than half full is merged
+ * with its successor when both fit in one node, or otherwise borrows
+ * values from it.
+ * 
+ * @param list   pointer to the UnrolledLinkedList
+ * @param node   the node to remove from
+ * @param offset the position inside the node of the value to remove
+ */
+static void removeFromNode(UnrolledLinkedList *list, ULLNode *node, int offset) {
+    memmove(node->values + offset, node->values + offset + 1, sizeof(int) * (node->count - offset - 1));
+    node->count--;
+    list->size--;
+
+    if (node->count == 0) {
+        destroyNode(list, node);
+        return;
+    }
+
+    ULLNode *next = node->next;
+    if (node->count >= ULL_NODE_CAPACITY / 2 || next == NULL) return;
+
+    if (node->count + next->count <= ULL_NODE_CAPACITY) {
+        memcpy(node->values + node->count, next->values, sizeof(int) * next->count);
+        node->count += next->count;
+        destroyNode(list, next);
+    } else {
+        int moved = (next->count - node->count) / 2;
+        memcpy(node->values + node->count, next->values, sizeof(int) * moved);
+        memmove(next->values, next->values + moved, sizeof(int) * (next->count - moved));
+        node->count += moved;
+        next->count -= moved;
+    }
+}
+
+/**
+ * Helper function to check whether a node holds a value.
+ * With SSE2 the values are compared four at a time: the node is covered by
+ * whole vectors (the last one overlapping the previous one, so no load
+ * reaches past the node) and lanes at or past count are masked out.
+ * 
+ * @param node  pointer to the node
+ * @param value the value to search for
+ * @return true if one of the node's values equals value; false otherwise
+ */
+static inline bool nodeContains(const ULLNode *node, int value) {
+#if defined(__SSE2__)
+    __m128i target = _mm_set1_epi32(value);
+    __m128i count = _mm_set1_epi32(node->count);
+    __m128i lanes = _mm_setr_epi32(0, 1, 2, 3);
+    __m128i hits = _mm_setzero_si128();
+
+    for (int i = 0; i < ULL_NODE_CAPACITY; i += 4) {
+        int start = (i + 4 <= ULL_NODE_CAPACITY) ? i : ULL_NODE_CAPACITY - 4;
+        __m128i x = _mm_loadu_si128((const __m128i *)(node->values + start));
+        __m128i valid = _mm_cmpgt_epi32(count, _mm_add_epi32(_mm_set1_epi32(start), lanes));
+        hits = _mm_or_si128(hits, _mm_and_si128(_mm_cmpeq_epi32(x, target), valid));
+    }
+    return _mm_movemask_epi8(hits) != 0;
+#else
+    bool found = false;
+    for (int i = 0; i < node->count; i++) {
+        found |= (node->values[i] == value);
+    }
+    return found;
+#endif
+}
+
+// Insertion
+
+/**
+ * Inserts a value at the head of an unrolled linked list.
+ * A new head node is started when the current one is full.
+ * 
+ * @param list  pointer to the UnrolledLinkedList
+ * @param value the value to insert at the head
+ */
+void ullInsertAtHead(UnrolledLinkedList *list, int value) {
+    if (list->head == NULL || list->head->count == ULL_NODE_CAPACITY) {
+        if (createNodeAfter(list, NULL) == NULL) return;
+    }
+
+    insertIntoNode(list, list->head, 0, value);
+}
+
+/**
+ * Inserts a value at the tail of an unrolled linked list.
+ * A new tail node is started when the current one is full, so
+ * lists built by appending keep every node completely full.
+ * 
+ * @param list  pointer to the UnrolledLinkedList
+ * @param value the value to insert at the tail
+ */
+void ullInsertAtTail(UnrolledLinkedList *list, int value) {
+    if (list->tail == NULL || list->tail->count == ULL_NODE_CAPACITY) {
+        if (createNodeAfter(list, list->tail) == NULL) return;
+    }
+
+    list->tail->values[list->tail->count++] = value;
+    list->size++;
+}
+
+/**
+ * Inserts a value at a specific position in an unrolled linked list.
+ * Traverses the list either from the head or the tail depending on the index.
+ * 
+ * @param list  pointer to the UnrolledLinkedList
+ * @param value the value to insert
+ * @param index the index to insert the value at
+ */
+void ullInsertAtPosition(UnrolledLinkedList *list, int value, int index) {
+    if (index < 0 || index > list->size) {
+        fprintf(stderr, "Error: invalid index\n");
+        return;
+    }
+
+    if (index == 0) {
+        ullInsertAtHead(list, value);
+        return;
+    }
+
+    if (index == list->size) {
+        ullInsertAtTail(list, value);
+        return;
+    }
+
+    int offset;
+    ULLNode *node = findNode(list, index, &offset);
+    insertIntoNode(list, node, offset, value);
+}
+
+// Deletion
+
+/**
+ * Deletes the head value from an unrolled linked list.
+ * 
+ * @param list pointer to the UnrolledLinkedList
+ */
+void ullDeleteHead(UnrolledLinkedList *list) {
+    if (list->head == NULL) return;
+
+    removeFromNode(list, list->head, 0);
+}
+
+/**
+ * Deletes the tail value from an unrolled linked list.
+ * 
+ * @param list pointer to the UnrolledLinkedList
+ */
+void ullDeleteTail(UnrolledLinkedList *list) {
+    if (list->tail == NULL) return;
+
+    removeFromNode(list, list->tail, list->tail->count - 1);
+}
+
+/**
+ * Deletes the first occurrence of a value from an unrolled linked list.
+ * If the value is not found, the list remains the same.
+ * 
+ * @param list  pointer to the UnrolledLinkedList
+ * @param value the value to delete
+ */
+void ullDeleteByValue(UnrolledLinkedList *list, int value) {
+    ULLNode *curr = list->head;
+
+    while (curr != NULL) {
+        for (int i = 0; i < curr->count; i++) {
+            if (curr->values[i] == value) {
+                removeFromNode(list, curr, i);
+                return;
+            }
+        }
+        curr = curr->next;
+    }
+}
+
+/**
+ * Deletes a value from an unrolled linked list based on a given position.
+ * 
+ * @param list  pointer to the UnrolledLinkedList
+ * @param index the index to delete a value at
+ */
+void ullDeleteByPosition(UnrolledLinkedList *list, int index) {
+    if (index < 0 || index >= list->size) {
+        fprintf(stderr, "Error: invalid index\n");
+        return;
+    }
+
+    int offset;
+    ULLNode *node = findNode(list, index, &offset);
+    removeFromNode(list, node, offset);
+}
+
+// Utility
+
+/**
+ * Iteratively searches for a value in an unrolled linked list.
+ * Compares the values of each node with vector instructions, and walks
+ * in from the head and the tail at the same time so the cache misses of
+ * the two independent pointer chains overlap.
+ * 
+ * @param list  pointer to the UnrolledLinkedList
+ * @param value the value to search for
+ * @return true if the value was found; false otherwise
+ */
+bool ullSearchIterative(UnrolledLinkedList *list, int value) {
+    ULLNode *front = list->head;
+    ULLNode *back = list->tail;
+    int remaining = list->nodes;
+
+    while (remaining >= 2) {
+        if (nodeContains(front, value) | nodeContains(back, value)) return true;
+        front = front->next;
+        back = back->prev;
+        remaining -= 2;
+    }
+
+    return remaining == 1 && nodeContains(front, value);
+}
+
+/**
+ * Prints out a string representation of an unrolled linked list.
+ * 
+ * @param list pointer to the UnrolledLinkedList
+ */
+void ullPrint(UnrolledLinkedList *list) {
+    OutputBuffer out;
+    obInit(&out, stdout, 0);
+    ullFormat(list, &out, OUTPUT_TEXT);
+    obFree(&out);
+}
+
+/**
+ * Prints out a string representation of an unrolled linked list in reverse order.
+ * 
+ * @param list pointer to the UnrolledLinkedList
+ */
+void ullPrintReverse(UnrolledLinkedList *list) {
+    OutputBuffer out;
+    obInit(&out, stdout, 0);
+    ullFormatReverse(list, &out, OUTPUT_TEXT);
+    obFree(&out);
+}
+
+/**
+ * Returns the size of an unrolled linked list.
+ * 
+ * @param list pointer to the UnrolledLinkedList
+ * @return the number of values in the list
+ */
+int ullGetLength(UnrolledLinkedList *list) {
+    return list->size;
+}
+
+/**
+ * Checks whether an unrolled linked list is empty.
+ * 
+ * @param list pointer to the UnrolledLinkedList
+ * @return true if the list is empty; false otherwise
+ */
+bool ullIsEmpty(UnrolledLinkedList *list) {
+    return (list->size == 0);
+}
@@ -0,0 +1,63 @@
+/**
+ * @file unrolled_linked_list.h
+ * @brief Public interface of the unrolled doubly linked list for integers.
+ *
+ * Each node stores a small array of values instead of a single int, so the
+ * pointer overhead is paid once per node and traversal scans contiguous
+ * values. Nodes are split when they overflow and merged or rebalanced with
+ * their successor when they drop below half full.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#ifndef UNROLLED_LINKED_LIST_H
+#define UNROLLED_LINKED_LIST_H
+
+#include <stdbool.h>
+
+// Size (in bytes) of one node; picked to fill exactly one 64-byte cache line.
+#define ULL_NODE_BYTES 64
+
+// Number of values that fit in one node next to its two links and count.
+#define ULL_NODE_CAPACITY ((int)((ULL_NODE_BYTES - 2 * sizeof(void *) - sizeof(int)) / sizeof(int)))
+
+// Structure to represent a node holding several values.
+typedef struct ULLNode {
+    struct ULLNode *next;            // pointer to the next node in the list (NULL if last node)
+    struct ULLNode *prev;            // pointer to the previous node in the list (NULL if head node)
+    int count;                       // number of values currently stored in this node
+    int values[ULL_NODE_CAPACITY];   // the values stored in this node, in list order
+} ULLNode;
+
+// Structure to represent an unrolled linked list
+typedef struct UnrolledLinkedList {
+    ULLNode *head; // pointer to the head node of the unrolled linked list
+    ULLNode *tail; // pointer to the tail node of the unrolled linked list
+    int size;      // number of values currently stored
+    int nodes;     // number of nodes currently allocated
+} UnrolledLinkedList;
+
+// Core lifecycle
+void ullInit(UnrolledLinkedList *list);
+void ullFree(UnrolledLinkedList *list);
+
+// Insertion
+void ullInsertAtHead(UnrolledLinkedList *list, int value);
+void ullInsertAtTail(UnrolledLinkedList *list, int value);
+void ullInsertAtPosition(UnrolledLinkedList *list, int value, int index);
+
+// Deletion
+void ullDeleteHead(UnrolledLinkedList *list);
+void ullDeleteTail(UnrolledLinkedList *list);
+void ullDeleteByValue(UnrolledLinkedList *list, int value);
+void ullDeleteByPosition(UnrolledLinkedList *list, int index);
+
+// Utility
+bool ullSearchIterative(UnrolledLinkedList *list, int value);
+void ullPrint(UnrolledLinkedList *list);
+void ullPrintReverse(UnrolledLinkedList *list);
+int ullGetLength(UnrolledLinkedList *list);
+bool ullIsEmpty(UnrolledLinkedList *list);
+
+#endif // UNROLLED_LINKED_LIST_H
@@ -0,0 +1,226 @@
+/**
+ * @file batch_search.c
+ * @brief Implementation of batched binary search over one sorted int array.
+ * 
+ * Provides an interleaved scalar kernel that advances a group of searches
+ * together and an AVX2 kernel that advances them eight per vector with
+ * gathers. binarySearchBatch picks the AVX2 kernel when the CPU supports it.
+ * Every result follows the binarySearchBranchless contract: the index of
+ * the first occurrence of the target, or -1.
+ * 
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#include "batch_search.h"
+#include "binary_search.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define HAVE_AVX2_KERNEL 1
+#include <immintrin.h>
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define PREFETCH(addr) __builtin_prefetch(addr)
+#else
+#define PREFETCH(addr) ((void)(addr))
+#endif
+
+// Number of searches the scalar kernel advances together.
+#define SCALAR_LANES 16
+
+// Number of 8-lane vectors the AVX2 kernel advances together.
+#define AVX2_VECTORS 4
+
+// Helpers
+
+/**
+ * Helper function to turn the final lock-step position of one search
+ * into its result.
+ * 
+ * @param arr    the sorted array
+ * @param size   the number of elements in the array
+ * @param base   the position the search converged to
+ * @param target the value searched for
+ * @return the index of the first occurrence of target if found; -1 otherwise
+ */
+static inline int finishSearch(const int arr[], int size, int base, int target) {
+    int index = base + (arr[base] < target);
+    return (index < size && arr[index] == target) ? index : -1;
+}
+
+/**
+ * Helper function to run one group of SCALAR_LANES searches in lock-step.
+ * 
+ * @param arr     the sorted array
+ * @param size    the number of elements in the array (at least 1)
+ * @param targets SCALAR_LANES values to search for
+ * @param indices output: SCALAR_LANES results
+ */
+static void searchGroupScalar(const int arr[], int size, const int targets[], int indices[]) {
+    int base[SCALAR_LANES] = {0};
+    int n = size;
+
+    while (n > 1) {
+        int half = n / 2;
+        int next_half = (n - half) / 2;
+
+        for (int g = 0; g < SCALAR_LANES; g++) {
+            const int *lane = arr + base[g];
+            lane += (lane[half - 1] < targets[g]) * half;
+            base[g] = (int)(lane - arr);
+            // next_half is 0 on the last step (n == 2): nothing left to fetch,
+            // and lane - 1 could point before the array.
+            if (next_half > 0) PREFETCH(lane + next_half - 1);
+        }
+        n -= half;
+    }
+
+    for (int g = 0; g < SCALAR_LANES; g++) {
+        indices[g] = finishSearch(arr, size, base[g], targets[g]);
+    }
+}
+
+#ifdef HAVE_AVX2_KERNEL
+
+/**
+ * Helper function to run AVX2_VECTORS * 8 searches in lock-step with gathers.
+ * 
+ * @param arr     the sorted array
+ * @param size    the number of elements in the array (at least 1)
+ * @param targets AVX2_VECTORS * 8 values to search for
+ * @param indices output: AVX2_VECTORS * 8 results
+ */
+__attribute__((target("avx2")))
+static void searchGroupAvx2(const int arr[], int size, const int targets[], int indices[]) {
+    __m256i base[AVX2_VECTORS];
+    __m256i target[AVX2_VECTORS];
+    int n = size;
+
+    for (int v = 0; v < AVX2_VECTORS; v++) {
+        base[v] = _mm256_setzero_si256();
+        target[v] = _mm256_loadu_si256((const __m256i *)(targets + 8 * v));
+    }
+
+    while (n > 1) {
+        int half = n / 2;
+        __m256i step = _mm256_set1_epi32(half);
+        __m256i probe = _mm256_set1_epi32(half - 1);
+
+        for (int v = 0; v < AVX2_VECTORS; v++) {
+            __m256i keys = _mm256_i32gather_epi32(arr, _mm256_add_epi32(base[v], probe), 4);
+            __m256i less = _mm256_cmpgt_epi32(target[v], keys);
+            base[v] = _mm256_add_epi32(base[v], _mm256_and_si256(less, step));
+        }
+        n -= half;
+    }
+
+    for (int v = 0; v < AVX2_VECTORS; v++) {
+        _mm256_storeu_si256((__m256i *)(indices + 8 * v), base[v]);
+    }
+    for (int g = 0; g < AVX2_VECTORS * 8; g++) {
+        indices[g] = finishSearch(arr, size, indices[g], targets[g]);
+    }
+}
+
+#endif // HAVE_AVX2_KERNEL
+
+// Batch search
+
+/**
+ * Performs a batch of binary searches with the interleaved scalar kernel.
+ * Searches run SCALAR_LANES at a time in lock-step, prefetching the next
+ * probe of every lane, so up to SCALAR_LANES cache misses are in flight.
+ * 
+ * @param arr     the sorted array to search
+ * @param size    the number of elements in the array
+ * @param targets the values to search for
+ * @param indices output: for every target, its index if found; -1 otherwise
+ * @param count   the number of targets
+ */
+void binarySearchBatchScalar(int arr[], int size, const int targets[], int indices[], int count) {
+    int i = 0;
+
+    if (size > 0) {
+        for (; i + SCALAR_LANES <= count; i += SCALAR_LANES) {
+            searchGroupScalar(arr, size, targets + i, indices + i);
+        }
+    }
+    for (; i < count; i++) {
+        indices[i] = binarySearchBranchless(arr, size, targets[i]);
+    }
+}
+
+/**
+ * Performs a batch of binary searches with the AVX2 gather kernel.
+ * Searches run AVX2_VECTORS * 8 at a time in lock-step. Falls back to
+ * the scalar kernel if the CPU does not support AVX2.
+ * 
+ * @param arr     the sorted array to search
+ * @param size    the number of elements in the array
+ * @param targets the values to search for
+ * @param indices output: for every target, its index if found; -1 otherwise
+ * @param count   the number of targets
+ */
+void binarySearchBatchAvx2(int arr[], int size, const int targets[], int indices[], int count) {
+#ifdef HAVE_AVX2_KERNEL
+    if (binarySearchBatchHasAvx2()) {
+        int lanes = AVX2_VECTORS * 8;
+        int i = 0;
+
+        if (size > 0) {
+            for (; i + lanes <= count; i += lanes) {
+                searchGroupAvx2(arr, size, targets + i, indices + i);
+            }
+        }
+        binarySearchBatchScalar(arr, size, targets + i, indices + i, count - i);
+        return;
+    }
+#endif
+    binarySearchBatchScalar(arr, size, targets, indices, count);
+}
+
+/**
+ * Checks whether the CPU running the program supports the AVX2 kernel.
+ * 
+ * @return true if AVX2 is available; false otherwise
+ */
+bool binarySearchBatchHasAvx2(void) {
+#ifdef HAVE_AVX2_KERNEL
+    // Only the answer is shared, so relaxed accesses suffice; racing first
+    // callers just detect twice and store the same value.
+    static atomic_int supported = -1;
+    int cached = atomic_load_explicit(&supported, memory_order_relaxed);
+    if (cached < 0) {
+        __builtin_cpu_init();
+        cached = __builtin_cpu_supports("avx2") ? 1 : 0;
+        atomic_store_explicit(&supported, cached, memory_order_relaxed);
+    }
+    return cached == 1;
+#else
+    return false;
+#endif
+}
+
+/**
+ * Performs a batch of binary searches over one sorted array, using the
+ * fastest kernel the CPU supports.
+ * 
+ * @param arr     the sorted array to search
+ * @param size    the number of elements in the array
+ * @param targets the values to search for
+ * @param indices output: for every target, its index if found; -1 otherwise
+ *                (the first occurrence if the target is duplicated)
+ * @param count   the number of targets
+ */
+void binarySearchBatch(int arr[], int size, const int targets[], int indices[], int count) {
+    if (binarySearchBatchHasAvx2()) {
+        binarySearchBatchAvx2(arr, size, targets, indices, count);
+    } else {
+        binarySearchBatchScalar(arr, size, targets, indices, count);
+    }
+}
@@ -0,0 +1,24 @@
+/**
+ * @file batch_search.h
+ * @brief Public interface of batched binary search over one sorted int array.
+ *
+ * A batch call answers many lookups against the same array. Because every
+ * lookup on an array of a given size takes the same number of branchless
+ * steps, the searches run in lock-step and their memory accesses overlap
+ * instead of waiting on one cache miss at a time.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#ifndef BATCH_SEARCH_H
+#define BATCH_SEARCH_H
+
+#include <stdbool.h>
+
+void binarySearchBatch(int arr[], int size, const int targets[], int indices[], int count);
+void binarySearchBatchScalar(int arr[], int size, const int targets[], int indices[], int count);
+void binarySearchBatchAvx2(int arr[], int size, const int targets[], int indices[], int count);
+bool binarySearchBatchHasAvx2(void);
+
+#endif // BATCH_SEARCH_H
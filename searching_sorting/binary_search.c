@@ -3,7 +3,8 @@
  * @brief Implementation of binary search (iterative and recursive) on sorted arrays.
  * 
  * Provides functions to perform binary search on a sorted array using 
- * both iterative and recursive methods.
+ * both iterative and recursive methods, plus branchless and prefetching
+ * kernels for large lookup workloads and a selector between them.
  * 
  * @author Isaac Tapia
  * @date   May 2025
@@ -12,6 +13,14 @@
 #include <stdio.h>
 #include <stdbool.h>
 
+#include "binary_search.h"
+
+#if defined(__GNUC__) || defined(__clang__)
+#define PREFETCH(addr) __builtin_prefetch(addr)
+#else
+#define PREFETCH(addr) ((void)(addr))
+#endif
+
 /**
  * Performs binary search using iteration.
  * 
@@ -55,28 +64,113 @@ int binarySearchRecursive(int arr[], int left, int right, int target) {
 
     if (arr[middle] == target) return middle;
     if (arr[middle] < target)  return binarySearchRecursive(arr, middle + 1, right, target);
-    if (arr[middle] > target)  return binarySearchRecursive(arr, left, middle - 1, target); 
+    return binarySearchRecursive(arr, left, middle - 1, target);
 }
 
-int main() {
-    // Sample sorted array
-    int arr[] = {1, 3 ,5, 7, 9, 11, 13};
-    int size = sizeof(arr) / sizeof(arr[0]);
+// Helpers
 
-    // Sample targets to test
-    int targets[] = {7, 2, 11, 14};
-    int num_tests = sizeof(targets) / sizeof(targets[0]);
+/**
+ * Helper function with the body of the branchless kernel, inlined into
+ * both binarySearchBranchless and binarySearch.
+ * 
+ * @param arr    the sorted array to search
+ * @param size   the number of elements in the array
+ * @param target the value to search for
+ * @return the index of the first occurrence of target if found; -1 otherwise
+ */
+static inline int searchBranchless(const int arr[], int size, int target) {
+    if (size <= 0) return -1;
+
+    const int *base = arr;
+    int n = size;
 
-    printf("Testing binary search:\n");
+    while (n > 1) {
+        int half = n / 2;
+        base += (base[half - 1] < target) * half;
+        n -= half;
+    }
 
-    for (int i = 0; i < num_tests; i++) {
-        int target = targets[i];
-        int index_iter = binarySearchIterative(arr, size, target);
-        int index_rec = binarySearchRecursive(arr, 0, size -1, target);
+    int index = (int)(base - arr) + (*base < target);
+    return (index < size && arr[index] == target) ? index : -1;
+}
 
-        printf("Target %d: Iterative index = %d, Recurisve index = %d\n",
-                target, index_iter, index_rec);
+/**
+ * Helper function with the body of the prefetching kernel, inlined into
+ * both binarySearchPrefetch and binarySearch.
+ * 
+ * @param arr    the sorted array to search
+ * @param size   the number of elements in the array
+ * @param target the value to search for
+ * @return the index of the first occurrence of target if found; -1 otherwise
+ */
+static inline int searchPrefetch(const int arr[], int size, int target) {
+    if (size <= 0) return -1;
+
+    const int *base = arr;
+    int n = size;
+
+    while (n > 1) {
+        int half = n / 2;
+        int next_half = (n - half) / 2;
+        // next_half is 0 on the last step (n == 2): nothing left to fetch,
+        // and base - 1 would point before the array.
+        if (next_half > 0) {
+            PREFETCH(base + next_half - 1);
+            PREFETCH(base + half + next_half - 1);
+        }
+        base += (base[half - 1] < target) * half;
+        n -= half;
+    }
+
+    int index = (int)(base - arr) + (*base < target);
+    return (index < size && arr[index] == target) ? index : -1;
+}
+
+/**
+ * Performs binary search without data-dependent branches.
+ * Each step advances the base by (comparison * half) instead of branching,
+ * which compiles to a conditional move; the loop runs exactly
+ * ceil(log2(size)) times and never mispredicts. The match is checked once
+ * at the end. With duplicate values, the index of the first occurrence
+ * is returned.
+ * 
+ * @param arr    the sorted array to search
+ * @param size   the number of elements in the array
+ * @param target the value to search for
+ * @return the index of the target if found; -1 otherwise
+ */
+int binarySearchBranchless(int arr[], int size, int target) {
+    return searchBranchless(arr, size, target);
+}
+
+/**
+ * Performs branchless binary search while prefetching both possible
+ * midpoints of the next step, so the memory access of step k+1 overlaps
+ * with the comparison of step k on arrays larger than the cache.
+ * With duplicate values, the index of the first occurrence is returned.
+ * 
+ * @param arr    the sorted array to search
+ * @param size   the number of elements in the array
+ * @param target the value to search for
+ * @return the index of the target if found; -1 otherwise
+ */
+int binarySearchPrefetch(int arr[], int size, int target) {
+    return searchPrefetch(arr, size, target);
+}
+
+/**
+ * Performs binary search with the kernel that is fastest for the array size:
+ * the branchless kernel while the array fits in the cache, and the
+ * prefetching kernel once lookups start to miss it.
+ * 
+ * @param arr    the sorted array to search
+ * @param size   the number of elements in the array
+ * @param target the value to search for
+ * @return the index of the target if found; -1 otherwise
+ */
+int binarySearch(int arr[], int size, int target) {
+    if (size < BINARY_SEARCH_PREFETCH_MIN_SIZE) {
+        return searchBranchless(arr, size, target);
     }
-    
-    return 0;
+    return searchPrefetch(arr, size, target);
 }
@@ -0,0 +1,21 @@
+/**
+ * @file binary_search.h
+ * @brief Public interface of binary search on sorted int arrays.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#ifndef BINARY_SEARCH_H
+#define BINARY_SEARCH_H
+
+// Array size (in elements) from which binarySearch switches to the prefetching kernel.
+#define BINARY_SEARCH_PREFETCH_MIN_SIZE (128 * 1024)
+
+int binarySearchIterative(int arr[], int size, int target);
+int binarySearchRecursive(int arr[], int left, int right, int target);
+int binarySearchBranchless(int arr[], int size, int target);
+int binarySearchPrefetch(int arr[], int size, int target);
+int binarySearch(int arr[], int size, int target);
+
+#endif // BINARY_SEARCH_H
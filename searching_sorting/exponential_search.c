@@ -0,0 +1,86 @@
+/**
+ * @file exponential_search.c
+ * @brief Implementation of exponential (galloping) search on sorted data.
+ * 
+ * Exponential search probes indexes 1, 2, 4, 8, ... until it passes the
+ * target and then bisects the last gap, so it costs O(log i) probes for a
+ * target at index i. It never needs the total size, which makes it the
+ * search of choice for streamed data of unknown length.
+ * 
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#include <stdio.h>
+#include <stdbool.h>
+
+#include "exponential_search.h"
+#include "binary_search.h"
+
+/**
+ * Performs exponential search on a sorted array.
+ * 
+ * @param arr    the sorted array to search
+ * @param size   the number of elements in the array
+ * @param target the value to search for
+ * @return the index of the target if found; -1 otherwise
+ */
+int exponentialSearch(int arr[], int size, int target) {
+    if (size <= 0) return -1;
+    if (arr[0] == target) return 0;
+
+    int bound = 1;
+    while (bound < size && arr[bound] < target) {
+        bound = (bound <= size / 2) ? bound * 2 : size;
+    }
+
+    int left = bound / 2;
+    int right = (bound < size) ? bound : size - 1;
+    int index = binarySearchIterative(arr + left, right - left + 1, target);
+
+    return (index == -1) ? -1 : left + index;
+}
+
+/**
+ * Performs exponential search on sorted data whose length is not known
+ * up front. Indexes past the end behave as values larger than any target.
+ * 
+ * @param get    accessor returning the value at an index, or false past the end
+ * @param ctx    caller data passed through to the accessor
+ * @param target the value to search for
+ * @return the index of the target if found; -1 otherwise
+ */
+int exponentialSearchUnbounded(SortedAccessor get, void *ctx, int target) {
+    int value;
+
+    if (!get(ctx, 0, &value)) return -1;
+    if (value == target) return 0;
+    if (value > target) return -1;
+
+    // Gallop until the probe is past the end or not smaller than the target.
+    int bound = 1;
+    while (get(ctx, bound, &value) && value < target) {
+        if (bound > (1 << 29)) {
+            bound = 0x7FFFFFFF;
+            break;
+        }
+        bound *= 2;
+    }
+
+    // Bisect (bound / 2, bound]; arr[bound / 2] < target is already known.
+    int left = bound / 2 + 1;
+    int right = bound;
+
+    while (left <= right) {
+        int middle = left + (right - left) / 2;
+
+        if (!get(ctx, middle, &value) || value > target) {
+            right = middle - 1;
+        } else if (value < target) {
+            left = middle + 1;
+        } else {
+            return middle;
+        }
+    }
+    return -1;
+}
@@ -0,0 +1,21 @@
+/**
+ * @file exponential_search.h
+ * @brief Public interface of exponential (galloping) search on sorted int data.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#ifndef EXPONENTIAL_SEARCH_H
+#define EXPONENTIAL_SEARCH_H
+
+#include <stdbool.h>
+
+// Accessor used to search sorted data of unknown length: stores the value at
+// index in *value and returns true, or returns false if index is past the end.
+typedef bool (*SortedAccessor)(void *ctx, int index, int *value);
+
+int exponentialSearch(int arr[], int size, int target);
+int exponentialSearchUnbounded(SortedAccessor get, void *ctx, int target);
+
+#endif // EXPONENTIAL_SEARCH_H
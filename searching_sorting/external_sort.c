@@ -0,0 +1,641 @@
+/**
+ * @file external_sort.c
+ * @brief Implementation of the external-memory merge sort.
+ *
+ * Run formation keeps three run buffers in a pipeline: while one run is
+ * sorted (in one slice per thread, each slice becoming its own run), the
+ * next run is read from the input and the previous one is written to the
+ * temporary file. The merge gives every run a double-buffered reader and
+ * the output a double-buffered writer, and picks the next record with a
+ * loser tree, which needs one comparison per tree level per record. When
+ * there are too many runs for the memory budget, groups of runs are first
+ * merged into longer runs in another temporary file.
+ *
+ * Background I/O uses one short-lived thread per block transfer; blocks
+ * are at least EXTERNAL_SORT_MIN_BLOCK bytes, which keeps thread start-up
+ * cost small next to the transfer.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/types.h>
+
+#include "external_sort.h"
+
+// Upper bound on the threads used to sort runs.
+#define EXTERNAL_SORT_MAX_THREADS 64
+
+// Structure to represent the settings shared by every stage of one sort.
+typedef struct {
+    size_t element_size;  // size (in bytes) of one record
+    SortCompare compare;  // record comparator
+    bool ints;            // records are ints compared by value
+    size_t memory;        // memory budget (in bytes)
+    int threads;          // threads used to sort runs
+} SortContext;
+
+// Structure to represent one sorted run in a temporary file.
+typedef struct {
+    off_t offset; // byte offset of the first record
+    long count;   // number of records
+} SortRun;
+
+// Structure to represent one block transfer done on a background thread.
+typedef struct {
+    FILE *file;    // stream to read or write sequentially (NULL to use fd)
+    int fd;        // file descriptor for positioned reads and writes
+    off_t offset;  // position of the transfer when using fd
+    char *buffer;  // memory side of the transfer
+    size_t bytes;  // bytes to transfer
+    size_t done;   // bytes actually transferred
+    bool write;    // true to write the buffer; false to read into it
+} IoRequest;
+
+// Structure to represent a task that may run on a background thread.
+typedef struct {
+    pthread_t thread; // the thread running the task
+    bool running;     // true while the thread has not been joined
+} Job;
+
+// Structure to represent a double-buffered reader of one run.
+typedef struct {
+    IoRequest request; // the read in flight, if pending
+    Job job;           // thread of the read in flight
+    bool pending;      // true if a read is in flight
+    char *buffers[2];  // the two blocks
+    int fill;          // block the next read goes into
+    size_t block;      // bytes per block
+    off_t next;        // file offset of the next read
+    off_t end;         // file offset one past the run
+    char *pos;         // current record (NULL once the run is exhausted)
+    char *limit;       // one past the last record of the current block
+} RunReader;
+
+// Structure to represent a double-buffered writer.
+typedef struct {
+    IoRequest request; // the write in flight, if pending
+    Job job;           // thread of the write in flight
+    bool pending;      // true if a write is in flight
+    char *buffers[2];  // the two blocks
+    int current;       // block being filled
+    size_t block;      // bytes per block
+    size_t used;       // bytes filled in the current block
+    FILE *file;        // output stream (NULL to use fd)
+    int fd;            // output descriptor when file is NULL
+    off_t offset;      // file offset of the next write when using fd
+    bool error;        // true once a write came up short
+} RunWriter;
+
+// Structure to represent one slice of a run sorted by one thread.
+typedef struct {
+    const SortContext *context; // sort settings
+    char *base;                 // first record of the slice
+    long count;                 // number of records
+    int *scratch;               // radix sort scratch for count ints (ints only)
+} SliceTask;
+
+// Helpers
+
+/**
+ * Helper function to allocate memory or exit.
+ *
+ * @param bytes the number of bytes
+ * @return the allocated block
+ */
+static void *allocOrExit(size_t bytes) {
+    void *block = malloc(bytes > 0 ? bytes : 1);
+    if (block == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    return block;
+}
+
+/**
+ * Helper function to compare two ints for externalSortInts.
+ */
+static int compareInts(const void *a, const void *b) {
+    int x = *(const int *)a;
+    int y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * Helper function to perform a block transfer.
+ *
+ * @param arg pointer to the IoRequest; its done field receives the result
+ * @return NULL
+ */
+static void *transfer(void *arg) {
+    IoRequest *request = arg;
+    size_t done = 0;
+
+    if (request->file != NULL) {
+        done = request->write ? fwrite(request->buffer, 1, request->bytes, request->file)
+                              : fread(request->buffer, 1, request->bytes, request->file);
+    } else {
+        while (done < request->bytes) {
+            ssize_t n = request->write
+                ? pwrite(request->fd, request->buffer + done, request->bytes - done, request->offset + (off_t)done)
+                : pread(request->fd, request->buffer + done, request->bytes - done, request->offset + (off_t)done);
+            if (n <= 0) break;
+            done += (size_t)n;
+        }
+    }
+    request->done = done;
+    return NULL;
+}
+
+/**
+ * Helper function to start a task on a background thread. If no thread
+ * can be created the task runs on the caller before returning.
+ *
+ * @param job  the Job to track the thread with
+ * @param task the task function
+ * @param arg  the argument of the task
+ */
+static void startJob(Job *job, void *(*task)(void *), void *arg) {
+    job->running = pthread_create(&job->thread, NULL, task, arg) == 0;
+    if (!job->running) task(arg);
+}
+
+/**
+ * Helper function to wait for a task started with startJob.
+ *
+ * @param job the Job of the task
+ */
+static void finishJob(Job *job) {
+    if (job->running) {
+        pthread_join(job->thread, NULL);
+        job->running = false;
+    }
+}
+
+/**
+ * Helper function to start reading the next block of a run, if any is left.
+ *
+ * @param reader pointer to the RunReader
+ * @param fd     the descriptor of the file holding the run
+ */
+static void startRunRead(RunReader *reader, int fd) {
+    if (reader->next >= reader->end) {
+        reader->pending = false;
+        return;
+    }
+
+    size_t bytes = reader->block;
+    if ((off_t)bytes > reader->end - reader->next) bytes = (size_t)(reader->end - reader->next);
+
+    reader->request = (IoRequest){NULL, fd, reader->next, reader->buffers[reader->fill], bytes, 0, false};
+    reader->next += (off_t)bytes;
+    reader->pending = true;
+    startJob(&reader->job, transfer, &reader->request);
+}
+
+/**
+ * Helper function to make the block read in the background current and
+ * start reading the one after it into the other buffer.
+ *
+ * @param reader pointer to the RunReader
+ * @param fd     the descriptor of the file holding the run
+ * @return false if the run is exhausted or the read failed; true otherwise
+ */
+static bool refillRun(RunReader *reader, int fd) {
+    reader->pos = NULL;
+    if (!reader->pending) return false;
+
+    finishJob(&reader->job);
+    if (reader->request.done != reader->request.bytes) return false;
+
+    reader->pos = reader->buffers[reader->fill];
+    reader->limit = reader->pos + reader->request.done;
+    reader->fill ^= 1;
+    startRunRead(reader, fd);
+    return true;
+}
+
+/**
+ * Helper function to hand the current block of a writer to a background
+ * write and switch to the other block.
+ *
+ * @param writer pointer to the RunWriter
+ */
+static void flushWriter(RunWriter *writer) {
+    if (writer->pending) {
+        finishJob(&writer->job);
+        writer->error |= writer->request.done != writer->request.bytes;
+        writer->pending = false;
+    }
+    if (writer->used == 0) return;
+
+    writer->request = (IoRequest){writer->file, writer->fd, writer->offset,
+                                  writer->buffers[writer->current], writer->used, 0, true};
+    writer->offset += (off_t)writer->used;
+    writer->pending = true;
+    startJob(&writer->job, transfer, &writer->request);
+
+    writer->current ^= 1;
+    writer->used = 0;
+}
+
+/**
+ * Helper function to set up a double-buffered writer.
+ *
+ * @param writer pointer to the RunWriter
+ * @param file   the output stream, or NULL to write to fd
+ * @param fd     the output descriptor (ignored if file is not NULL)
+ * @param offset the offset of the first write to fd
+ * @param block  bytes per block
+ */
+static void initWriter(RunWriter *writer, FILE *file, int fd, off_t offset, size_t block) {
+    writer->pending = false;
+    writer->buffers[0] = allocOrExit(block);
+    writer->buffers[1] = allocOrExit(block);
+    writer->current = 0;
+    writer->block = block;
+    writer->used = 0;
+    writer->file = file;
+    writer->fd = fd;
+    writer->offset = offset;
+    writer->error = false;
+}
+
+/**
+ * Helper function to flush a writer, wait for its last write and free it.
+ *
+ * @param writer pointer to the RunWriter
+ * @return true if every write succeeded; false otherwise
+ */
+static bool closeWriter(RunWriter *writer) {
+    flushWriter(writer);
+    flushWriter(writer);
+    free(writer->buffers[0]);
+    free(writer->buffers[1]);
+    return !writer->error;
+}
+
+/**
+ * Helper function to sort one slice of a run.
+ *
+ * @param arg pointer to the SliceTask
+ * @return NULL
+ */
+static void *sortSlice(void *arg) {
+    SliceTask *task = arg;
+    const SortContext *context = task->context;
+
+    if (context->ints) {
+        radixSortScratch((int *)task->base, task->scratch, (int)task->count);
+    } else {
+        genericSort(task->base, (int)task->count, context->element_size, context->compare);
+    }
+    return NULL;
+}
+
+/**
+ * Helper function to check whether the record of run a sorts before the
+ * record of run b in the loser tree. Exhausted runs sort last, index k
+ * stands for a virtual run that sorts first, and ties go to the lower run
+ * index so the merge is stable.
+ *
+ * @param context the sort settings
+ * @param readers the run readers
+ * @param k       the number of runs
+ * @param a       a run index (or k)
+ * @param b       a run index (or k)
+ * @return true if a wins against b; false otherwise
+ */
+static inline bool wins(const SortContext *context, const RunReader *readers, int k, int a, int b) {
+    if (a == k || b == k) return a == k;
+
+    const char *x = readers[a].pos;
+    const char *y = readers[b].pos;
+    if (x == NULL || y == NULL) return y == NULL && (x != NULL || a < b);
+
+    int order = context->ints ? compareInts(x, y) : context->compare(x, y);
+    return order < 0 || (order == 0 && a < b);
+}
+
+/**
+ * Helper function to replay the matches of one leaf up to the root of a
+ * loser tree after its run has moved to its next record.
+ *
+ * @param context the sort settings
+ * @param readers the run readers
+ * @param tree    the loser tree: tree[0] is the winner, tree[1..k) losers
+ * @param k       the number of runs
+ * @param leaf    the run whose record changed
+ */
+static void replay(const SortContext *context, const RunReader *readers, int *tree, int k, int leaf) {
+    int winner = leaf;
+
+    for (int node = (leaf + k) / 2; node > 0; node /= 2) {
+        if (wins(context, readers, k, tree[node], winner)) {
+            int loser = winner;
+            winner = tree[node];
+            tree[node] = loser;
+        }
+    }
+    tree[0] = winner;
+}
+
+/**
+ * Helper function to k-way merge runs of a temporary file into a writer.
+ *
+ * @param context the sort settings
+ * @param fd      the descriptor of the file holding the runs
+ * @param runs    the runs to merge
+ * @param k       the number of runs (at least 1)
+ * @param block   bytes per read block of every run
+ * @param out     the writer receiving the merged records
+ * @return true on success; false if a read failed
+ */
+static bool mergeRuns(const SortContext *context, int fd, const SortRun *runs, int k,
+                      size_t block, RunWriter *out) {
+    size_t element_size = context->element_size;
+    RunReader *readers = allocOrExit(sizeof(RunReader) * k);
+    int *tree = allocOrExit(sizeof(int) * k);
+    bool ok = true;
+
+    for (int i = 0; i < k; i++) {
+        RunReader *reader = &readers[i];
+        reader->job.running = false;
+        reader->buffers[0] = allocOrExit(block);
+        reader->buffers[1] = allocOrExit(block);
+        reader->fill = 0;
+        reader->block = block;
+        reader->next = runs[i].offset;
+        reader->end = runs[i].offset + (off_t)(runs[i].count * (long)element_size);
+        startRunRead(reader, fd);
+    }
+    for (int i = 0; i < k; i++) {
+        if (!refillRun(&readers[i], fd) && readers[i].pending) ok = false;
+    }
+
+    // Start from a tree full of the virtual winner k and let every run play in.
+    for (int i = 0; i < k; i++) tree[i] = k;
+    for (int i = k - 1; i >= 0; i--) replay(context, readers, tree, k, i);
+
+    while (ok && readers[tree[0]].pos != NULL) {
+        RunReader *reader = &readers[tree[0]];
+
+        if (out->used + element_size > out->block) flushWriter(out);
+        memcpy(out->buffers[out->current] + out->used, reader->pos, element_size);
+        out->used += element_size;
+
+        reader->pos += element_size;
+        if (reader->pos == reader->limit && !refillRun(reader, fd) && reader->pending) ok = false;
+        replay(context, readers, tree, k, tree[0]);
+    }
+
+    for (int i = 0; i < k; i++) {
+        finishJob(&readers[i].job);
+        if (readers[i].pending && readers[i].request.done != readers[i].request.bytes) ok = false;
+        free(readers[i].buffers[0]);
+        free(readers[i].buffers[1]);
+    }
+    free(readers);
+    free(tree);
+    return ok;
+}
+
+/**
+ * Helper function to read the input, sort it in runs and spill the runs
+ * into a temporary file.
+ *
+ * @param context  the sort settings
+ * @param input    the input stream
+ * @param fd       the descriptor of the temporary file
+ * @param runs     output: the runs (allocated; free with free)
+ * @param count    output: the number of runs
+ * @return 0 on success; -1 on a read, write or format error
+ */
+static int formRuns(const SortContext *context, FILE *input, int fd, SortRun **runs, int *count) {
+    size_t element_size = context->element_size;
+    int threads = context->threads;
+
+    // Three run buffers in flight plus the scratch of a radix sort.
+    long run_records = (long)(context->memory / 4 / element_size);
+    if (run_records < threads) run_records = threads;
+    size_t run_bytes = (size_t)run_records * element_size;
+
+    char *buffers[3] = {allocOrExit(run_bytes), allocOrExit(run_bytes), allocOrExit(run_bytes)};
+    int *scratch = context->ints ? allocOrExit(run_bytes) : NULL;
+    IoRequest reads = {input, -1, 0, buffers[0], run_bytes, 0, false};
+    IoRequest writes = {NULL, fd, 0, NULL, 0, 0, true};
+    Job read_job = {0}, write_job = {0}, slice_jobs[EXTERNAL_SORT_MAX_THREADS];
+    SliceTask slices[EXTERNAL_SORT_MAX_THREADS];
+    int capacity = 16;
+    off_t offset = 0;
+    int status = 0;
+
+    *runs = allocOrExit(sizeof(SortRun) * capacity);
+    *count = 0;
+
+    transfer(&reads);
+    for (int i = 0; reads.done > 0; i++) {
+        char *run = buffers[i % 3];
+        size_t bytes = reads.done;
+
+        if (bytes % element_size != 0) {
+            fprintf(stderr, "Error: input size is not a multiple of the element size\n");
+            status = -1;
+            break;
+        }
+
+        // Read the next run while this one is sorted and the last one written.
+        reads = (IoRequest){input, -1, 0, buffers[(i + 1) % 3], run_bytes, 0, false};
+        startJob(&read_job, transfer, &reads);
+
+        long records = (long)(bytes / element_size);
+        int parts = records >= threads ? threads : 1;
+        for (int t = 0; t < parts; t++) {
+            long begin = records * t / parts;
+            long end = records * (t + 1) / parts;
+            slices[t] = (SliceTask){context, run + begin * (long)element_size, end - begin,
+                                    scratch != NULL ? scratch + begin : NULL};
+            if (t > 0) startJob(&slice_jobs[t], sortSlice, &slices[t]);
+        }
+        sortSlice(&slices[0]);
+        for (int t = 1; t < parts; t++) finishJob(&slice_jobs[t]);
+
+        for (int t = 0; t < parts; t++) {
+            if (*count == capacity) {
+                capacity *= 2;
+                SortRun *grown = realloc(*runs, sizeof(SortRun) * capacity);
+                if (grown == NULL) {
+                    fprintf(stderr, "Memory allocation failed\n");
+                    exit(EXIT_FAILURE);
+                }
+                *runs = grown;
+            }
+            (*runs)[*count] = (SortRun){offset + (off_t)((slices[t].base - run)), slices[t].count};
+            (*count)++;
+        }
+
+        finishJob(&write_job);
+        if (writes.done != writes.bytes) status = -1;
+        writes = (IoRequest){NULL, fd, offset, run, bytes, 0, true};
+        offset += (off_t)bytes;
+        startJob(&write_job, transfer, &writes);
+
+        finishJob(&read_job);
+        if (status != 0) break;
+    }
+
+    finishJob(&read_job);
+    finishJob(&write_job);
+    if (writes.done != writes.bytes || ferror(input)) status = -1;
+
+    free(buffers[0]);
+    free(buffers[1]);
+    free(buffers[2]);
+    free(scratch);
+    return status;
+}
+
+/**
+ * Helper function to run a whole external sort with the given settings.
+ *
+ * @param context     the sort settings
+ * @param input_path  path of the input file
+ * @param output_path path of the output file
+ * @return 0 on success; -1 on an I/O or format error
+ */
+static int runExternalSort(SortContext *context, const char *input_path, const char *output_path) {
+    if (context->memory < EXTERNAL_SORT_MIN_MEMORY) context->memory = EXTERNAL_SORT_MIN_MEMORY;
+    if (context->threads <= 0) context->threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (context->threads < 1) context->threads = 1;
+    if (context->threads > EXTERNAL_SORT_MAX_THREADS) context->threads = EXTERNAL_SORT_MAX_THREADS;
+
+    FILE *input = fopen(input_path, "rb");
+    if (input == NULL) {
+        fprintf(stderr, "Error: cannot open %s\n", input_path);
+        return -1;
+    }
+    FILE *spill = tmpfile();
+    if (spill == NULL) {
+        fprintf(stderr, "Error: cannot create a temporary file\n");
+        fclose(input);
+        return -1;
+    }
+
+    SortRun *runs;
+    int count;
+    int status = formRuns(context, input, fileno(spill), &runs, &count);
+    fclose(input);
+
+    // Half the budget feeds the run readers (two blocks each), a quarter the output.
+    size_t element_size = context->element_size;
+    size_t min_block = EXTERNAL_SORT_MIN_BLOCK / element_size * element_size;
+    if (min_block == 0) min_block = element_size;
+    int fan_in = (int)(context->memory / 2 / (2 * min_block));
+    if (fan_in < 2) fan_in = 2;
+    size_t out_block = context->memory / 8 / element_size * element_size;
+    if (out_block < min_block) out_block = min_block;
+
+    // Merge groups of fan_in runs into longer runs until one pass is enough.
+    while (status == 0 && count > fan_in) {
+        FILE *merged = tmpfile();
+        if (merged == NULL) {
+            fprintf(stderr, "Error: cannot create a temporary file\n");
+            status = -1;
+            break;
+        }
+
+        int groups = (count + fan_in - 1) / fan_in;
+        size_t block = context->memory / 2 / (2 * (size_t)fan_in) / element_size * element_size;
+        off_t offset = 0;
+        if (block < min_block) block = min_block;
+
+        for (int g = 0; g < groups && status == 0; g++) {
+            int first = g * fan_in;
+            int k = count - first < fan_in ? count - first : fan_in;
+            long records = 0;
+            RunWriter out;
+
+            for (int i = first; i < first + k; i++) records += runs[i].count;
+            initWriter(&out, NULL, fileno(merged), offset, out_block);
+            if (!mergeRuns(context, fileno(spill), runs + first, k, block, &out)) status = -1;
+            if (!closeWriter(&out)) status = -1;
+
+            runs[g] = (SortRun){offset, records};
+            offset += (off_t)(records * (long)element_size);
+        }
+
+        fclose(spill);
+        spill = merged;
+        count = groups;
+    }
+
+    FILE *output = status == 0 ? fopen(output_path, "wb") : NULL;
+    if (status == 0 && output == NULL) {
+        fprintf(stderr, "Error: cannot open %s\n", output_path);
+        status = -1;
+    }
+    if (status == 0) {
+        RunWriter out;
+        size_t block = context->memory / 2 / (2 * (size_t)(count > 0 ? count : 1)) / element_size * element_size;
+        if (block < min_block) block = min_block;
+
+        initWriter(&out, output, -1, 0, out_block);
+        if (count > 0 && !mergeRuns(context, fileno(spill), runs, count, block, &out)) status = -1;
+        if (!closeWriter(&out)) status = -1;
+        if (fclose(output) != 0) status = -1;
+        if (status != 0) fprintf(stderr, "Error: writing %s failed\n", output_path);
+    }
+
+    fclose(spill);
+    free(runs);
+    return status;
+}
+
+// External sort
+
+/**
+ * Sorts a binary file of fixed-size records into another file, using
+ * about memory_bytes of buffers no matter how large the input is.
+ * Records that compare equal keep their input order only within a run,
+ * so the sort is not stable.
+ *
+ * @param input_path   path of the file to sort
+ * @param output_path  path of the sorted file to write (may not be input_path)
+ * @param element_size size (in bytes) of one record, e.g. a GenericArray's element_size
+ * @param compare      the comparator (qsort contract)
+ * @param memory_bytes memory budget (at least EXTERNAL_SORT_MIN_MEMORY is used)
+ * @param threads      threads used to sort runs (<= 0 for one per online CPU)
+ * @return 0 on success; -1 on an I/O error or a truncated record
+ */
+int externalSort(const char *input_path, const char *output_path, size_t element_size,
+                 SortCompare compare, size_t memory_bytes, int threads) {
+    if (element_size == 0 || element_size > EXTERNAL_SORT_MIN_BLOCK) {
+        fprintf(stderr, "Error: Invalid element size\n");
+        return -1;
+    }
+
+    SortContext context = {element_size, compare, false, memory_bytes, threads};
+    return runExternalSort(&context, input_path, output_path);
+}
+
+/**
+ * Sorts a binary file of native ints into another file with a radix sort
+ * per run, using about memory_bytes of buffers.
+ *
+ * @param input_path   path of the file to sort
+ * @param output_path  path of the sorted file to write (may not be input_path)
+ * @param memory_bytes memory budget (at least EXTERNAL_SORT_MIN_MEMORY is used)
+ * @param threads      threads used to sort runs (<= 0 for one per online CPU)
+ * @return 0 on success; -1 on an I/O error or a truncated record
+ */
+int externalSortInts(const char *input_path, const char *output_path,
+                     size_t memory_bytes, int threads) {
+    SortContext context = {sizeof(int), compareInts, true, memory_bytes, threads};
+    return runExternalSort(&context, input_path, output_path);
+}
@@ -0,0 +1,37 @@
+/**
+ * @file external_sort.h
+ * @brief Public interface of the external-memory merge sort.
+ *
+ * Sorts a binary file of fixed-size records that may be much larger than
+ * RAM, using at most about memory_bytes of buffers. The input is cut into
+ * runs that are sorted in memory by several threads and spilled to a
+ * temporary file, then the runs are merged with a loser tree. Every read
+ * and write is double-buffered on a background thread, so I/O overlaps
+ * with sorting and merging.
+ *
+ * The output of externalSortInts is the sorted int array that
+ * binarySearchIterative expects, stored in native byte order.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#ifndef EXTERNAL_SORT_H
+#define EXTERNAL_SORT_H
+
+#include <stddef.h>
+
+#include "sort.h"
+
+// Smallest I/O block (in bytes) the merge reads from one run at a time.
+#define EXTERNAL_SORT_MIN_BLOCK (64 * 1024)
+
+// Smallest memory budget (in bytes) the sort works with.
+#define EXTERNAL_SORT_MIN_MEMORY (1024 * 1024)
+
+int externalSort(const char *input_path, const char *output_path, size_t element_size,
+                 SortCompare compare, size_t memory_bytes, int threads);
+int externalSortInts(const char *input_path, const char *output_path,
+                     size_t memory_bytes, int threads);
+
+#endif // EXTERNAL_SORT_H
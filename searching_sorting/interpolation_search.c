@@ -0,0 +1,116 @@
+/**
+ * @file interpolation_search.c
+ * @brief Implementation of interpolation search on sorted arrays.
+ * 
+ * Interpolation search probes where the target would sit if the values
+ * were spread evenly between the ends of the range, which takes
+ * O(log log n) probes on near-uniform data such as timestamps or
+ * sequence IDs. The hybrid variant guards against skewed data and
+ * finishes small ranges with a sequential scan.
+ * 
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#include <stdio.h>
+#include <stdbool.h>
+
+#include "interpolation_search.h"
+
+// Helpers
+
+/**
+ * Helper function to estimate the position of a target inside a range
+ * by linear interpolation between the values at its ends.
+ * 
+ * @param arr    the sorted array
+ * @param left   the first index of the range
+ * @param right  the last index of the range (arr[left] < arr[right])
+ * @param target the value to search for (arr[left] <= target <= arr[right])
+ * @return the estimated index, between left and right
+ */
+static inline int interpolate(int arr[], int left, int right, int target) {
+    long long offset = (long long)target - arr[left];
+    long long span = (long long)arr[right] - arr[left];
+    return left + (int)(offset * (right - left) / span);
+}
+
+/**
+ * Performs interpolation search.
+ * Fast on evenly distributed values, but may take O(n) probes on
+ * heavily skewed data; see interpolationSequentialSearch.
+ * 
+ * @param arr    the sorted array to search
+ * @param size   the number of elements in the array
+ * @param target the value to search for
+ * @return the index of the target if found; -1 otherwise
+ */
+int interpolationSearch(int arr[], int size, int target) {
+    int left = 0;
+    int right = size - 1;
+
+    while (left <= right && target >= arr[left] && target <= arr[right]) {
+        if (arr[left] == arr[right]) {
+            return (arr[left] == target) ? left : -1;
+        }
+
+        int middle = interpolate(arr, left, right, target);
+
+        if (arr[middle] == target) {
+            return middle;
+        } else if (arr[middle] < target) {
+            left = middle + 1;
+        } else {
+            right = middle - 1;
+        }
+    }
+    return -1;
+}
+
+/**
+ * Performs interpolation-sequential hybrid search.
+ * Narrows the range with interpolation probes. Every probe that fails to
+ * at least halve the range (skewed data) is followed by a bisection step,
+ * and after INTERPOLATION_MAX_MISSES such failures the search only bisects,
+ * which bounds it to O(log n) probes. Once the range is smaller than
+ * INTERPOLATION_SEQUENTIAL_RANGE it is scanned sequentially.
+ * 
+ * @param arr    the sorted array to search
+ * @param size   the number of elements in the array
+ * @param target the value to search for
+ * @return the index of the target if found; -1 otherwise
+ */
+int interpolationSequentialSearch(int arr[], int size, int target) {
+    int left = 0;
+    int right = size - 1;
+    bool bisect = false;
+    int misses = 0;
+
+    while (right - left >= INTERPOLATION_SEQUENTIAL_RANGE) {
+        if (target < arr[left] || target > arr[right]) return -1;
+        if (arr[left] == arr[right]) break;
+
+        int width = right - left;
+        int middle = bisect ? left + width / 2 : interpolate(arr, left, right, target);
+
+        if (arr[middle] == target) {
+            return middle;
+        } else if (arr[middle] < target) {
+            left = middle + 1;
+        } else {
+            right = middle - 1;
+        }
+
+        if (!bisect && right - left > width / 2) {
+            misses++;
+            bisect = true;
+        } else {
+            bisect = (misses >= INTERPOLATION_MAX_MISSES);
+        }
+    }
+
+    for (int i = left; i <= right && arr[i] <= target; i++) {
+        if (arr[i] == target) return i;
+    }
+    return -1;
+}
@@ -0,0 +1,21 @@
+/**
+ * @file interpolation_search.h
+ * @brief Public interface of interpolation search on sorted int arrays.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#ifndef INTERPOLATION_SEARCH_H
+#define INTERPOLATION_SEARCH_H
+
+// Range size (in elements) below which the hybrid search scans sequentially.
+#define INTERPOLATION_SEQUENTIAL_RANGE 32
+
+// Interpolation probes allowed to miss (not halve the range) before the hybrid search only bisects.
+#define INTERPOLATION_MAX_MISSES 2
+
+int interpolationSearch(int arr[], int size, int target);
+int interpolationSequentialSearch(int arr[], int size, int target);
+
+#endif // INTERPOLATION_SEARCH_H
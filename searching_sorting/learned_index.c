@@ -0,0 +1,262 @@
+/**
+ * @file learned_index.c
+ * @brief Implementation of the PGM-style learned index.
+ *
+ * Each level is built in one pass with the shrinking-cone algorithm: a
+ * segment is anchored at its first key, and every following key narrows
+ * the range of slopes that keep all keys so far within epsilon of their
+ * position. When that range becomes empty the key starts a new segment.
+ * The first keys of one level are then the input of the next.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <math.h>
+
+#include "learned_index.h"
+
+// Helpers
+
+/**
+ * Helper function to append a segment, doubling the segment buffer when full.
+ *
+ * @param index    pointer to the LearnedIndex being built
+ * @param key      first key covered by the segment
+ * @param position position of that key in the level below
+ * @param slope    slope of the segment
+ */
+static void appendSegment(LearnedIndex *index, int key, int position, double slope) {
+    if (index->count == index->capacity) {
+        int capacity = index->capacity > 0 ? index->capacity * 2 : 16;
+        LISegment *segments = realloc(index->segments, sizeof(LISegment) * capacity);
+        if (segments == NULL) {
+            fprintf(stderr, "Memory allocation failed\n");
+            exit(EXIT_FAILURE);
+        }
+        index->segments = segments;
+        index->capacity = capacity;
+    }
+
+    index->segments[index->count].key = key;
+    index->segments[index->count].position = position;
+    index->segments[index->count].slope = slope;
+    index->count++;
+}
+
+/**
+ * Helper function to cover a sorted key array with segments (shrinking cone).
+ * Repeated keys are modelled at their first occurrence only.
+ *
+ * @param index   pointer to the LearnedIndex being built
+ * @param keys    the sorted keys of the level below
+ * @param count   the number of keys
+ * @param epsilon the maximum prediction error
+ */
+static void buildLevel(LearnedIndex *index, const int *keys, int count, int epsilon) {
+    int start = 0;
+    double low = 0.0;
+    double high = INFINITY;
+
+    for (int i = 1; i < count; i++) {
+        if (keys[i] == keys[i - 1]) continue;
+
+        double dx = (double)keys[i] - keys[start];
+        double cone_low = (double)(i - start - epsilon) / dx;
+        double cone_high = (double)(i - start + epsilon) / dx;
+
+        if (cone_low > high || cone_high < low) {
+            appendSegment(index, keys[start], start, isinf(high) ? 0.0 : (low + high) / 2);
+            start = i;
+            low = 0.0;
+            high = INFINITY;
+        } else {
+            if (cone_low > low) low = cone_low;
+            if (cone_high < high) high = cone_high;
+        }
+    }
+    appendSegment(index, keys[start], start, isinf(high) ? 0.0 : (low + high) / 2);
+}
+
+/**
+ * Helper function to predict the position of a key in the level below a segment.
+ * The prediction is clamped to the positions covered by the segment.
+ *
+ * @param segment pointer to the segment covering the key
+ * @param end     position of the first key of the next segment (or the level size)
+ * @param key     the key to locate
+ * @return the predicted position
+ */
+static inline long predict(const LISegment *segment, long end, int key) {
+    double offset = segment->slope * ((double)key - segment->key);
+    return offset < (double)(end - segment->position) ? segment->position + (long)offset : end;
+}
+
+// Core lifecycle
+
+/**
+ * Builds a learned index over a sorted array. The array is not copied,
+ * so it must outlive the index and must not be modified.
+ *
+ * @param index   pointer to the LearnedIndex to build
+ * @param arr     the sorted array to index
+ * @param size    the number of elements in the array
+ * @param epsilon the maximum prediction error of the bottom level
+ *                (LI_DEFAULT_EPSILON is a good default)
+ */
+void liBuild(LearnedIndex *index, int arr[], int size, int epsilon) {
+    int depth_capacity = 8;
+
+    index->data = arr;
+    index->size = size;
+    index->epsilon = epsilon > 0 ? epsilon : 1;
+    index->segments = NULL;
+    index->count = 0;
+    index->capacity = 0;
+    index->depth = 0;
+    index->levels = malloc(sizeof(int) * (depth_capacity + 1));
+    if (index->levels == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    index->levels[0] = 0;
+
+    if (size <= 0) return;
+
+    buildLevel(index, arr, size, index->epsilon);
+    index->depth = 1;
+    index->levels[1] = index->count;
+
+    // Index the first keys of the top level until it is a single segment.
+    while (index->levels[index->depth] - index->levels[index->depth - 1] > 1) {
+        int first = index->levels[index->depth - 1];
+        int count = index->levels[index->depth] - first;
+        int *keys = malloc(sizeof(int) * count);
+
+        if (keys == NULL) {
+            fprintf(stderr, "Memory allocation failed\n");
+            exit(EXIT_FAILURE);
+        }
+        for (int i = 0; i < count; i++) {
+            keys[i] = index->segments[first + i].key;
+        }
+
+        buildLevel(index, keys, count, LI_INTERNAL_EPSILON);
+        free(keys);
+
+        if (index->depth == depth_capacity) {
+            depth_capacity *= 2;
+            int *levels = realloc(index->levels, sizeof(int) * (depth_capacity + 1));
+            if (levels == NULL) {
+                fprintf(stderr, "Memory allocation failed\n");
+                exit(EXIT_FAILURE);
+            }
+            index->levels = levels;
+        }
+        index->depth++;
+        index->levels[index->depth] = index->count;
+    }
+
+    // The model is read-only from now on, so drop the growth slack.
+    LISegment *segments = realloc(index->segments, sizeof(LISegment) * index->count);
+    if (segments != NULL) {
+        index->segments = segments;
+        index->capacity = index->count;
+    }
+}
+
+/**
+ * Frees the memory used by a learned index. The indexed array is untouched.
+ *
+ * @param index pointer to the LearnedIndex to free
+ */
+void liFree(LearnedIndex *index) {
+    free(index->segments);
+    free(index->levels);
+    index->segments = NULL;
+    index->levels = NULL;
+    index->count = 0;
+    index->capacity = 0;
+    index->depth = 0;
+    index->data = NULL;
+    index->size = 0;
+}
+
+// Lookup
+
+/**
+ * Searches a learned index. Every level predicts which segment of the level
+ * below covers the target and finds it among the few segments around the
+ * prediction; the bottom segment predicts the position in the array, which
+ * is finished with a binary search over the 2 * epsilon slots around it.
+ *
+ * @param index  pointer to the LearnedIndex
+ * @param target the value to search for
+ * @return the index of the target in the array if found
+ *         (its first occurrence if duplicated); -1 otherwise
+ */
+int liSearch(LearnedIndex *index, int target) {
+    const LISegment *segments = index->segments;
+
+    if (index->size <= 0 || target < index->data[0]) return -1;
+
+    // The top level is a single segment.
+    int s = index->levels[index->depth - 1];
+
+    for (int l = index->depth - 1; l > 0; l--) {
+        int below = index->levels[l - 1];
+        int below_count = index->levels[l] - below;
+        long end = s + 1 < index->levels[l + 1] ? segments[s + 1].position : below_count - 1;
+        long position = predict(&segments[s], end, target);
+
+        long lo = position - LI_INTERNAL_EPSILON - 2;
+        long hi = position + LI_INTERNAL_EPSILON + 2;
+        if (lo < 0) lo = 0;
+        if (hi > below_count - 1) hi = below_count - 1;
+
+        // Last segment of the window whose first key is <= target.
+        while (lo < hi) {
+            long middle = lo + (hi - lo + 1) / 2;
+            if (segments[below + middle].key <= target) lo = middle;
+            else hi = middle - 1;
+        }
+        s = below + (int)lo;
+    }
+
+    long end = s + 1 < index->levels[1] ? segments[s + 1].position : index->size;
+    long position = predict(&segments[s], end, target);
+
+    long lo = position - index->epsilon - 2;
+    long hi = position + index->epsilon + 2;
+    if (lo < 0) lo = 0;
+    if (hi > index->size) hi = index->size;
+
+    // Branchless lower bound inside the window.
+    const int *base = index->data + lo;
+    long n = hi - lo;
+    while (n > 1) {
+        long half = n / 2;
+        base += (base[half - 1] < target) * half;
+        n -= half;
+    }
+    if (n == 1 && *base < target) base++;
+
+    long found = base - index->data;
+    if (found >= index->size || index->data[found] != target) return -1;
+    return (int)found;
+}
+
+// Utility
+
+/**
+ * Returns the memory used by the model itself, excluding the indexed array.
+ *
+ * @param index pointer to the LearnedIndex
+ * @return the number of bytes allocated for segments and level offsets
+ */
+size_t liMemoryUsage(LearnedIndex *index) {
+    return sizeof(LISegment) * (size_t)index->capacity + sizeof(int) * (size_t)(index->depth + 1);
+}
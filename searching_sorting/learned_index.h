@@ -0,0 +1,59 @@
+/**
+ * @file learned_index.h
+ * @brief Public interface of a PGM-style learned index over sorted int arrays.
+ *
+ * A LearnedIndex (prefix `li`) approximates the mapping from a key to its
+ * position in a sorted array with piecewise linear segments, each of which
+ * predicts the position of every key it covers to within `epsilon` slots.
+ * The segments are indexed recursively by smaller levels of segments until
+ * a single root remains, so a lookup is a few predictions followed by one
+ * bounded binary search in the array itself.
+ *
+ * Unlike the indexes in search_index.h the array is not copied: it must
+ * stay alive and unchanged for as long as the index is used.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#ifndef LEARNED_INDEX_H
+#define LEARNED_INDEX_H
+
+#include <stddef.h>
+
+// Default maximum prediction error (in array slots) of the bottom level.
+#define LI_DEFAULT_EPSILON 64
+
+// Maximum prediction error of the levels that index other segments.
+#define LI_INTERNAL_EPSILON 4
+
+// Structure to represent one linear segment of the model.
+typedef struct {
+    int key;      // first key covered by the segment
+    int position; // position of that key in the level below
+    double slope; // positions advanced per unit of key
+} LISegment;
+
+// Structure to represent a learned index over a sorted array.
+typedef struct {
+    int *data;           // the indexed array (not owned)
+    int size;            // number of elements in the array
+    int epsilon;         // maximum prediction error of the bottom level
+    LISegment *segments; // all levels, bottom level first
+    int count;           // total number of segments
+    int capacity;        // allocated number of segments
+    int *levels;         // levels[l] = first segment of level l; levels[depth] = count
+    int depth;           // number of levels
+} LearnedIndex;
+
+// Core lifecycle
+void liBuild(LearnedIndex *index, int arr[], int size, int epsilon);
+void liFree(LearnedIndex *index);
+
+// Lookup
+int liSearch(LearnedIndex *index, int target);
+
+// Utility
+size_t liMemoryUsage(LearnedIndex *index);
+
+#endif // LEARNED_INDEX_H
@@ -0,0 +1,272 @@
+/**
+ * @file search_index.c
+ * @brief Implementation of the Eytzinger and S-tree static search indexes.
+ * 
+ * Both indexes are built once from a sorted int array by an in-order
+ * traversal of their implicit tree, which places the sorted values in the
+ * new layout, and remember where every value came from so lookups can
+ * return original array indexes.
+ * 
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+
+#include "search_index.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define PREFETCH(addr) __builtin_prefetch(addr)
+#else
+#define PREFETCH(addr) ((void)(addr))
+#endif
+
+// Helpers
+
+/**
+ * Helper function to allocate a cache-line aligned block of ints.
+ * 
+ * @param count number of ints to allocate
+ * @return a pointer to the block; exits if memory allocation fails
+ */
+static int *allocAligned(long count) {
+    size_t bytes = ((size_t)count * sizeof(int) + 63) / 64 * 64;
+    int *block = aligned_alloc(64, bytes > 0 ? bytes : 64);
+
+    if (block == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    return block;
+}
+
+/**
+ * Helper function to count the trailing one bits of a value.
+ * 
+ * @param k the value to inspect
+ * @return the number of consecutive 1 bits starting at bit 0
+ */
+static inline int trailingOnes(unsigned long k) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzl(~k);
+#else
+    int count = 0;
+    while (k & 1) {
+        k >>= 1;
+        count++;
+    }
+    return count;
+#endif
+}
+
+/**
+ * Helper function to count the keys of one S-tree node that are smaller than a target.
+ * Since the keys of a node are sorted, this is also the index of the first key >= target.
+ * 
+ * @param block  pointer to the STI_BLOCK_KEYS keys of the node (64-byte aligned)
+ * @param target the value to compare against
+ * @return the number of keys smaller than target
+ */
+static inline int blockRank(const int *block, int target) {
+#if defined(__SSE2__)
+    __m128i x = _mm_set1_epi32(target);
+    int mask = 0;
+
+    for (int j = 0; j < STI_BLOCK_KEYS / 4; j++) {
+        __m128i keys = _mm_load_si128((const __m128i *)(block + 4 * j));
+        __m128i less = _mm_cmpgt_epi32(x, keys);
+        mask |= _mm_movemask_ps(_mm_castsi128_ps(less)) << (4 * j);
+    }
+    return __builtin_popcount(mask);
+#else
+    int count = 0;
+    for (int j = 0; j < STI_BLOCK_KEYS; j++) {
+        count += (block[j] < target);
+    }
+    return count;
+#endif
+}
+
+/**
+ * Helper function to fill the Eytzinger layout by an in-order traversal.
+ * 
+ * @param index pointer to the EytzingerIndex being built
+ * @param arr   the sorted source array
+ * @param i     the next source index to place
+ * @param k     the BFS slot of the current subtree root
+ * @return the next source index to place after this subtree
+ */
+static int eytzingerFill(EytzingerIndex *index, int arr[], int i, long k) {
+    if (k <= index->size) {
+        i = eytzingerFill(index, arr, i, 2 * k);
+        index->keys[k] = arr[i];
+        index->positions[k] = i;
+        i = eytzingerFill(index, arr, i + 1, 2 * k + 1);
+    }
+    return i;
+}
+
+/**
+ * Helper function to compute the index of the i-th child of an S-tree node.
+ * 
+ * @param k the node
+ * @param i which child (0 to STI_BLOCK_KEYS)
+ * @return the index of the child node
+ */
+static inline long stiChild(long k, int i) {
+    return k * (STI_BLOCK_KEYS + 1) + i + 1;
+}
+
+/**
+ * Helper function to fill the S-tree layout by an in-order traversal.
+ * Slots left over after the last source value are padded with INT_MAX.
+ * 
+ * @param index pointer to the STreeIndex being built
+ * @param arr   the sorted source array
+ * @param t     the next source index to place
+ * @param k     the current node
+ * @return the next source index to place after this subtree
+ */
+static int stiFill(STreeIndex *index, int arr[], int t, long k) {
+    if (k < index->blocks) {
+        for (int i = 0; i < STI_BLOCK_KEYS; i++) {
+            t = stiFill(index, arr, t, stiChild(k, i));
+
+            long slot = k * STI_BLOCK_KEYS + i;
+            if (t < index->size) {
+                index->keys[slot] = arr[t];
+                index->positions[slot] = t;
+                t++;
+            } else {
+                index->keys[slot] = INT_MAX;
+                index->positions[slot] = -1;
+            }
+        }
+        t = stiFill(index, arr, t, stiChild(k, STI_BLOCK_KEYS));
+    }
+    return t;
+}
+
+// Eytzinger layout
+
+/**
+ * Builds an Eytzinger index over a sorted array. The array is copied,
+ * so it may be modified or freed afterwards.
+ * 
+ * @param index pointer to the EytzingerIndex to build
+ * @param arr   the sorted array to index
+ * @param size  the number of elements in the array
+ */
+void eiBuild(EytzingerIndex *index, int arr[], int size) {
+    index->size = size;
+    index->keys = allocAligned((long)size + 1);
+    index->positions = allocAligned((long)size + 1);
+
+    eytzingerFill(index, arr, 0, 1);
+}
+
+/**
+ * Frees the memory used by an Eytzinger index.
+ * 
+ * @param index pointer to the EytzingerIndex to free
+ */
+void eiFree(EytzingerIndex *index) {
+    free(index->keys);
+    free(index->positions);
+    index->keys = NULL;
+    index->positions = NULL;
+    index->size = 0;
+}
+
+/**
+ * Searches an Eytzinger index. Descends the implicit tree branchlessly
+ * while prefetching the node four levels below (clamped to the last
+ * slot), then recovers the lower-bound slot from the path taken.
+ * 
+ * @param index  pointer to the EytzingerIndex
+ * @param target the value to search for
+ * @return the index of the target in the original array if found
+ *         (its first occurrence if duplicated); -1 otherwise
+ */
+int eiSearch(EytzingerIndex *index, int target) {
+    const int *keys = index->keys;
+    long n = index->size;
+    unsigned long k = 1;
+
+    while (k <= (unsigned long)n) {
+        // Clamp to the last slot: the last four levels have no node four
+        // levels below inside keys (a select, so no branch is added).
+        unsigned long ahead = 16 * k;
+        PREFETCH(keys + (ahead <= (unsigned long)n ? ahead : (unsigned long)n));
+        k = 2 * k + (keys[k] < target);
+    }
+
+    // Undo the right turns taken after the last left turn, and that left turn.
+    k >>= trailingOnes(k) + 1;
+
+    if (k == 0 || keys[k] != target) return -1;
+    return index->positions[k];
+}
+
+// S-tree layout
+
+/**
+ * Builds an S-tree index over a sorted array. The array is copied,
+ * so it may be modified or freed afterwards.
+ * 
+ * @param index pointer to the STreeIndex to build
+ * @param arr   the sorted array to index
+ * @param size  the number of elements in the array
+ */
+void stiBuild(STreeIndex *index, int arr[], int size) {
+    index->size = size;
+    index->blocks = (size + STI_BLOCK_KEYS - 1) / STI_BLOCK_KEYS;
+    index->keys = allocAligned((long)index->blocks * STI_BLOCK_KEYS);
+    index->positions = allocAligned((long)index->blocks * STI_BLOCK_KEYS);
+
+    stiFill(index, arr, 0, 0);
+}
+
+/**
+ * Frees the memory used by an S-tree index.
+ * 
+ * @param index pointer to the STreeIndex to free
+ */
+void stiFree(STreeIndex *index) {
+    free(index->keys);
+    free(index->positions);
+    index->keys = NULL;
+    index->positions = NULL;
+    index->blocks = 0;
+    index->size = 0;
+}
+
+/**
+ * Searches an S-tree index. Each level compares the target against a whole
+ * node at once and remembers the first key >= target seen so far, which
+ * at the bottom is the global lower bound.
+ * 
+ * @param index  pointer to the STreeIndex
+ * @param target the value to search for
+ * @return the index of the target in the original array if found
+ *         (its first occurrence if duplicated); -1 otherwise
+ */
+int stiSearch(STreeIndex *index, int target) {
+    long k = 0;
+    long best = -1;
+
+    while (k < index->blocks) {
+        int i = blockRank(index->keys + k * STI_BLOCK_KEYS, target);
+        if (i < STI_BLOCK_KEYS) best = k * STI_BLOCK_KEYS + i;
+        k = stiChild(k, i);
+    }
+
+    if (best < 0 || index->keys[best] != target) return -1;
+    return index->positions[best];
+}
@@ -0,0 +1,51 @@
+/**
+ * @file search_index.h
+ * @brief Public interface of build-once static search indexes over sorted int arrays.
+ *
+ * Both indexes copy a sorted array into a cache-friendlier layout and answer
+ * lookups with the position of the value in the original array, so they are
+ * drop-in replacements for binarySearchIterative on read-only data:
+ *
+ * - EytzingerIndex (prefix `ei`) stores the values in BFS order of the
+ *   implicit binary search tree, so the next four levels of a lookup share
+ *   one cache line and can be prefetched.
+ * - STreeIndex (prefix `sti`) stores them as a static B-tree whose nodes
+ *   are STI_BLOCK_KEYS keys filling one 64-byte cache line, so every level
+ *   costs a single cache miss.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#ifndef SEARCH_INDEX_H
+#define SEARCH_INDEX_H
+
+// Number of keys in one S-tree node (one 64-byte cache line of ints).
+#define STI_BLOCK_KEYS 16
+
+// Structure to represent an Eytzinger (BFS) layout of a sorted array.
+typedef struct {
+    int *keys;      // keys[1..size] in BFS order; keys[0] is unused
+    int *positions; // positions[k] = index in the original array of keys[k]
+    int size;       // number of keys in the index
+} EytzingerIndex;
+
+// Structure to represent a static B-tree (S-tree) layout of a sorted array.
+typedef struct {
+    int *keys;      // blocks * STI_BLOCK_KEYS keys, one node per block
+    int *positions; // original index of every key slot (-1 for padding)
+    int blocks;     // number of nodes in the tree
+    int size;       // number of keys in the index
+} STreeIndex;
+
+// Eytzinger layout
+void eiBuild(EytzingerIndex *index, int arr[], int size);
+void eiFree(EytzingerIndex *index);
+int eiSearch(EytzingerIndex *index, int target);
+
+// S-tree layout
+void stiBuild(STreeIndex *index, int arr[], int size);
+void stiFree(STreeIndex *index);
+int stiSearch(STreeIndex *index, int target);
+
+#endif // SEARCH_INDEX_H
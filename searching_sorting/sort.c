@@ -0,0 +1,604 @@
+/**
+ * @file sort.c
+ * @brief Implementation of introsort, LSD radix sort and parallel sample sort.
+ * 
+ * introSort is quicksort with median-of-three pivots that switches to
+ * heapsort when the recursion gets too deep (so it is O(n log n) on any
+ * input) and to insertion sort on short ranges. genericSort is the same
+ * algorithm on elements of any size behind a comparator. radixSort sorts
+ * ints in four byte-wide counting passes through a scratch buffer.
+ * parallelSort is a sample sort: threads bucket their chunk of the array
+ * by sampled splitters, scatter it into per-bucket ranges, then radix sort
+ * one bucket each.
+ * 
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "sort.h"
+
+// Upper bound on the threads parallelSort starts.
+#define SORT_MAX_THREADS 256
+
+// Samples drawn per bucket to pick the parallelSort splitters.
+#define SORT_OVERSAMPLING 64
+
+// Structure to represent the share of one thread in a parallelSort.
+typedef struct {
+    int *arr;              // the array being sorted
+    int *scratch;          // scratch buffer the size of arr
+    const int *splitters;  // buckets - 1 sorted splitters
+    int buckets;           // number of buckets (one per thread)
+    long begin;            // first index of this thread's chunk of arr
+    long end;              // one past the last index of the chunk
+    long *counts;          // per-bucket element counts of the chunk, then its write offsets
+    long bucket_begin;     // first index of the bucket this thread sorts
+    long bucket_end;       // one past the last index of that bucket
+} SortTask;
+
+// Helpers
+
+/**
+ * Helper function to compute 2 * floor(log2(n)), the introsort depth limit.
+ * 
+ * @param n the number of elements (at least 1)
+ * @return the recursion depth after which introsort falls back to heapsort
+ */
+static int depthLimit(long n) {
+    int depth = 0;
+    while (n > 1) {
+        n >>= 1;
+        depth++;
+    }
+    return 2 * depth;
+}
+
+/**
+ * Helper function to insertion sort a short range of ints.
+ * 
+ * @param a the first element
+ * @param n the number of elements
+ */
+static void insertionSortInts(int *a, long n) {
+    for (long i = 1; i < n; i++) {
+        int key = a[i];
+        long j = i - 1;
+        while (j >= 0 && a[j] > key) {
+            a[j + 1] = a[j];
+            j--;
+        }
+        a[j + 1] = key;
+    }
+}
+
+/**
+ * Helper function to heapsort a range of ints.
+ * 
+ * @param a the first element
+ * @param n the number of elements
+ */
+static void heapSortInts(int *a, long n) {
+    for (long end = n, start = n / 2; end > 1;) {
+        long root;
+        if (start > 0) {
+            root = --start;
+        } else {
+            end--;
+            int top = a[0];
+            a[0] = a[end];
+            a[end] = top;
+            root = 0;
+        }
+
+        // Sift a[root] down within a[0..end).
+        int value = a[root];
+        for (long child = 2 * root + 1; child < end; child = 2 * root + 1) {
+            if (child + 1 < end && a[child + 1] > a[child]) child++;
+            if (a[child] <= value) break;
+            a[root] = a[child];
+            root = child;
+        }
+        a[root] = value;
+    }
+}
+
+/**
+ * Helper function to introsort a range of ints. Recurses into the smaller
+ * partition and loops on the larger one, so the stack stays O(log n).
+ * 
+ * @param a     the first element
+ * @param n     the number of elements
+ * @param depth partitioning levels left before falling back to heapsort
+ */
+static void introSortInts(int *a, long n, int depth) {
+    while (n > SORT_INSERTION_THRESHOLD) {
+        if (depth-- == 0) {
+            heapSortInts(a, n);
+            return;
+        }
+
+        // Median of three: order a[0], a[mid], a[n - 1] and use a[mid] as
+        // the pivot, so both ends act as sentinels for the partition scans.
+        long mid = (n - 1) / 2;
+        int t;
+        if (a[mid] < a[0]) { t = a[mid]; a[mid] = a[0]; a[0] = t; }
+        if (a[n - 1] < a[mid]) {
+            t = a[n - 1]; a[n - 1] = a[mid]; a[mid] = t;
+            if (a[mid] < a[0]) { t = a[mid]; a[mid] = a[0]; a[0] = t; }
+        }
+        int pivot = a[mid];
+
+        // Hoare partition: a[0..j] <= pivot <= a[j + 1..n).
+        long i = -1;
+        long j = n;
+        for (;;) {
+            do i++; while (a[i] < pivot);
+            do j--; while (a[j] > pivot);
+            if (i >= j) break;
+            t = a[i]; a[i] = a[j]; a[j] = t;
+        }
+
+        long left = j + 1;
+        if (left < n - left) {
+            introSortInts(a, left, depth);
+            a += left;
+            n -= left;
+        } else {
+            introSortInts(a + left, n - left, depth);
+            n = left;
+        }
+    }
+    insertionSortInts(a, n);
+}
+
+/**
+ * Helper function to LSD radix sort ints: one counting pass builds the
+ * histograms of all four bytes, then each byte is a stable scatter between
+ * the two buffers. Passes where every element has the same byte are skipped.
+ * 
+ * @param a       the elements to sort
+ * @param scratch a buffer of n ints
+ * @param n       the number of elements (at least 1)
+ * @return a or scratch, whichever holds the sorted elements
+ */
+static int *radixSortInts(int *a, int *scratch, long n) {
+    long counts[4][256] = {{0}};
+
+    // Flipping the sign bit makes unsigned byte order match signed order.
+    for (long i = 0; i < n; i++) {
+        uint32_t key = (uint32_t)a[i] ^ 0x80000000u;
+        counts[0][key & 0xFF]++;
+        counts[1][(key >> 8) & 0xFF]++;
+        counts[2][(key >> 16) & 0xFF]++;
+        counts[3][key >> 24]++;
+    }
+
+    int *src = a;
+    int *dst = scratch;
+    for (int pass = 0; pass < 4; pass++) {
+        int shift = 8 * pass;
+        uint32_t first = (((uint32_t)src[0] ^ 0x80000000u) >> shift) & 0xFF;
+        if (counts[pass][first] == n) continue;
+
+        long offset = 0;
+        for (int d = 0; d < 256; d++) {
+            long count = counts[pass][d];
+            counts[pass][d] = offset;
+            offset += count;
+        }
+        for (long i = 0; i < n; i++) {
+            uint32_t digit = (((uint32_t)src[i] ^ 0x80000000u) >> shift) & 0xFF;
+            dst[counts[pass][digit]++] = src[i];
+        }
+
+        int *swap = src;
+        src = dst;
+        dst = swap;
+    }
+    return src;
+}
+
+/**
+ * Helper function to swap two elements of any size.
+ * 
+ * @param a            pointer to the first element
+ * @param b            pointer to the second element
+ * @param element_size the size (in bytes) of an element
+ */
+static void swapElements(char *a, char *b, size_t element_size) {
+    char chunk[64];
+
+    while (element_size > 0) {
+        size_t bytes = element_size < sizeof(chunk) ? element_size : sizeof(chunk);
+        memcpy(chunk, a, bytes);
+        memcpy(a, b, bytes);
+        memcpy(b, chunk, bytes);
+        a += bytes;
+        b += bytes;
+        element_size -= bytes;
+    }
+}
+
+/**
+ * Helper function to heapsort a range of elements of any size.
+ * 
+ * @param a            the first element
+ * @param n            the number of elements
+ * @param element_size the size (in bytes) of an element
+ * @param compare      the comparator
+ */
+static void heapSortGeneric(char *a, long n, size_t element_size, SortCompare compare) {
+    for (long end = n, start = n / 2; end > 1;) {
+        long root;
+        if (start > 0) {
+            root = --start;
+        } else {
+            end--;
+            swapElements(a, a + end * element_size, element_size);
+            root = 0;
+        }
+
+        for (long child = 2 * root + 1; child < end; child = 2 * root + 1) {
+            if (child + 1 < end &&
+                compare(a + (child + 1) * element_size, a + child * element_size) > 0) child++;
+            if (compare(a + child * element_size, a + root * element_size) <= 0) break;
+            swapElements(a + root * element_size, a + child * element_size, element_size);
+            root = child;
+        }
+    }
+}
+
+/**
+ * Helper function to introsort a range of elements of any size.
+ * Same algorithm as introSortInts; the pivot is copied out because the
+ * partition swaps move the element it came from.
+ * 
+ * @param a            the first element
+ * @param n            the number of elements
+ * @param element_size the size (in bytes) of an element
+ * @param compare      the comparator
+ * @param depth        partitioning levels left before falling back to heapsort
+ * @param pivot        scratch space for one element
+ */
+static void introSortGeneric(char *a, long n, size_t element_size, SortCompare compare,
+                             int depth, char *pivot) {
+    while (n > SORT_INSERTION_THRESHOLD) {
+        if (depth-- == 0) {
+            heapSortGeneric(a, n, element_size, compare);
+            return;
+        }
+
+        char *first = a;
+        char *middle = a + (n - 1) / 2 * element_size;
+        char *last = a + (n - 1) * element_size;
+        if (compare(middle, first) < 0) swapElements(middle, first, element_size);
+        if (compare(last, middle) < 0) {
+            swapElements(last, middle, element_size);
+            if (compare(middle, first) < 0) swapElements(middle, first, element_size);
+        }
+        memcpy(pivot, middle, element_size);
+
+        long i = -1;
+        long j = n;
+        for (;;) {
+            do i++; while (compare(a + i * element_size, pivot) < 0);
+            do j--; while (compare(a + j * element_size, pivot) > 0);
+            if (i >= j) break;
+            swapElements(a + i * element_size, a + j * element_size, element_size);
+        }
+
+        long left = j + 1;
+        if (left < n - left) {
+            introSortGeneric(a, left, element_size, compare, depth, pivot);
+            a += left * element_size;
+            n -= left;
+        } else {
+            introSortGeneric(a + left * element_size, n - left, element_size, compare, depth, pivot);
+            n = left;
+        }
+    }
+
+    // Insertion sort by adjacent swaps (elements may be too large to buffer).
+    for (long i = 1; i < n; i++) {
+        for (long j = i; j > 0 && compare(a + (j - 1) * element_size, a + j * element_size) > 0; j--) {
+            swapElements(a + (j - 1) * element_size, a + j * element_size, element_size);
+        }
+    }
+}
+
+/**
+ * Helper function to find the bucket of a value in a parallelSort.
+ * 
+ * @param splitters the buckets - 1 sorted splitters
+ * @param buckets   the number of buckets
+ * @param value     the value to place
+ * @return the number of splitters <= value
+ */
+static inline int bucketOf(const int *splitters, int buckets, int value) {
+    const int *base = splitters;
+    int n = buckets - 1;
+
+    while (n > 0) {
+        int half = n / 2;
+        if (base[half] <= value) {
+            base += half + 1;
+            n -= half + 1;
+        } else {
+            n = half;
+        }
+    }
+    return (int)(base - splitters);
+}
+
+/**
+ * Helper function to count the elements of a thread's chunk per bucket.
+ * 
+ * @param arg pointer to the SortTask
+ * @return NULL
+ */
+static void *countChunk(void *arg) {
+    SortTask *task = arg;
+
+    for (int b = 0; b < task->buckets; b++) task->counts[b] = 0;
+    for (long i = task->begin; i < task->end; i++) {
+        task->counts[bucketOf(task->splitters, task->buckets, task->arr[i])]++;
+    }
+    return NULL;
+}
+
+/**
+ * Helper function to scatter a thread's chunk into the scratch buffer.
+ * 
+ * @param arg pointer to the SortTask, whose counts now hold write offsets
+ * @return NULL
+ */
+static void *scatterChunk(void *arg) {
+    SortTask *task = arg;
+
+    for (long i = task->begin; i < task->end; i++) {
+        int value = task->arr[i];
+        task->scratch[task->counts[bucketOf(task->splitters, task->buckets, value)]++] = value;
+    }
+    return NULL;
+}
+
+/**
+ * Helper function to sort a thread's bucket and copy it back into the array.
+ * 
+ * @param arg pointer to the SortTask
+ * @return NULL
+ */
+static void *sortBucket(void *arg) {
+    SortTask *task = arg;
+    long n = task->bucket_end - task->bucket_begin;
+
+    if (n == 0) return NULL;
+
+    // The bucket's range of arr is free at this point, so it is the radix scratch.
+    int *bucket = task->scratch + task->bucket_begin;
+    int *sorted = radixSortInts(bucket, task->arr + task->bucket_begin, n);
+    if (sorted == bucket) memcpy(task->arr + task->bucket_begin, bucket, sizeof(int) * n);
+    return NULL;
+}
+
+/**
+ * Helper function to run one phase of a parallelSort on every task and wait
+ * for all of them. A task whose thread cannot be created runs on the caller.
+ * 
+ * @param tasks   the tasks
+ * @param threads the number of tasks
+ * @param phase   the phase function
+ */
+static void runPhase(SortTask *tasks, int threads, void *(*phase)(void *)) {
+    pthread_t ids[SORT_MAX_THREADS];
+    bool started[SORT_MAX_THREADS];
+
+    for (int t = 1; t < threads; t++) {
+        started[t] = pthread_create(&ids[t], NULL, phase, &tasks[t]) == 0;
+        if (!started[t]) phase(&tasks[t]);
+    }
+    phase(&tasks[0]);
+    for (int t = 1; t < threads; t++) {
+        if (started[t]) pthread_join(ids[t], NULL);
+    }
+}
+
+// Raw arrays
+
+/**
+ * Sorts an int array in place with introsort. Worst case O(n log n),
+ * O(log n) stack, not stable.
+ * 
+ * @param arr  the array to sort
+ * @param size the number of elements in the array
+ */
+void introSort(int arr[], int size) {
+    if (size > 1) introSortInts(arr, size, depthLimit(size));
+}
+
+/**
+ * Sorts an int array with an LSD radix sort. O(n) time, stable.
+ * 
+ * @param arr  the array to sort
+ * @param size the number of elements in the array
+ */
+void radixSort(int arr[], int size) {
+    if (size < 2) return;
+
+    int *scratch = malloc(sizeof(int) * (size_t)size);
+    if (scratch == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+
+    radixSortScratch(arr, scratch, size);
+    free(scratch);
+}
+
+/**
+ * Sorts an int array with an LSD radix sort through a caller-provided
+ * scratch buffer, so repeated sorts can reuse one buffer.
+ * 
+ * @param arr     the array to sort
+ * @param scratch a buffer of at least size ints (contents are overwritten)
+ * @param size    the number of elements in the array
+ */
+void radixSortScratch(int arr[], int scratch[], int size) {
+    if (size < 2) return;
+
+    int *sorted = radixSortInts(arr, scratch, size);
+    if (sorted != arr) memcpy(arr, sorted, sizeof(int) * (size_t)size);
+}
+
+/**
+ * Sorts an int array with a multithreaded sample sort. Splitters drawn
+ * from a sample of the array cut it into one bucket per thread; every
+ * thread counts and scatters its chunk of the array into the buckets,
+ * then radix sorts one bucket. Uses a scratch buffer the size of the array.
+ * Small arrays are introsorted, and a single thread radix sorts the whole
+ * array, on the calling thread.
+ * 
+ * @param arr     the array to sort
+ * @param size    the number of elements in the array
+ * @param threads the number of threads to use (<= 0 for one per online CPU)
+ */
+void parallelSort(int arr[], int size, int threads) {
+    if (threads <= 0) threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (threads < 1) threads = 1; // sysconf returns -1 if the count is unknown
+    if (threads > SORT_MAX_THREADS) threads = SORT_MAX_THREADS;
+    if (size < SORT_PARALLEL_MIN_SIZE) {
+        introSort(arr, size);
+        return;
+    }
+    if (threads == 1) {
+        radixSort(arr, size);
+        return;
+    }
+
+    int samples_count = threads * SORT_OVERSAMPLING;
+    int *samples = malloc(sizeof(int) * samples_count);
+    int *splitters = malloc(sizeof(int) * (threads - 1));
+    int *scratch = malloc(sizeof(int) * (size_t)size);
+    long *counts = malloc(sizeof(long) * threads * threads);
+    SortTask *tasks = malloc(sizeof(SortTask) * threads);
+
+    if (samples == NULL || splitters == NULL || scratch == NULL || counts == NULL || tasks == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // Draw a deterministic sample and take evenly spaced splitters from it.
+    uint64_t state = 0x9E3779B97F4A7C15ull;
+    for (int s = 0; s < samples_count; s++) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        samples[s] = arr[state % (uint64_t)size];
+    }
+    introSort(samples, samples_count);
+    for (int b = 1; b < threads; b++) {
+        splitters[b - 1] = samples[b * SORT_OVERSAMPLING];
+    }
+
+    for (int t = 0; t < threads; t++) {
+        tasks[t].arr = arr;
+        tasks[t].scratch = scratch;
+        tasks[t].splitters = splitters;
+        tasks[t].buckets = threads;
+        tasks[t].begin = (long)size * t / threads;
+        tasks[t].end = (long)size * (t + 1) / threads;
+        tasks[t].counts = counts + (long)t * threads;
+    }
+    runPhase(tasks, threads, countChunk);
+
+    // Bucket b starts after all smaller buckets; within it, chunks are laid
+    // out in thread order. Turn every count into its write offset.
+    long offset = 0;
+    for (int b = 0; b < threads; b++) {
+        tasks[b].bucket_begin = offset;
+        for (int t = 0; t < threads; t++) {
+            long count = tasks[t].counts[b];
+            tasks[t].counts[b] = offset;
+            offset += count;
+        }
+        tasks[b].bucket_end = offset;
+    }
+    runPhase(tasks, threads, scatterChunk);
+    runPhase(tasks, threads, sortBucket);
+
+    free(samples);
+    free(splitters);
+    free(scratch);
+    free(counts);
+    free(tasks);
+}
+
+/**
+ * Sorts an array of elements of any size in place with introsort.
+ * 
+ * @param base         pointer to the first element
+ * @param count        the number of elements
+ * @param element_size the size (in bytes) of an element
+ * @param compare      the comparator (qsort contract)
+ */
+void genericSort(void *base, int count, size_t element_size, SortCompare compare) {
+    if (count < 2 || element_size == 0) return;
+
+    char *pivot = malloc(element_size);
+    if (pivot == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+
+    introSortGeneric(base, count, element_size, compare, depthLimit(count), pivot);
+    free(pivot);
+}
+
+// Containers
+
+/**
+ * Sorts the elements of a dynamic array in place with introsort.
+ * 
+ * @param arr pointer to the DynamicArray
+ */
+void daSort(DynamicArray *arr) {
+    introSort(arr->data, arr->size);
+}
+
+/**
+ * Sorts the elements of a dynamic array with an LSD radix sort.
+ * 
+ * @param arr pointer to the DynamicArray
+ */
+void daRadixSort(DynamicArray *arr) {
+    radixSort(arr->data, arr->size);
+}
+
+/**
+ * Sorts the elements of a dynamic array with the parallel sample sort.
+ * 
+ * @param arr     pointer to the DynamicArray
+ * @param threads the number of threads to use (<= 0 for one per online CPU)
+ */
+void daParallelSort(DynamicArray *arr, int threads) {
+    parallelSort(arr->data, arr->size, threads);
+}
+
+/**
+ * Sorts the elements of a generic array in place with introsort,
+ * moving whole elements of arr->element_size bytes.
+ * 
+ * @param arr     pointer to the GenericArray
+ * @param compare the comparator (qsort contract)
+ */
+void gaSort(GenericArray *arr, SortCompare compare) {
+    genericSort(arr->data, arr->size, arr->element_size, compare);
+}
@@ -0,0 +1,43 @@
+/**
+ * @file sort.h
+ * @brief Public interface of the sorting algorithms.
+ *
+ * The int sorts work on plain arrays (like binary_search.h) and have
+ * DynamicArray wrappers; gaSort sorts a GenericArray of any element size
+ * with a qsort-style comparator. All sorts are ascending.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#ifndef SORT_H
+#define SORT_H
+
+#include <stddef.h>
+
+#include "arrays/dynamic_array.h"
+#include "arrays/generic_array.h"
+
+// Ranges at most this long are finished with insertion sort.
+#define SORT_INSERTION_THRESHOLD 16
+
+// Arrays shorter than this are sorted by parallelSort on the calling thread.
+#define SORT_PARALLEL_MIN_SIZE (1 << 16)
+
+// Comparator with the qsort contract: negative, zero or positive.
+typedef int (*SortCompare)(const void *a, const void *b);
+
+// Raw arrays
+void introSort(int arr[], int size);
+void radixSort(int arr[], int size);
+void radixSortScratch(int arr[], int scratch[], int size);
+void parallelSort(int arr[], int size, int threads);
+void genericSort(void *base, int count, size_t element_size, SortCompare compare);
+
+// Containers
+void daSort(DynamicArray *arr);
+void daRadixSort(DynamicArray *arr);
+void daParallelSort(DynamicArray *arr, int threads);
+void gaSort(GenericArray *arr, SortCompare compare);
+
+#endif // SORT_H
@@ -0,0 +1,261 @@
+/**
+ * @file hazard_pointer.c
+ * @brief Implementation of hazard pointers (Michael, 2004).
+ *
+ * Hazard records live in one global lock-free list that only grows; a
+ * record is claimed by flipping its active flag, so a record released by
+ * an exiting thread is reused by the next new thread. Each record keeps
+ * its own list of retired nodes. Once that list reaches the scan
+ * threshold (HP_SCAN_THRESHOLD, or twice the number of hazard slots if
+ * that is larger) the owner snapshots every published hazard pointer,
+ * sorts them, and frees each retired node that is not among them, so the
+ * cost of reclamation is amortized to O(log H) per node.
+ *
+ * Atomics use the default sequentially consistent ordering, which the
+ * publish-then-validate step of hpSet relies on; only hpClear uses a
+ * release store.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#include "hazard_pointer.h"
+
+// Structure to represent a node waiting to be freed.
+typedef struct {
+    void *pointer;              // the retired node
+    void (*reclaim)(void *);    // function that frees it
+} RetiredNode;
+
+// Structure to represent the hazard pointers and retired nodes of one thread.
+struct HazardRecord {
+    _Atomic(void *) hazards[HP_SLOTS_PER_THREAD]; // published pointers (NULL if unused)
+    atomic_bool active;                           // owned by a live thread
+    struct HazardRecord *next;                    // next record in the global list (never changes)
+    RetiredNode *retired;                         // retired nodes not freed yet (owner only)
+    int retired_count;                            // number of retired nodes
+    int retired_capacity;                         // capacity of retired
+};
+
+static _Atomic(HazardRecord *) records = NULL; // every record ever created
+static atomic_int record_count = 0;            // number of records in records
+
+static _Thread_local HazardRecord *thread_record = NULL;
+static pthread_key_t release_key;
+static pthread_once_t release_once = PTHREAD_ONCE_INIT;
+
+// Helpers
+
+/**
+ * Helper function to compare two pointers for qsort and bsearch.
+ *
+ * @param a pointer to the first pointer
+ * @param b pointer to the second pointer
+ * @return negative, zero or positive as *a is below, equal to or above *b
+ */
+static int comparePointers(const void *a, const void *b) {
+    uintptr_t x = (uintptr_t)*(void *const *)a;
+    uintptr_t y = (uintptr_t)*(void *const *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * Helper function to free every retired node of a record that no hazard
+ * pointer protects. Must be called by the record's owner.
+ *
+ * @param record the record whose retired nodes are scanned
+ */
+static void scan(HazardRecord *record) {
+    int capacity = (atomic_load(&record_count) + 1) * HP_SLOTS_PER_THREAD;
+    int count = 0;
+    void **hazards = malloc(sizeof(void *) * (size_t)capacity);
+    if (hazards == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+
+    for (HazardRecord *curr = atomic_load(&records); curr != NULL; curr = curr->next) {
+        // Records may be added while we walk the list; grow instead of dropping any.
+        if (count + HP_SLOTS_PER_THREAD > capacity) {
+            capacity *= 2;
+            void **grown = realloc(hazards, sizeof(void *) * (size_t)capacity);
+            if (grown == NULL) {
+                fprintf(stderr, "Memory allocation failed\n");
+                exit(EXIT_FAILURE);
+            }
+            hazards = grown;
+        }
+        for (int slot = 0; slot < HP_SLOTS_PER_THREAD; slot++) {
+            void *pointer = atomic_load(&curr->hazards[slot]);
+            if (pointer != NULL) hazards[count++] = pointer;
+        }
+    }
+    qsort(hazards, (size_t)count, sizeof(void *), comparePointers);
+
+    int kept = 0;
+    for (int i = 0; i < record->retired_count; i++) {
+        RetiredNode node = record->retired[i];
+        if (bsearch(&node.pointer, hazards, (size_t)count, sizeof(void *), comparePointers) != NULL) {
+            record->retired[kept++] = node;
+        } else {
+            node.reclaim(node.pointer);
+        }
+    }
+    record->retired_count = kept;
+
+    free(hazards);
+}
+
+/**
+ * Helper function run when a thread that used hazard pointers exits:
+ * frees what it can and hands the record back for reuse.
+ *
+ * @param value the thread's record
+ */
+static void releaseRecord(void *value) {
+    HazardRecord *record = value;
+
+    hpClear(record);
+    scan(record);
+    atomic_store(&record->active, false);
+}
+
+/**
+ * Helper function to create the thread-exit hook, once per process.
+ */
+static void createReleaseKey(void) {
+    pthread_key_create(&release_key, releaseRecord);
+}
+
+/**
+ * Helper function to claim a released record or add a new one to the list.
+ *
+ * @return a record owned by the calling thread
+ */
+static HazardRecord *acquireRecord(void) {
+    for (HazardRecord *curr = atomic_load(&records); curr != NULL; curr = curr->next) {
+        bool expected = false;
+        if (!atomic_load(&curr->active) &&
+            atomic_compare_exchange_strong(&curr->active, &expected, true)) {
+            return curr;
+        }
+    }
+
+    HazardRecord *record = calloc(1, sizeof(HazardRecord));
+    if (record == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    for (int slot = 0; slot < HP_SLOTS_PER_THREAD; slot++) {
+        atomic_init(&record->hazards[slot], NULL);
+    }
+    atomic_init(&record->active, true);
+
+    HazardRecord *head = atomic_load(&records);
+    do {
+        record->next = head;
+    } while (!atomic_compare_exchange_weak(&records, &head, record));
+    atomic_fetch_add(&record_count, 1);
+    return record;
+}
+
+// Per-thread record
+
+/**
+ * Returns the hazard record of the calling thread, claiming one on the
+ * first call. The record is released when the thread exits.
+ *
+ * @return the calling thread's record
+ */
+HazardRecord *hpThreadRecord(void) {
+    if (thread_record == NULL) {
+        pthread_once(&release_once, createReleaseKey);
+        thread_record = acquireRecord();
+        pthread_setspecific(release_key, thread_record);
+    }
+    return thread_record;
+}
+
+// Protection
+
+/**
+ * Publishes a pointer in one hazard slot of a record, replacing what the
+ * slot protected before. The caller must then re-read the location the
+ * pointer came from and retry if it changed: only a pointer that was
+ * still reachable after being published is protected.
+ *
+ * @param record  the calling thread's record
+ * @param slot    slot index, below HP_SLOTS_PER_THREAD
+ * @param pointer the pointer to protect (NULL to clear the slot)
+ */
+void hpSet(HazardRecord *record, int slot, void *pointer) {
+    atomic_store(&record->hazards[slot], pointer);
+}
+
+/**
+ * Clears every hazard slot of a record.
+ *
+ * @param record the calling thread's record
+ */
+void hpClear(HazardRecord *record) {
+    // Dropping protection needs no fence: it only has to follow the reads of the nodes.
+    for (int slot = 0; slot < HP_SLOTS_PER_THREAD; slot++) {
+        atomic_store_explicit(&record->hazards[slot], NULL, memory_order_release);
+    }
+}
+
+// Reclamation
+
+/**
+ * Hands over a node that has been unlinked from its container, so no new
+ * reference to it can be made. It is freed with reclaim once no hazard
+ * pointer protects it.
+ *
+ * @param record  the calling thread's record
+ * @param pointer the unlinked node
+ * @param reclaim function that frees the node (e.g. free)
+ */
+void hpRetire(HazardRecord *record, void *pointer, void (*reclaim)(void *)) {
+    if (record->retired_count == record->retired_capacity) {
+        int capacity = record->retired_capacity > 0 ? record->retired_capacity * 2 : HP_SCAN_THRESHOLD;
+        RetiredNode *retired = realloc(record->retired, sizeof(RetiredNode) * (size_t)capacity);
+        if (retired == NULL) {
+            fprintf(stderr, "Memory allocation failed\n");
+            exit(EXIT_FAILURE);
+        }
+        record->retired = retired;
+        record->retired_capacity = capacity;
+    }
+    record->retired[record->retired_count++] = (RetiredNode){pointer, reclaim};
+
+    int threshold = 2 * HP_SLOTS_PER_THREAD * atomic_load(&record_count);
+    if (threshold < HP_SCAN_THRESHOLD) threshold = HP_SCAN_THRESHOLD;
+    if (record->retired_count >= threshold) scan(record);
+}
+
+/**
+ * Frees every retired node nobody protects right now: those of the
+ * calling thread and those left behind by threads that have exited.
+ * Call it when a phase of concurrent work is over (e.g. before exiting
+ * the main thread, which never runs the thread-exit hook).
+ */
+void hpCollect(void) {
+    HazardRecord *own = hpThreadRecord();
+    scan(own);
+
+    for (HazardRecord *curr = atomic_load(&records); curr != NULL; curr = curr->next) {
+        bool expected = false;
+        if (curr != own && !atomic_load(&curr->active) &&
+            atomic_compare_exchange_strong(&curr->active, &expected, true)) {
+            scan(curr);
+            atomic_store(&curr->active, false);
+        }
+    }
+}
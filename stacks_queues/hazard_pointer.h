@@ -0,0 +1,44 @@
+/**
+ * @file hazard_pointer.h
+ * @brief Public interface of the hazard pointers used by the lock-free containers.
+ *
+ * Before a thread dereferences a node that another thread may unlink and
+ * free, it publishes the node's address in one of its hazard slots
+ * (hpSet) and checks that the node is still reachable. A thread that
+ * unlinks a node does not free it but retires it (hpRetire); retired
+ * nodes are freed in batches, skipping every node some thread still
+ * protects. This makes the lock-free containers safe against both
+ * use-after-free and the ABA problem.
+ *
+ * Every thread gets its own hazard record the first time it calls
+ * hpThreadRecord. When the thread exits the record is released for reuse
+ * together with whatever it could not free yet.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#ifndef HAZARD_POINTER_H
+#define HAZARD_POINTER_H
+
+// Hazard slots each thread owns (the concurrent hash map protects a table and two nodes).
+#define HP_SLOTS_PER_THREAD 3
+
+// Retired nodes a thread collects before it tries to free them.
+#define HP_SCAN_THRESHOLD 64
+
+// Hazard record of one thread (defined in hazard_pointer.c).
+typedef struct HazardRecord HazardRecord;
+
+// Per-thread record
+HazardRecord *hpThreadRecord(void);
+
+// Protection
+void hpSet(HazardRecord *record, int slot, void *pointer);
+void hpClear(HazardRecord *record);
+
+// Reclamation
+void hpRetire(HazardRecord *record, void *pointer, void (*reclaim)(void *));
+void hpCollect(void);
+
+#endif // HAZARD_POINTER_H
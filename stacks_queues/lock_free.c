@@ -0,0 +1,264 @@
+/**
+ * @file lock_free.c
+ * @brief Implementation of the lock-free stack and queue for integers.
+ *
+ * The stack (Treiber, 1986) swings its head pointer with one
+ * compare-and-swap per push or pop. The queue (Michael and Scott, 1996)
+ * keeps a dummy node at the front: enqueue links the new node after the
+ * tail and then swings the tail, and any thread that finds the tail lagging
+ * helps swing it first, so no operation waits for a stalled thread.
+ *
+ * A pop protects the node it is about to read with a hazard pointer and
+ * re-checks that the node is still linked; the queue also protects the
+ * successor whose value it reads. Unlinked nodes are retired, not freed.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#include "lock_free.h"
+#include "hazard_pointer.h"
+
+// Helpers
+
+/**
+ * Helper function to create and allocate memory for a node.
+ *
+ * @param value the value to create the node with
+ * @return a pointer to the newly created node
+ */
+static LFNode *createNode(int value) {
+    LFNode *node = malloc(sizeof(LFNode));
+    if (node == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+
+    node->data = value;
+    atomic_init(&node->next, NULL);
+    return node;
+}
+
+/**
+ * Helper function to read a shared node pointer and protect the node it
+ * points to: publishes it in a hazard slot, then re-reads the source
+ * until both reads agree.
+ *
+ * @param record the calling thread's hazard record
+ * @param slot   hazard slot to use
+ * @param source the shared pointer to read
+ * @return the node, which cannot be freed until the slot is cleared
+ */
+static LFNode *protect(HazardRecord *record, int slot, _Atomic(LFNode *) *source) {
+    LFNode *node = atomic_load(source);
+
+    for (;;) {
+        hpSet(record, slot, node);
+        LFNode *again = atomic_load(source);
+        if (again == node) return node;
+        node = again;
+    }
+}
+
+/**
+ * Helper function to free the nodes of a chain that no other thread can reach.
+ *
+ * @param node the first node of the chain
+ */
+static void freeChain(LFNode *node) {
+    while (node != NULL) {
+        LFNode *next = atomic_load_explicit(&node->next, memory_order_relaxed);
+        free(node);
+        node = next;
+    }
+}
+
+// Stack
+
+/**
+ * Initializes an empty lock-free stack.
+ *
+ * @param stack pointer to the LockFreeStack to initialize
+ */
+void lfsInit(LockFreeStack *stack) {
+    atomic_init(&stack->head, NULL);
+}
+
+/**
+ * Frees every node still in a lock-free stack. No other thread may be
+ * using the stack.
+ *
+ * @param stack pointer to the LockFreeStack to free
+ */
+void lfsFree(LockFreeStack *stack) {
+    freeChain(atomic_load(&stack->head));
+    atomic_store(&stack->head, NULL);
+}
+
+/**
+ * Pushes a value on top of a lock-free stack.
+ *
+ * @param stack pointer to the LockFreeStack
+ * @param value the value to push
+ */
+void lfsPush(LockFreeStack *stack, int value) {
+    LFNode *node = createNode(value);
+    LFNode *head = atomic_load(&stack->head);
+
+    do {
+        atomic_store_explicit(&node->next, head, memory_order_relaxed);
+    } while (!atomic_compare_exchange_weak(&stack->head, &head, node));
+}
+
+/**
+ * Pops the top value of a lock-free stack.
+ *
+ * @param stack pointer to the LockFreeStack
+ * @param value output: the popped value
+ * @return true if a value was popped; false if the stack was empty
+ */
+bool lfsPop(LockFreeStack *stack, int *value) {
+    HazardRecord *record = hpThreadRecord();
+    LFNode *head;
+
+    for (;;) {
+        head = protect(record, 0, &stack->head);
+        if (head == NULL) {
+            hpClear(record);
+            return false;
+        }
+
+        LFNode *next = atomic_load(&head->next);
+        if (atomic_compare_exchange_weak(&stack->head, &head, next)) break;
+    }
+
+    hpClear(record);
+    *value = head->data;
+    hpRetire(record, head, free);
+    return true;
+}
+
+/**
+ * Checks whether a lock-free stack is empty. Other threads may change
+ * the answer right after it is returned.
+ *
+ * @param stack pointer to the LockFreeStack
+ * @return true if empty; false otherwise
+ */
+bool lfsIsEmpty(LockFreeStack *stack) {
+    return atomic_load(&stack->head) == NULL;
+}
+
+// Queue
+
+/**
+ * Initializes an empty lock-free queue (one dummy node).
+ *
+ * @param queue pointer to the LockFreeQueue to initialize
+ */
+void lfqInit(LockFreeQueue *queue) {
+    LFNode *dummy = createNode(0);
+    atomic_init(&queue->head, dummy);
+    atomic_init(&queue->tail, dummy);
+}
+
+/**
+ * Frees every node still in a lock-free queue, dummy included. No other
+ * thread may be using the queue.
+ *
+ * @param queue pointer to the LockFreeQueue to free
+ */
+void lfqFree(LockFreeQueue *queue) {
+    freeChain(atomic_load(&queue->head));
+    atomic_store(&queue->head, NULL);
+    atomic_store(&queue->tail, NULL);
+}
+
+/**
+ * Adds a value at the back of a lock-free queue.
+ *
+ * @param queue pointer to the LockFreeQueue
+ * @param value the value to enqueue
+ */
+void lfqEnqueue(LockFreeQueue *queue, int value) {
+    HazardRecord *record = hpThreadRecord();
+    LFNode *node = createNode(value);
+
+    for (;;) {
+        LFNode *tail = protect(record, 0, &queue->tail);
+        LFNode *next = atomic_load(&tail->next);
+        if (tail != atomic_load(&queue->tail)) continue;
+
+        if (next != NULL) {
+            // The tail is lagging behind a finished link; help swing it.
+            atomic_compare_exchange_weak(&queue->tail, &tail, next);
+            continue;
+        }
+
+        LFNode *expected = NULL;
+        if (atomic_compare_exchange_weak(&tail->next, &expected, node)) {
+            atomic_compare_exchange_strong(&queue->tail, &tail, node);
+            break;
+        }
+    }
+
+    hpClear(record);
+}
+
+/**
+ * Removes the front value of a lock-free queue.
+ *
+ * @param queue pointer to the LockFreeQueue
+ * @param value output: the dequeued value
+ * @return true if a value was dequeued; false if the queue was empty
+ */
+bool lfqDequeue(LockFreeQueue *queue, int *value) {
+    HazardRecord *record = hpThreadRecord();
+    LFNode *head;
+
+    for (;;) {
+        head = protect(record, 0, &queue->head);
+        LFNode *tail = atomic_load(&queue->tail);
+        LFNode *next = atomic_load(&head->next);
+        hpSet(record, 1, next);
+        if (head != atomic_load(&queue->head)) continue;
+
+        if (next == NULL) {
+            hpClear(record);
+            return false;
+        }
+        if (head == tail) {
+            // The tail still points at the dummy; help swing it before unlinking.
+            atomic_compare_exchange_weak(&queue->tail, &tail, next);
+            continue;
+        }
+
+        *value = next->data;
+        if (atomic_compare_exchange_weak(&queue->head, &head, next)) break;
+    }
+
+    hpClear(record);
+    hpRetire(record, head, free);
+    return true;
+}
+
+/**
+ * Checks whether a lock-free queue is empty. Other threads may change
+ * the answer right after it is returned.
+ *
+ * @param queue pointer to the LockFreeQueue
+ * @return true if empty; false otherwise
+ */
+bool lfqIsEmpty(LockFreeQueue *queue) {
+    HazardRecord *record = hpThreadRecord();
+    LFNode *head = protect(record, 0, &queue->head);
+    bool empty = atomic_load(&head->next) == NULL;
+
+    hpClear(record);
+    return empty;
+}
@@ -0,0 +1,62 @@
+/**
+ * @file lock_free.h
+ * @brief Public interface of the lock-free stack and queue for integers.
+ *
+ * LockFreeStack is a Treiber stack and LockFreeQueue a Michael-Scott
+ * queue; both take any number of concurrent producers and consumers
+ * without locks. Their nodes have the same shape as the LinkedList nodes
+ * (a value and a next pointer) with an atomic link. Nodes are unlinked
+ * with compare-and-swap and freed through hazard pointers (see
+ * hazard_pointer.h), so a pop never touches freed memory and cannot be
+ * fooled by a node address being reused (ABA).
+ *
+ * Init and Free must not run concurrently with other operations on the
+ * same container. Retired nodes may outlive the container; hpCollect
+ * frees them once no thread is using them.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#ifndef LOCK_FREE_H
+#define LOCK_FREE_H
+
+#include <stdbool.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+
+// Size (in bytes) the hot fields are padded to so they do not share a cache line.
+#define LF_CACHE_LINE 64
+
+// Structure to represent a node.
+typedef struct LFNode {
+    int data;                      // the value stored in this node
+    _Atomic(struct LFNode *) next; // pointer to the next node (NULL if last node)
+} LFNode;
+
+// Structure to represent a lock-free stack
+typedef struct {
+    alignas(LF_CACHE_LINE) _Atomic(LFNode *) head; // top of the stack (NULL if empty)
+} LockFreeStack;
+
+// Structure to represent a lock-free queue
+typedef struct {
+    alignas(LF_CACHE_LINE) _Atomic(LFNode *) head; // dummy node; the front value is in head->next
+    alignas(LF_CACHE_LINE) _Atomic(LFNode *) tail; // last node, or close behind it
+} LockFreeQueue;
+
+// Stack
+void lfsInit(LockFreeStack *stack);
+void lfsFree(LockFreeStack *stack);
+void lfsPush(LockFreeStack *stack, int value);
+bool lfsPop(LockFreeStack *stack, int *value);
+bool lfsIsEmpty(LockFreeStack *stack);
+
+// Queue
+void lfqInit(LockFreeQueue *queue);
+void lfqFree(LockFreeQueue *queue);
+void lfqEnqueue(LockFreeQueue *queue, int value);
+bool lfqDequeue(LockFreeQueue *queue, int *value);
+bool lfqIsEmpty(LockFreeQueue *queue);
+
+#endif // LOCK_FREE_H
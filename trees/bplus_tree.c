@@ -0,0 +1,698 @@
+/**
+ * @file bplus_tree.c
+ * @brief Implementation of the in-memory B+-tree ordered map.
+ *
+ * Every node keeps its unused key slots at INT_MAX, so the number of keys
+ * smaller than a target can be counted over all BPT_NODE_KEYS slots at
+ * once: in a leaf that count is the position of the target, and in an
+ * inner node the number of keys <= target is the child to descend into.
+ *
+ * Insertion splits a full node in two halves before adding the key and
+ * passes the new right node and its separator up to the parent; the root
+ * splits into a new root. Erasure leaves separators in place (they still
+ * divide the key ranges correctly) and refills a node that drops below
+ * BPT_MIN_KEYS by borrowing one key from a sibling, or by merging with it
+ * when the sibling has no key to spare.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+#include "bplus_tree.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define PREFETCH(addr) __builtin_prefetch(addr)
+#else
+#define PREFETCH(addr) ((void)(addr))
+#endif
+
+// Helpers
+
+/**
+ * Helper function to allocate an empty, cache-line aligned node.
+ *
+ * @param leaf whether the node is a leaf
+ * @return the node; exits if memory allocation fails
+ */
+static BPTNode *newNode(bool leaf) {
+    BPTNode *node = aligned_alloc(alignof(BPTNode), sizeof(BPTNode));
+
+    if (node == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i < BPT_NODE_KEYS; i++) {
+        node->keys[i] = INT_MAX;
+    }
+    node->count = 0;
+    node->leaf = leaf;
+    if (leaf) node->next = NULL;
+    return node;
+}
+
+/**
+ * Helper function to free a node and everything below it.
+ *
+ * @param node the node to free (may be NULL)
+ */
+static void freeNode(BPTNode *node) {
+    if (node == NULL) return;
+    if (!node->leaf) {
+        for (int i = 0; i <= node->count; i++) {
+            freeNode(node->children[i]);
+        }
+    }
+    free(node);
+}
+
+/**
+ * Helper function to count the keys of a node that are smaller than a
+ * target. Since the keys are sorted and padded with INT_MAX, this is
+ * also the index of the first key >= target.
+ *
+ * @param keys   the BPT_NODE_KEYS keys of the node (64-byte aligned)
+ * @param target the value to compare against
+ * @return the number of keys smaller than target
+ */
+static inline int rankLess(const int *keys, int target) {
+#if defined(__SSE2__)
+    __m128i x = _mm_set1_epi32(target);
+    __m128i total = _mm_setzero_si128();
+
+    // Each comparison yields -1 per smaller key; subtracting accumulates the counts.
+    for (int j = 0; j < BPT_NODE_KEYS / 4; j++) {
+        __m128i block = _mm_load_si128((const __m128i *)(keys + 4 * j));
+        total = _mm_sub_epi32(total, _mm_cmpgt_epi32(x, block));
+    }
+    total = _mm_add_epi32(total, _mm_shuffle_epi32(total, _MM_SHUFFLE(1, 0, 3, 2)));
+    total = _mm_add_epi32(total, _mm_shuffle_epi32(total, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(total);
+#else
+    int count = 0;
+    for (int j = 0; j < BPT_NODE_KEYS; j++) {
+        count += (keys[j] < target);
+    }
+    return count;
+#endif
+}
+
+/**
+ * Helper function to pick the child of an inner node that covers a key.
+ *
+ * @param node the inner node
+ * @param key  the key
+ * @return the index of the child (the number of separators <= key)
+ */
+static inline int childIndex(const BPTNode *node, int key) {
+    return key == INT_MAX ? node->count : rankLess(node->keys, key + 1);
+}
+
+/**
+ * Helper function to descend to the leaf that covers a key.
+ *
+ * @param tree pointer to the BPlusTree
+ * @param key  the key
+ * @return the leaf
+ */
+static BPTNode *findLeaf(BPlusTree *tree, int key) {
+    BPTNode *node = tree->root;
+
+    while (!node->leaf) {
+        node = node->children[childIndex(node, key)];
+    }
+    return node;
+}
+
+/**
+ * Helper function to insert a key and its value at a position of a leaf
+ * that is not full.
+ *
+ * @param leaf  the leaf
+ * @param pos   the position (0 to count)
+ * @param key   the key
+ * @param value its value
+ */
+static void leafInsertAt(BPTNode *leaf, int pos, int key, int value) {
+    int moved = leaf->count - pos;
+
+    memmove(leaf->keys + pos + 1, leaf->keys + pos, sizeof(int) * (size_t)moved);
+    memmove(leaf->values + pos + 1, leaf->values + pos, sizeof(int) * (size_t)moved);
+    leaf->keys[pos] = key;
+    leaf->values[pos] = value;
+    leaf->count++;
+}
+
+/**
+ * Helper function to insert a separator and the child to its right into
+ * an inner node that is not full.
+ *
+ * @param node  the inner node
+ * @param pos   the separator's position (0 to count)
+ * @param key   the separator
+ * @param child the child that goes right of it
+ */
+static void innerInsertAt(BPTNode *node, int pos, int key, BPTNode *child) {
+    int moved = node->count - pos;
+
+    memmove(node->keys + pos + 1, node->keys + pos, sizeof(int) * (size_t)moved);
+    memmove(node->children + pos + 2, node->children + pos + 1, sizeof(BPTNode *) * (size_t)moved);
+    node->keys[pos] = key;
+    node->children[pos + 1] = child;
+    node->count++;
+}
+
+/**
+ * Helper function to split a full node in two. A leaf keeps its first
+ * BPT_MIN_KEYS keys and gives the rest to the new node; an inner node
+ * also gives up the key in between, which becomes the separator.
+ *
+ * @param node          the full node
+ * @param separator_out set to the smallest key under the new node
+ * @return the new right node
+ */
+static BPTNode *splitNode(BPTNode *node, int *separator_out) {
+    BPTNode *right = newNode(node->leaf);
+    int keep = BPT_MIN_KEYS;
+
+    if (node->leaf) {
+        right->count = node->count - keep;
+        memcpy(right->keys, node->keys + keep, sizeof(int) * (size_t)right->count);
+        memcpy(right->values, node->values + keep, sizeof(int) * (size_t)right->count);
+        right->next = node->next;
+        node->next = right;
+        *separator_out = right->keys[0];
+    } else {
+        right->count = node->count - keep - 1;
+        memcpy(right->keys, node->keys + keep + 1, sizeof(int) * (size_t)right->count);
+        memcpy(right->children, node->children + keep + 1, sizeof(BPTNode *) * (size_t)(right->count + 1));
+        *separator_out = node->keys[keep];
+    }
+
+    for (int i = keep; i < node->count; i++) {
+        node->keys[i] = INT_MAX;
+    }
+    node->count = keep;
+    return right;
+}
+
+/**
+ * Helper function to insert a key below a node, splitting the nodes on
+ * the way back up when they overflow.
+ *
+ * @param node          the root of the subtree
+ * @param key           the key
+ * @param value         its value
+ * @param separator_out set to the separator of split_out (if any)
+ * @param split_out     set to the new right sibling of node if node split, NULL otherwise
+ * @return true if the key was added; false if it was present and its value replaced
+ */
+static bool insertInto(BPTNode *node, int key, int value, int *separator_out, BPTNode **split_out) {
+    *split_out = NULL;
+
+    if (node->leaf) {
+        int pos = rankLess(node->keys, key);
+        if (pos < node->count && node->keys[pos] == key) {
+            node->values[pos] = value;
+            return false;
+        }
+
+        if (node->count == BPT_NODE_KEYS) {
+            BPTNode *right = splitNode(node, separator_out);
+            *split_out = right;
+            if (pos > node->count) {
+                leafInsertAt(right, pos - node->count, key, value);
+                return true;
+            }
+        }
+        leafInsertAt(node, pos, key, value);
+        return true;
+    }
+
+    int i = childIndex(node, key);
+    int child_separator;
+    BPTNode *child_split;
+    bool added = insertInto(node->children[i], key, value, &child_separator, &child_split);
+    if (child_split == NULL) return added;
+
+    if (node->count == BPT_NODE_KEYS) {
+        BPTNode *right = splitNode(node, separator_out);
+        *split_out = right;
+        if (i > node->count) {
+            innerInsertAt(right, i - node->count - 1, child_separator, child_split);
+            return added;
+        }
+    }
+    innerInsertAt(node, i, child_separator, child_split);
+    return added;
+}
+
+/**
+ * Helper function to remove the key at a position of a leaf.
+ *
+ * @param leaf the leaf
+ * @param pos  the position (0 to count - 1)
+ */
+static void leafRemoveAt(BPTNode *leaf, int pos) {
+    int moved = leaf->count - pos - 1;
+
+    memmove(leaf->keys + pos, leaf->keys + pos + 1, sizeof(int) * (size_t)moved);
+    memmove(leaf->values + pos, leaf->values + pos + 1, sizeof(int) * (size_t)moved);
+    leaf->count--;
+    leaf->keys[leaf->count] = INT_MAX;
+}
+
+/**
+ * Helper function to move the last key of child i - 1 into child i.
+ *
+ * @param parent the parent of both children
+ * @param i      index of the child that receives the key (at least 1)
+ */
+static void borrowFromLeft(BPTNode *parent, int i) {
+    BPTNode *child = parent->children[i];
+    BPTNode *left = parent->children[i - 1];
+    int last = left->count - 1;
+
+    memmove(child->keys + 1, child->keys, sizeof(int) * (size_t)child->count);
+    if (child->leaf) {
+        memmove(child->values + 1, child->values, sizeof(int) * (size_t)child->count);
+        child->keys[0] = left->keys[last];
+        child->values[0] = left->values[last];
+        parent->keys[i - 1] = child->keys[0];
+    } else {
+        memmove(child->children + 1, child->children, sizeof(BPTNode *) * (size_t)(child->count + 1));
+        child->keys[0] = parent->keys[i - 1];
+        child->children[0] = left->children[last + 1];
+        parent->keys[i - 1] = left->keys[last];
+    }
+    child->count++;
+    left->count--;
+    left->keys[left->count] = INT_MAX;
+}
+
+/**
+ * Helper function to move the first key of child i + 1 into child i.
+ *
+ * @param parent the parent of both children
+ * @param i      index of the child that receives the key (below parent->count)
+ */
+static void borrowFromRight(BPTNode *parent, int i) {
+    BPTNode *child = parent->children[i];
+    BPTNode *right = parent->children[i + 1];
+    int moved = right->count - 1;
+
+    if (child->leaf) {
+        child->keys[child->count] = right->keys[0];
+        child->values[child->count] = right->values[0];
+        memmove(right->values, right->values + 1, sizeof(int) * (size_t)moved);
+        memmove(right->keys, right->keys + 1, sizeof(int) * (size_t)moved);
+        parent->keys[i] = right->keys[0];
+    } else {
+        child->keys[child->count] = parent->keys[i];
+        child->children[child->count + 1] = right->children[0];
+        parent->keys[i] = right->keys[0];
+        memmove(right->keys, right->keys + 1, sizeof(int) * (size_t)moved);
+        memmove(right->children, right->children + 1, sizeof(BPTNode *) * (size_t)right->count);
+    }
+    child->count++;
+    right->count--;
+    right->keys[right->count] = INT_MAX;
+}
+
+/**
+ * Helper function to merge child s + 1 into child s and drop the
+ * separator between them from the parent.
+ *
+ * @param parent the parent of both children
+ * @param s      index of the left child
+ */
+static void mergeChildren(BPTNode *parent, int s) {
+    BPTNode *left = parent->children[s];
+    BPTNode *right = parent->children[s + 1];
+
+    if (left->leaf) {
+        memcpy(left->keys + left->count, right->keys, sizeof(int) * (size_t)right->count);
+        memcpy(left->values + left->count, right->values, sizeof(int) * (size_t)right->count);
+        left->count += right->count;
+        left->next = right->next;
+    } else {
+        left->keys[left->count] = parent->keys[s];
+        memcpy(left->keys + left->count + 1, right->keys, sizeof(int) * (size_t)right->count);
+        memcpy(left->children + left->count + 1, right->children, sizeof(BPTNode *) * (size_t)(right->count + 1));
+        left->count += right->count + 1;
+    }
+    free(right);
+
+    int moved = parent->count - s - 1;
+    memmove(parent->keys + s, parent->keys + s + 1, sizeof(int) * (size_t)moved);
+    memmove(parent->children + s + 1, parent->children + s + 2, sizeof(BPTNode *) * (size_t)moved);
+    parent->count--;
+    parent->keys[parent->count] = INT_MAX;
+}
+
+/**
+ * Helper function to erase a key below a node, refilling the children
+ * that drop below BPT_MIN_KEYS on the way back up.
+ *
+ * @param node the root of the subtree
+ * @param key  the key to erase
+ * @return true if the key was found and erased; false otherwise
+ */
+static bool eraseFrom(BPTNode *node, int key) {
+    if (node->leaf) {
+        int pos = rankLess(node->keys, key);
+        if (pos == node->count || node->keys[pos] != key) return false;
+        leafRemoveAt(node, pos);
+        return true;
+    }
+
+    int i = childIndex(node, key);
+    BPTNode *child = node->children[i];
+    if (!eraseFrom(child, key)) return false;
+    if (child->count >= BPT_MIN_KEYS) return true;
+
+    if (i > 0 && node->children[i - 1]->count > BPT_MIN_KEYS) {
+        borrowFromLeft(node, i);
+    } else if (i < node->count && node->children[i + 1]->count > BPT_MIN_KEYS) {
+        borrowFromRight(node, i);
+    } else {
+        mergeChildren(node, i > 0 ? i - 1 : i);
+    }
+    return true;
+}
+
+// Core Functions
+
+/**
+ * Initializes an empty B+-tree.
+ *
+ * @param tree pointer to the BPlusTree to initialize
+ */
+void bptInit(BPlusTree *tree) {
+    tree->root = newNode(true);
+    tree->size = 0;
+    tree->height = 1;
+}
+
+/**
+ * Frees every node of a B+-tree.
+ *
+ * @param tree pointer to the BPlusTree to free
+ */
+void bptFree(BPlusTree *tree) {
+    freeNode(tree->root);
+    tree->root = NULL;
+    tree->size = 0;
+    tree->height = 0;
+}
+
+/**
+ * Replaces the contents of a B+-tree with the keys of a sorted dynamic
+ * array in O(n). The keys are spread evenly over as few full leaves as
+ * possible, then every inner level is built the same way over the level
+ * below it.
+ *
+ * @param tree   pointer to the BPlusTree
+ * @param keys   strictly increasing keys (exits otherwise)
+ * @param values the value of every key, or NULL to map every key to 0
+ */
+void bptBulkLoad(BPlusTree *tree, DynamicArray *keys, DynamicArray *values) {
+    long n = keys->size;
+
+    if (values != NULL && values->size != keys->size) {
+        fprintf(stderr, "Error: bulk-load needs one value per key\n");
+        exit(EXIT_FAILURE);
+    }
+    for (long i = 1; i < n; i++) {
+        if (keys->data[i - 1] >= keys->data[i]) {
+            fprintf(stderr, "Error: bulk-load keys must be strictly increasing\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    freeNode(tree->root);
+    tree->size = (int)n;
+    tree->height = 1;
+    if (n == 0) {
+        tree->root = newNode(true);
+        return;
+    }
+
+    long count = (n + BPT_NODE_KEYS - 1) / BPT_NODE_KEYS;
+    BPTNode **level = malloc(sizeof(BPTNode *) * (size_t)count);
+    int *lowest = malloc(sizeof(int) * (size_t)count);
+    if (level == NULL || lowest == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+
+    for (long l = 0; l < count; l++) {
+        long start = l * n / count;
+        long end = (l + 1) * n / count;
+        BPTNode *leaf = newNode(true);
+
+        leaf->count = (int)(end - start);
+        memcpy(leaf->keys, keys->data + start, sizeof(int) * (size_t)leaf->count);
+        if (values != NULL) {
+            memcpy(leaf->values, values->data + start, sizeof(int) * (size_t)leaf->count);
+        } else {
+            memset(leaf->values, 0, sizeof(int) * (size_t)leaf->count);
+        }
+        if (l > 0) level[l - 1]->next = leaf;
+        level[l] = leaf;
+        lowest[l] = leaf->keys[0];
+    }
+
+    // Each pass groups the current level under parents, in place: parent p
+    // only reads entries at or after p.
+    while (count > 1) {
+        long parents = (count + BPT_NODE_KEYS) / (BPT_NODE_KEYS + 1);
+
+        for (long p = 0; p < parents; p++) {
+            long start = p * count / parents;
+            long end = (p + 1) * count / parents;
+            BPTNode *node = newNode(false);
+
+            node->count = (int)(end - start - 1);
+            for (long c = start; c < end; c++) {
+                node->children[c - start] = level[c];
+                if (c > start) node->keys[c - start - 1] = lowest[c];
+            }
+            level[p] = node;
+            lowest[p] = lowest[start];
+        }
+        count = parents;
+        tree->height++;
+    }
+
+    tree->root = level[0];
+    free(level);
+    free(lowest);
+}
+
+// Insertion/Deletion
+
+/**
+ * Inserts a key into a B+-tree, or replaces its value if present.
+ *
+ * @param tree  pointer to the BPlusTree
+ * @param key   the key
+ * @param value its value
+ * @return true if the key was added; false if it was already present
+ */
+bool bptInsert(BPlusTree *tree, int key, int value) {
+    int separator;
+    BPTNode *split;
+    bool added = insertInto(tree->root, key, value, &separator, &split);
+
+    if (split != NULL) {
+        BPTNode *root = newNode(false);
+        root->keys[0] = separator;
+        root->count = 1;
+        root->children[0] = tree->root;
+        root->children[1] = split;
+        tree->root = root;
+        tree->height++;
+    }
+    tree->size += added;
+    return added;
+}
+
+/**
+ * Erases a key from a B+-tree.
+ *
+ * @param tree pointer to the BPlusTree
+ * @param key  the key to erase
+ * @return true if the key was found and erased; false otherwise
+ */
+bool bptErase(BPlusTree *tree, int key) {
+    if (!eraseFrom(tree->root, key)) return false;
+
+    // A root left with a single child gives its place to it.
+    if (!tree->root->leaf && tree->root->count == 0) {
+        BPTNode *old = tree->root;
+        tree->root = old->children[0];
+        free(old);
+        tree->height--;
+    }
+    tree->size--;
+    return true;
+}
+
+// Lookup/Utility
+
+/**
+ * Looks up the value of a key.
+ *
+ * @param tree      pointer to the BPlusTree
+ * @param key       the key
+ * @param out_value receives the value if the key is present (may be NULL)
+ * @return true if the key is present; false otherwise
+ */
+bool bptGet(BPlusTree *tree, int key, int *out_value) {
+    BPTNode *leaf = findLeaf(tree, key);
+    int pos = rankLess(leaf->keys, key);
+
+    if (pos == leaf->count || leaf->keys[pos] != key) return false;
+    if (out_value != NULL) *out_value = leaf->values[pos];
+    return true;
+}
+
+/**
+ * Checks whether a key is present in a B+-tree.
+ *
+ * @param tree pointer to the BPlusTree
+ * @param key  the key
+ * @return true if present; false otherwise
+ */
+bool bptContains(BPlusTree *tree, int key) {
+    return bptGet(tree, key, NULL);
+}
+
+/**
+ * Appends every key in [low, high] to a dynamic array, in order, copying
+ * them a leaf at a time.
+ *
+ * @param tree     pointer to the BPlusTree
+ * @param low      smallest key of the range
+ * @param high     largest key of the range
+ * @param out_keys the array the keys are appended to
+ * @return the number of keys appended
+ */
+int bptRange(BPlusTree *tree, int low, int high, DynamicArray *out_keys) {
+    if (low > high) return 0;
+
+    BPTCursor cursor = bptSeek(tree, low);
+    int appended = 0;
+
+    while (cursor.leaf != NULL) {
+        BPTNode *leaf = cursor.leaf;
+        if (leaf->next != NULL) PREFETCH(leaf->next);
+        int end = high == INT_MAX ? leaf->count : rankLess(leaf->keys, high + 1);
+        int run = end - cursor.index;
+
+        if (run > 0) {
+            if (out_keys->size + run > out_keys->capacity) {
+                int grown = out_keys->capacity * 2;
+                daResize(out_keys, grown > out_keys->size + run ? grown : out_keys->size + run);
+            }
+            memcpy(out_keys->data + out_keys->size, leaf->keys + cursor.index, sizeof(int) * (size_t)run);
+            out_keys->size += run;
+            appended += run;
+        }
+        if (end < leaf->count) break;
+        cursor.leaf = leaf->next;
+        cursor.index = 0;
+    }
+    return appended;
+}
+
+/**
+ * Returns the number of keys in a B+-tree.
+ *
+ * @param tree pointer to the BPlusTree
+ * @return the number of keys
+ */
+int bptSize(BPlusTree *tree) {
+    return tree->size;
+}
+
+/**
+ * Checks whether a B+-tree is empty.
+ *
+ * @param tree pointer to the BPlusTree
+ * @return true if empty; false otherwise
+ */
+bool bptIsEmpty(BPlusTree *tree) {
+    return tree->size == 0;
+}
+
+// Cursor
+
+/**
+ * Positions a cursor on the first key >= a given key.
+ *
+ * @param tree pointer to the BPlusTree
+ * @param key  the key to seek
+ * @return the cursor (not valid if every key is smaller)
+ */
+BPTCursor bptSeek(BPlusTree *tree, int key) {
+    BPTNode *leaf = findLeaf(tree, key);
+    BPTCursor cursor = {leaf, rankLess(leaf->keys, key)};
+
+    if (cursor.index == leaf->count) {
+        cursor.leaf = leaf->next;
+        cursor.index = 0;
+    }
+    return cursor;
+}
+
+/**
+ * Checks whether a cursor is on a key.
+ *
+ * @param cursor pointer to the BPTCursor
+ * @return true if it is; false once it moved past the last key
+ */
+bool bptCursorValid(BPTCursor *cursor) {
+    return cursor->leaf != NULL;
+}
+
+/**
+ * Returns the key under a valid cursor.
+ *
+ * @param cursor pointer to the BPTCursor
+ * @return the key
+ */
+int bptCursorKey(BPTCursor *cursor) {
+    return cursor->leaf->keys[cursor->index];
+}
+
+/**
+ * Returns the value of the key under a valid cursor.
+ *
+ * @param cursor pointer to the BPTCursor
+ * @return the value
+ */
+int bptCursorValue(BPTCursor *cursor) {
+    return cursor->leaf->values[cursor->index];
+}
+
+/**
+ * Moves a valid cursor to the next key, following the leaf links.
+ *
+ * @param cursor pointer to the BPTCursor
+ */
+void bptCursorNext(BPTCursor *cursor) {
+    if (++cursor->index == cursor->leaf->count) {
+        cursor->leaf = cursor->leaf->next;
+        cursor->index = 0;
+    }
+}
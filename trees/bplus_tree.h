@@ -0,0 +1,86 @@
+/**
+ * @file bplus_tree.h
+ * @brief Public interface of the in-memory B+-tree ordered map for int keys.
+ *
+ * BPlusTree (prefix `bpt`) maps int keys to int values in key order, as a
+ * replacement for a sorted DynamicArray kept up to date with daInsertAt:
+ * an insert or erase moves at most BPT_NODE_KEYS keys instead of half
+ * the array. Every node holds BPT_NODE_KEYS keys in two 64-byte cache
+ * lines, padded with INT_MAX past the last key, so a node is searched by
+ * comparing all of its keys against the target with SIMD instructions
+ * and counting the smaller ones, without a branch per key.
+ *
+ * Keys and values live in the leaves, which are linked left to right so
+ * a range scan walks the leaves without going back through the tree
+ * (see BPTCursor and bptRange). A sorted DynamicArray can be bulk-loaded
+ * in O(n), which packs the leaves full.
+ *
+ * @author Isaac Tapia
+ * @date   May 2025
+ */
+
+#ifndef BPLUS_TREE_H
+#define BPLUS_TREE_H
+
+#include <stdalign.h>
+#include <stdbool.h>
+
+#include "arrays/dynamic_array.h"
+
+// Keys per node: two 64-byte cache lines of ints (a multiple of 4 for SIMD).
+#define BPT_NODE_KEYS 32
+
+// Fewest keys a node other than the root keeps after an erase.
+#define BPT_MIN_KEYS (BPT_NODE_KEYS / 2)
+
+// Structure to represent a node (inner or leaf).
+typedef struct BPTNode {
+    alignas(64) int keys[BPT_NODE_KEYS];             // sorted keys, INT_MAX past count
+    int count;                                       // number of keys in use
+    bool leaf;                                       // true for leaves
+    union {
+        struct BPTNode *children[BPT_NODE_KEYS + 1]; // inner: count + 1 children; keys[i] is the smallest key under children[i + 1]
+        struct {
+            int values[BPT_NODE_KEYS];               // leaf: value of every key
+            struct BPTNode *next;                    // leaf: next leaf in key order (NULL if last)
+        };
+    };
+} BPTNode;
+
+// Structure to represent a B+-tree.
+typedef struct {
+    BPTNode *root;              // root node (an empty leaf when the tree is empty)
+    int size;                   // number of keys in the tree
+    int height;                 // number of levels (1 when the root is a leaf)
+} BPlusTree;
+
+// Structure to represent a position in the leaves, for range scans.
+typedef struct {
+    BPTNode *leaf;              // current leaf (NULL past the last key)
+    int index;                  // index of the current key in the leaf
+} BPTCursor;
+
+// Core Functions
+void bptInit(BPlusTree *tree);
+void bptFree(BPlusTree *tree);
+void bptBulkLoad(BPlusTree *tree, DynamicArray *keys, DynamicArray *values);
+
+// Insertion/Deletion
+bool bptInsert(BPlusTree *tree, int key, int value);
+bool bptErase(BPlusTree *tree, int key);
+
+// Lookup/Utility
+bool bptGet(BPlusTree *tree, int key, int *out_value);
+bool bptContains(BPlusTree *tree, int key);
+int bptRange(BPlusTree *tree, int low, int high, DynamicArray *out_keys);
+int bptSize(BPlusTree *tree);
+bool bptIsEmpty(BPlusTree *tree);
+
+// Cursor
+BPTCursor bptSeek(BPlusTree *tree, int key);
+bool bptCursorValid(BPTCursor *cursor);
+int bptCursorKey(BPTCursor *cursor);
+int bptCursorValue(BPTCursor *cursor);
+void bptCursorNext(BPTCursor *cursor);
+
+#endif // BPLUS_TREE_H